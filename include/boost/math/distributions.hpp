@@ -49,6 +49,8 @@
 #include <boost/math/distributions/weibull.hpp>
 #include <boost/math/distributions/find_scale.hpp>
 #include <boost/math/distributions/find_location.hpp>
+#include <boost/math/distributions/frozen.hpp>
+#include <boost/math/distributions/inverse_cdf_table.hpp>
 
 #endif // BOOST_MATH_DISTRIBUTIONS_HPP
 
@@ -28,6 +28,7 @@
 #include <boost/math/special_functions/beta.hpp> // for beta.
 #include <boost/math/distributions/complement.hpp> // complements.
 #include <boost/math/distributions/detail/common_error_handling.hpp> // error checks
+#include <boost/math/distributions/detail/batch_evaluation.hpp>
 #include <boost/math/special_functions/fpclassify.hpp> // isnan.
 #include <boost/math/tools/roots.hpp> // for root finding.
 
@@ -538,6 +539,60 @@ namespace boost
       return ibetac_inv(a, b, q, static_cast<RealType*>(nullptr), Policy());
     } // Quantile Complement
 
+    //
+    // Array-at-a-time pdf: alpha and beta are checked once for the whole
+    // range, and the terms of the incomplete beta prefix which depend only
+    // on them are calculated just once.  Arguments other than 0 < x < 1
+    // are passed on to the scalar version:
+    //
+    template <class RealType, class Policy, class ForwardIterator, class OutputIterator>
+    OutputIterator pdf(const beta_distribution<RealType, Policy>& dist, ForwardIterator first, ForwardIterator last, OutputIterator out)
+    {
+      BOOST_FPU_EXCEPTION_GUARD
+      typedef typename policies::evaluation<RealType, Policy>::type eval_type;
+      typedef typename policies::normalise<
+        Policy,
+        policies::promote_float<false>,
+        policies::promote_double<false>,
+        policies::discrete_quantile<>,
+        policies::assert_undefined<> >::type forwarding_policy;
+      typedef typename lanczos::lanczos<eval_type, Policy>::type lanczos_type;
+
+      if(first == last)
+      {
+        return out;
+      }
+
+      static const char* function = "boost::math::pdf(beta_distribution<%1%> const&, %1%)";
+
+      RealType result = 0;
+      if(false == beta_detail::check_dist(function, dist.alpha(), dist.beta(), &result, Policy()))
+      {
+        return detail::distribution_batch_fill(first, last, out, result);
+      }
+      const eval_type a = static_cast<eval_type>(dist.alpha());
+      const eval_type b = static_cast<eval_type>(dist.beta());
+      const detail::ibeta_power_terms_constants<eval_type> constants = detail::make_ibeta_power_terms_constants(a, b, lanczos_type());
+
+      return detail::distribution_batch<RealType>(first, last, out,
+        [&](const RealType* x, RealType* r, std::size_t n)
+        {
+          for(std::size_t i = 0; i < n; ++i)
+          {
+            if((x[i] > 0) && (x[i] < 1))
+            {
+              // As ibeta_derivative(alpha, beta, x, Policy()):
+              eval_type f1 = detail::ibeta_derivative_imp(a, b, static_cast<eval_type>(x[i]), forwarding_policy(), constants);
+              r[i] = policies::checked_narrowing_cast<RealType, forwarding_policy>(f1, "boost::math::ibeta_derivative<%1%>(%1%,%1%,%1%)");
+            }
+            else
+            {
+              r[i] = pdf(dist, x[i]);
+            }
+          }
+        });
+    } // pdf
+
   } // namespace math
 } // namespace boost
 
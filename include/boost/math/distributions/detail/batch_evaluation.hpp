@@ -0,0 +1,59 @@
+//  Copyright Boost.Math contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_STATS_DETAIL_BATCH_EVALUATION_HPP
+#define BOOST_STATS_DETAIL_BATCH_EVALUATION_HPP
+
+// This file contains the machinery shared by the distributions which
+// provide their own array-at-a-time pdf/cdf/quantile overloads: the
+// arguments are copied a block at a time into a local buffer, and a
+// kernel - written as a simple loop over that buffer with the parameter
+// validation and any parameter-only constants already hoisted out -
+// is applied to the whole block before the results are copied out.
+//
+// Distributions without specialised overloads pick up the generic
+// element-by-element versions in derived_accessors.hpp.
+
+#include <cstddef>
+#include <iterator>
+
+namespace boost{ namespace math{ namespace detail{
+
+constexpr std::size_t distribution_batch_block_size = 64;
+
+template <class RealType, class ForwardIterator, class OutputIterator, class Kernel>
+OutputIterator distribution_batch(ForwardIterator first, ForwardIterator last, OutputIterator out, Kernel kernel)
+{
+   RealType x[distribution_batch_block_size];
+   RealType result[distribution_batch_block_size];
+
+   while(first != last)
+   {
+      std::size_t n = 0;
+      for(; (n < distribution_batch_block_size) && (first != last); ++n, ++first)
+         x[n] = static_cast<RealType>(*first);
+      kernel(static_cast<const RealType*>(x), static_cast<RealType*>(result), n);
+      for(std::size_t i = 0; i < n; ++i, ++out)
+         *out = result[i];
+   }
+   return out;
+}
+
+//
+// Used when the distribution's parameters fail validation, and the
+// error handler returned rather than threw: every result is then the
+// value the handler gave us, just as it would be for the scalar calls.
+//
+template <class RealType, class ForwardIterator, class OutputIterator>
+OutputIterator distribution_batch_fill(ForwardIterator first, ForwardIterator last, OutputIterator out, const RealType& value)
+{
+   for(; first != last; ++first, ++out)
+      *out = value;
+   return out;
+}
+
+}}} // namespaces
+
+#endif // BOOST_STATS_DETAIL_BATCH_EVALUATION_HPP
@@ -150,6 +150,38 @@ inline typename Distribution::value_type quantile(const complemented2_type<Distr
    return quantile(complement(c.dist, static_cast<value_type>(c.param)));
 }
 
+//
+// Array-at-a-time versions of pdf, cdf and quantile: evaluate the
+// function at each element of [first, last) and write the results to out.
+// These generic versions just call the scalar functions for each element,
+// distributions which can usefully hoist their parameter validation out
+// of the loop provide more specialised overloads:
+//
+template <class Distribution, class ForwardIterator, class OutputIterator>
+inline OutputIterator pdf(const Distribution& dist, ForwardIterator first, ForwardIterator last, OutputIterator out)
+{
+   typedef typename Distribution::value_type value_type;
+   for(; first != last; ++first, ++out)
+      *out = pdf(dist, static_cast<value_type>(*first));
+   return out;
+}
+template <class Distribution, class ForwardIterator, class OutputIterator>
+inline OutputIterator cdf(const Distribution& dist, ForwardIterator first, ForwardIterator last, OutputIterator out)
+{
+   typedef typename Distribution::value_type value_type;
+   for(; first != last; ++first, ++out)
+      *out = cdf(dist, static_cast<value_type>(*first));
+   return out;
+}
+template <class Distribution, class ForwardIterator, class OutputIterator>
+inline OutputIterator quantile(const Distribution& dist, ForwardIterator first, ForwardIterator last, OutputIterator out)
+{
+   typedef typename Distribution::value_type value_type;
+   for(; first != last; ++first, ++out)
+      *out = quantile(dist, static_cast<value_type>(*first));
+   return out;
+}
+
 template <class Dist>
 inline typename Dist::value_type median(const Dist& d)
 { // median - default definition for those distributions for which a
@@ -12,6 +12,7 @@
 #include <boost/math/special_functions/expm1.hpp>
 #include <boost/math/distributions/complement.hpp>
 #include <boost/math/distributions/detail/common_error_handling.hpp>
+#include <boost/math/distributions/detail/batch_evaluation.hpp>
 
 #ifdef _MSC_VER
 # pragma warning(push)
@@ -232,6 +233,92 @@ inline RealType quantile(const complemented2_type<exponential_distribution<RealT
    return result;
 }
 
+//
+// Array-at-a-time versions, lambda is validated once for the whole
+// range and the arguments that need special handling (negative,
+// non-finite, or probabilities of exactly 0 or 1) are passed on to
+// the scalar versions:
+//
+template <class RealType, class Policy, class ForwardIterator, class OutputIterator>
+OutputIterator pdf(const exponential_distribution<RealType, Policy>& dist, ForwardIterator first, ForwardIterator last, OutputIterator out)
+{
+   BOOST_MATH_STD_USING // for ADL of std functions
+
+   if(first == last)
+      return out;
+
+   static const char* function = "boost::math::pdf(const exponential_distribution<%1%>&, %1%)";
+
+   const RealType lambda = dist.lambda();
+   RealType result = 0;
+   if(0 == detail::verify_lambda(function, lambda, &result, Policy()))
+      return detail::distribution_batch_fill(first, last, out, result);
+
+   return detail::distribution_batch<RealType>(first, last, out,
+      [&](const RealType* x, RealType* r, std::size_t n)
+      {
+         for(std::size_t i = 0; i < n; ++i)
+            r[i] = lambda * exp(-lambda * x[i]);
+         for(std::size_t i = 0; i < n; ++i)
+         {
+            if(!((x[i] >= 0) && (boost::math::isfinite)(x[i])))
+               r[i] = pdf(dist, x[i]);
+         }
+      });
+} // pdf
+
+template <class RealType, class Policy, class ForwardIterator, class OutputIterator>
+OutputIterator cdf(const exponential_distribution<RealType, Policy>& dist, ForwardIterator first, ForwardIterator last, OutputIterator out)
+{
+   if(first == last)
+      return out;
+
+   static const char* function = "boost::math::cdf(const exponential_distribution<%1%>&, %1%)";
+
+   const RealType lambda = dist.lambda();
+   RealType result = 0;
+   if(0 == detail::verify_lambda(function, lambda, &result, Policy()))
+      return detail::distribution_batch_fill(first, last, out, result);
+
+   return detail::distribution_batch<RealType>(first, last, out,
+      [&](const RealType* x, RealType* r, std::size_t n)
+      {
+         for(std::size_t i = 0; i < n; ++i)
+         {
+            if((x[i] >= 0) && (boost::math::isfinite)(x[i]))
+               r[i] = -boost::math::expm1(-x[i] * lambda, Policy());
+            else
+               r[i] = cdf(dist, x[i]);
+         }
+      });
+} // cdf
+
+template <class RealType, class Policy, class ForwardIterator, class OutputIterator>
+OutputIterator quantile(const exponential_distribution<RealType, Policy>& dist, ForwardIterator first, ForwardIterator last, OutputIterator out)
+{
+   if(first == last)
+      return out;
+
+   static const char* function = "boost::math::quantile(const exponential_distribution<%1%>&, %1%)";
+
+   const RealType lambda = dist.lambda();
+   RealType result = 0;
+   if(0 == detail::verify_lambda(function, lambda, &result, Policy()))
+      return detail::distribution_batch_fill(first, last, out, result);
+
+   return detail::distribution_batch<RealType>(first, last, out,
+      [&](const RealType* p, RealType* r, std::size_t n)
+      {
+         for(std::size_t i = 0; i < n; ++i)
+         {
+            if((p[i] > 0) && (p[i] < 1))
+               r[i] = -boost::math::log1p(-p[i], Policy()) / lambda;
+            else
+               r[i] = quantile(dist, p[i]);
+         }
+      });
+} // quantile
+
 template <class RealType, class Policy>
 inline RealType mean(const exponential_distribution<RealType, Policy>& dist)
 {
@@ -0,0 +1,366 @@
+//  Copyright Boost.Math contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_STATS_FROZEN_HPP
+#define BOOST_STATS_FROZEN_HPP
+
+// frozen_distribution<Distribution> wraps a distribution whose parameters
+// are fixed, and computes everything that depends only on those parameters
+// once, at construction, rather than on every call to pdf, cdf etc.
+//
+// The generic version simply forwards to the wrapped distribution,
+// specialisations are provided for distributions where there is work
+// worth caching.  In every case the results are identical to those
+// obtained from the wrapped distribution.
+
+#include <boost/math/distributions/fwd.hpp>
+#include <boost/math/distributions/complement.hpp>
+#include <boost/math/distributions/gamma.hpp>
+#include <boost/math/distributions/beta.hpp>
+#include <boost/math/distributions/students_t.hpp>
+#include <boost/math/distributions/normal.hpp>
+#include <boost/math/distributions/non_central_chi_squared.hpp>
+#include <boost/math/special_functions/lanczos.hpp>
+#include <boost/math/policies/policy.hpp>
+#include <boost/math/policies/error_handling.hpp>
+
+namespace boost{ namespace math{
+
+template <class Distribution>
+class frozen_distribution
+{
+public:
+   using distribution_type = Distribution;
+   using value_type = typename Distribution::value_type;
+   using policy_type = typename Distribution::policy_type;
+
+   explicit frozen_distribution(const Distribution& dist) : m_dist(dist) {}
+
+   const Distribution& distribution()const { return m_dist; }
+
+   value_type pdf(const value_type& x)const { return boost::math::pdf(m_dist, x); }
+   value_type logpdf(const value_type& x)const { return boost::math::logpdf(m_dist, x); }
+   value_type cdf(const value_type& x)const { return boost::math::cdf(m_dist, x); }
+   value_type quantile(const value_type& p)const { return boost::math::quantile(m_dist, p); }
+
+private:
+   Distribution m_dist;
+};
+
+//
+// Gamma: the pdf caches the shape dependent part of the incomplete
+// gamma prefix, logpdf caches lgamma(shape) and shape * log(scale):
+//
+template <class RealType, class Policy>
+class frozen_distribution<gamma_distribution<RealType, Policy> >
+{
+   typedef typename policies::evaluation<RealType, Policy>::type eval_type;
+   typedef typename policies::normalise<
+      Policy,
+      policies::promote_float<false>,
+      policies::promote_double<false>,
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+   typedef typename lanczos::lanczos<eval_type, Policy>::type lanczos_type;
+
+public:
+   using distribution_type = gamma_distribution<RealType, Policy>;
+   using value_type = RealType;
+   using policy_type = Policy;
+
+   explicit frozen_distribution(const distribution_type& dist)
+      : m_dist(dist), m_prefix_a_term(0), m_k_log_theta(0), m_lgamma_k(0)
+   {
+      BOOST_MATH_STD_USING
+      RealType result;
+      m_valid = detail::check_gamma("boost::math::frozen_distribution<gamma_distribution<%1%> >", dist.scale(), dist.shape(), &result, Policy());
+      if(m_valid)
+      {
+         using boost::math::lgamma;
+         m_prefix_a_term = detail::regularised_gamma_prefix_a_term(static_cast<eval_type>(dist.shape()), forwarding_policy(), lanczos_type());
+         m_k_log_theta = -dist.shape() * log(dist.scale());
+         m_lgamma_k = lgamma(dist.shape());
+      }
+   }
+
+   const distribution_type& distribution()const { return m_dist; }
+
+   RealType pdf(const RealType& x)const
+   {
+      BOOST_FPU_EXCEPTION_GUARD
+      static const char* function = "boost::math::pdf(const gamma_distribution<%1%>&, %1%)";
+      RealType result = 0;
+      if(!m_valid)
+         return boost::math::pdf(m_dist, x);
+      if(false == detail::check_gamma_x(function, x, &result, Policy()))
+         return result;
+      if(x == 0)
+         return 0;
+      const RealType shape = m_dist.shape();
+      const RealType scale = m_dist.scale();
+      const eval_type a = static_cast<eval_type>(shape);
+      const eval_type z = static_cast<eval_type>(x / scale);
+      // x / scale may underflow to zero, which gamma_p_derivative treats
+      // as a special case:
+      if(z == 0)
+         return boost::math::pdf(m_dist, x);
+      // As gamma_p_derivative(shape, x / scale, Policy()), which has no
+      // further special cases for a > 0 and z > 0:
+      eval_type f1 = detail::gamma_p_derivative_imp(a, z, forwarding_policy(),
+         detail::regularised_gamma_prefix(a, z, forwarding_policy(), lanczos_type(), m_prefix_a_term));
+      result = policies::checked_narrowing_cast<RealType, forwarding_policy>(f1, "boost::math::gamma_p_derivative<%1%>(%1%, %1%)");
+      return result / scale;
+   }
+   RealType logpdf(const RealType& x)const
+   {
+      BOOST_MATH_STD_USING
+      static const char* function = "boost::math::logpdf(const gamma_distribution<%1%>&, %1%)";
+      RealType result = -std::numeric_limits<RealType>::infinity();
+      if(!m_valid)
+         return boost::math::logpdf(m_dist, x);
+      if(false == detail::check_gamma_x(function, x, &result, Policy()))
+         return result;
+      if(x == 0)
+         return std::numeric_limits<RealType>::quiet_NaN();
+      const RealType k = m_dist.shape();
+      return m_k_log_theta + (k - 1) * log(x) - m_lgamma_k - (x / m_dist.scale());
+   }
+   RealType cdf(const RealType& x)const { return boost::math::cdf(m_dist, x); }
+   RealType quantile(const RealType& p)const { return boost::math::quantile(m_dist, p); }
+
+private:
+   distribution_type m_dist;
+   bool m_valid;
+   eval_type m_prefix_a_term;
+   RealType m_k_log_theta;
+   RealType m_lgamma_k;
+};
+
+//
+// Beta: the pdf caches the Lanczos terms of the incomplete beta prefix
+// which depend only upon alpha and beta:
+//
+template <class RealType, class Policy>
+class frozen_distribution<beta_distribution<RealType, Policy> >
+{
+   typedef typename policies::evaluation<RealType, Policy>::type eval_type;
+   typedef typename policies::normalise<
+      Policy,
+      policies::promote_float<false>,
+      policies::promote_double<false>,
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+   typedef typename lanczos::lanczos<eval_type, Policy>::type lanczos_type;
+
+public:
+   using distribution_type = beta_distribution<RealType, Policy>;
+   using value_type = RealType;
+   using policy_type = Policy;
+
+   explicit frozen_distribution(const distribution_type& dist)
+      : m_dist(dist), m_constants()
+   {
+      RealType result;
+      m_valid = beta_detail::check_dist("boost::math::frozen_distribution<beta_distribution<%1%> >", dist.alpha(), dist.beta(), &result, Policy());
+      if(m_valid)
+         m_constants = detail::make_ibeta_power_terms_constants(static_cast<eval_type>(dist.alpha()), static_cast<eval_type>(dist.beta()), lanczos_type());
+   }
+
+   const distribution_type& distribution()const { return m_dist; }
+
+   RealType pdf(const RealType& x)const
+   {
+      BOOST_FPU_EXCEPTION_GUARD
+      static const char* function = "boost::math::pdf(beta_distribution<%1%> const&, %1%)";
+      RealType result = 0;
+      if(!m_valid)
+         return boost::math::pdf(m_dist, x);
+      if(false == beta_detail::check_x(function, x, &result, Policy()))
+         return result;
+      if(x == 0 || x == 1)
+         return RealType(0);
+      // As ibeta_derivative(alpha, beta, x, Policy()) for 0 < x < 1:
+      eval_type f1 = detail::ibeta_derivative_imp(static_cast<eval_type>(m_dist.alpha()), static_cast<eval_type>(m_dist.beta()), static_cast<eval_type>(x), forwarding_policy(), m_constants);
+      return policies::checked_narrowing_cast<RealType, forwarding_policy>(f1, "boost::math::ibeta_derivative<%1%>(%1%,%1%,%1%)");
+   }
+   RealType logpdf(const RealType& x)const { return boost::math::logpdf(m_dist, x); }
+   RealType cdf(const RealType& x)const { return boost::math::cdf(m_dist, x); }
+   RealType quantile(const RealType& p)const { return boost::math::quantile(m_dist, p); }
+
+private:
+   distribution_type m_dist;
+   bool m_valid;
+   detail::ibeta_power_terms_constants<eval_type> m_constants;
+};
+
+//
+// Student's t: the pdf caches the normalising sqrt(df) * beta(df/2, 1/2):
+//
+template <class RealType, class Policy>
+class frozen_distribution<students_t_distribution<RealType, Policy> >
+{
+public:
+   using distribution_type = students_t_distribution<RealType, Policy>;
+   using value_type = RealType;
+   using policy_type = Policy;
+
+   explicit frozen_distribution(const distribution_type& dist)
+      : m_dist(dist), m_use_normal(false), m_norm(0)
+   {
+      BOOST_MATH_STD_USING
+      RealType result;
+      const RealType df = dist.degrees_of_freedom();
+      m_valid = detail::check_df_gt0_to_inf("boost::math::frozen_distribution<students_t_distribution<%1%> >", df, &result, Policy());
+      if(m_valid)
+      {
+         // Same switch over to the normal distribution as the pdf:
+         m_use_normal = df > 1 / policies::get_epsilon<RealType, Policy>();
+         if(!m_use_normal)
+            m_norm = sqrt(df) * boost::math::beta(df / 2, RealType(0.5f), Policy());
+      }
+   }
+
+   const distribution_type& distribution()const { return m_dist; }
+
+   RealType pdf(const RealType& x)const
+   {
+      BOOST_FPU_EXCEPTION_GUARD
+      BOOST_MATH_STD_USING
+      RealType result;
+      if(!m_valid || m_use_normal)
+         return boost::math::pdf(m_dist, x);
+      if(false == detail::check_x_not_NaN(
+         "boost::math::pdf(const students_t_distribution<%1%>&, %1%)", x, &result, Policy()))
+         return result;
+      if((boost::math::isinf)(x))
+         return 0;
+      const RealType df = m_dist.degrees_of_freedom();
+      RealType basem1 = x * x / df;
+      if(basem1 < 0.125)
+      {
+         result = exp(-boost::math::log1p(basem1, Policy()) * (1+df) / 2);
+      }
+      else
+      {
+         result = pow(1 / (1 + basem1), (df + 1) / 2);
+      }
+      result /= m_norm;
+      return result;
+   }
+   RealType logpdf(const RealType& x)const { return boost::math::logpdf(m_dist, x); }
+   RealType cdf(const RealType& x)const { return boost::math::cdf(m_dist, x); }
+   RealType quantile(const RealType& p)const { return boost::math::quantile(m_dist, p); }
+
+private:
+   distribution_type m_dist;
+   bool m_valid;
+   bool m_use_normal;
+   RealType m_norm;
+};
+
+//
+// Non-central chi squared: for large non-centrality the pdf is a series
+// whose leading Poisson weight depends only on the non-centrality:
+//
+template <class RealType, class Policy>
+class frozen_distribution<non_central_chi_squared_distribution<RealType, Policy> >
+{
+   typedef typename policies::evaluation<RealType, Policy>::type eval_type;
+   typedef typename policies::normalise<
+      Policy,
+      policies::promote_float<false>,
+      policies::promote_double<false>,
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+
+public:
+   using distribution_type = non_central_chi_squared_distribution<RealType, Policy>;
+   using value_type = RealType;
+   using policy_type = Policy;
+
+   explicit frozen_distribution(const distribution_type& dist)
+      : m_dist(dist), m_use_series(false), m_weight(0)
+   {
+      static const char* function = "boost::math::frozen_distribution<non_central_chi_squared_distribution<%1%> >";
+      eval_type k = dist.degrees_of_freedom();
+      eval_type l = dist.non_centrality();
+      eval_type r;
+      // Same branch as the pdf, which uses the series for l > 50 only:
+      m_use_series = detail::check_df(function, k, &r, Policy())
+         && detail::check_non_centrality(function, l, &r, Policy())
+         && (l > 50);
+      if(m_use_series)
+         m_weight = detail::non_central_chi_square_pdf_weight(l, forwarding_policy());
+   }
+
+   const distribution_type& distribution()const { return m_dist; }
+
+   RealType pdf(const RealType& x)const
+   {
+      static const char* function = "pdf(non_central_chi_squared_distribution<%1%>, %1%)";
+      if(!m_use_series)
+         return boost::math::pdf(m_dist, x);
+      eval_type r;
+      if(!detail::check_positive_x(function, (eval_type)x, &r, Policy()))
+         return (RealType)r;
+      if(x == 0)
+         return 0;
+      r = detail::non_central_chi_square_pdf(static_cast<eval_type>(x), static_cast<eval_type>(m_dist.degrees_of_freedom()), static_cast<eval_type>(m_dist.non_centrality()), forwarding_policy(), m_weight);
+      return policies::checked_narrowing_cast<RealType, forwarding_policy>(r, function);
+   }
+   RealType logpdf(const RealType& x)const { return boost::math::logpdf(m_dist, x); }
+   RealType cdf(const RealType& x)const { return boost::math::cdf(m_dist, x); }
+   RealType quantile(const RealType& p)const { return boost::math::quantile(m_dist, p); }
+
+private:
+   distribution_type m_dist;
+   bool m_use_series;
+   eval_type m_weight;
+};
+
+template <class Distribution>
+inline frozen_distribution<Distribution> freeze(const Distribution& dist)
+{
+   return frozen_distribution<Distribution>(dist);
+}
+
+//
+// Non-member accessors, these forward to the members above, or for
+// the complements, straight to the wrapped distribution:
+//
+template <class Distribution, class RealType>
+inline typename Distribution::value_type pdf(const frozen_distribution<Distribution>& dist, const RealType& x)
+{
+   return dist.pdf(static_cast<typename Distribution::value_type>(x));
+}
+template <class Distribution, class RealType>
+inline typename Distribution::value_type logpdf(const frozen_distribution<Distribution>& dist, const RealType& x)
+{
+   return dist.logpdf(static_cast<typename Distribution::value_type>(x));
+}
+template <class Distribution, class RealType>
+inline typename Distribution::value_type cdf(const frozen_distribution<Distribution>& dist, const RealType& x)
+{
+   return dist.cdf(static_cast<typename Distribution::value_type>(x));
+}
+template <class Distribution, class RealType>
+inline typename Distribution::value_type quantile(const frozen_distribution<Distribution>& dist, const RealType& p)
+{
+   return dist.quantile(static_cast<typename Distribution::value_type>(p));
+}
+template <class Distribution, class RealType>
+inline typename Distribution::value_type cdf(const complemented2_type<frozen_distribution<Distribution>, RealType>& c)
+{
+   return cdf(complement(c.dist.distribution(), static_cast<typename Distribution::value_type>(c.param)));
+}
+template <class Distribution, class RealType>
+inline typename Distribution::value_type quantile(const complemented2_type<frozen_distribution<Distribution>, RealType>& c)
+{
+   return quantile(complement(c.dist.distribution(), static_cast<typename Distribution::value_type>(c.param)));
+}
+
+}} // namespaces
+
+#endif // BOOST_STATS_FROZEN_HPP
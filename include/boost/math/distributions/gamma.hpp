@@ -15,6 +15,7 @@
 #include <boost/math/special_functions/digamma.hpp>
 #include <boost/math/distributions/detail/common_error_handling.hpp>
 #include <boost/math/distributions/complement.hpp>
+#include <boost/math/distributions/detail/batch_evaluation.hpp>
 
 #include <utility>
 #include <type_traits>
@@ -265,6 +266,59 @@ inline RealType quantile(const complemented2_type<gamma_distribution<RealType, P
    return result;
 }
 
+//
+// Array-at-a-time pdf: the shape and scale are checked once for the whole
+// range, and the shape dependent part of the incomplete gamma prefix is
+// calculated just once rather than for every element.  Zero, non-finite
+// and negative arguments, and those for which x / scale underflows to zero,
+// are passed on to the scalar version:
+//
+template <class RealType, class Policy, class ForwardIterator, class OutputIterator>
+OutputIterator pdf(const gamma_distribution<RealType, Policy>& dist, ForwardIterator first, ForwardIterator last, OutputIterator out)
+{
+   BOOST_FPU_EXCEPTION_GUARD
+   typedef typename policies::evaluation<RealType, Policy>::type eval_type;
+   typedef typename policies::normalise<
+      Policy,
+      policies::promote_float<false>,
+      policies::promote_double<false>,
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+   typedef typename lanczos::lanczos<eval_type, Policy>::type lanczos_type;
+
+   if(first == last)
+      return out;
+
+   static const char* function = "boost::math::pdf(const gamma_distribution<%1%>&, %1%)";
+
+   const RealType shape = dist.shape();
+   const RealType scale = dist.scale();
+   RealType result = 0;
+   if(false == detail::check_gamma(function, scale, shape, &result, Policy()))
+      return detail::distribution_batch_fill(first, last, out, result);
+
+   const eval_type a = static_cast<eval_type>(shape);
+   const eval_type a_term = detail::regularised_gamma_prefix_a_term(a, forwarding_policy(), lanczos_type());
+
+   return detail::distribution_batch<RealType>(first, last, out,
+      [&](const RealType* x, RealType* r, std::size_t n)
+      {
+         for(std::size_t i = 0; i < n; ++i)
+         {
+            const eval_type z = static_cast<eval_type>(x[i] / scale);
+            if((x[i] > 0) && (boost::math::isfinite)(x[i]) && (z != 0))
+            {
+               // As gamma_p_derivative(shape, x / scale, Policy()) for z > 0:
+               eval_type f1 = detail::gamma_p_derivative_imp(a, z, forwarding_policy(),
+                  detail::regularised_gamma_prefix(a, z, forwarding_policy(), lanczos_type(), a_term));
+               r[i] = policies::checked_narrowing_cast<RealType, forwarding_policy>(f1, "boost::math::gamma_p_derivative<%1%>(%1%, %1%)") / scale;
+            }
+            else
+               r[i] = pdf(dist, x[i]);
+         }
+      });
+} // pdf
+
 template <class RealType, class Policy>
 inline RealType mean(const gamma_distribution<RealType, Policy>& dist)
 {
@@ -0,0 +1,234 @@
+//  Copyright Boost.Math contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_STATS_INVERSE_CDF_TABLE_HPP
+#define BOOST_STATS_INVERSE_CDF_TABLE_HPP
+
+// inverse_cdf_table<Distribution> approximates the quantile of a continuous
+// distribution with fixed parameters, for example when generating random
+// variates by inversion.  The quantile is tabulated at construction as a
+// piecewise cubic Hermite interpolant in u, with the knots placed adaptively
+// until the "u-error" |cdf(x(u)) - u| at the centre of each interval is
+// below the requested tolerance, see:
+//
+// W. Hormann and J. Leydold, "Continuous random variate generation by fast
+// numerical inversion", ACM TOMACS 13(4), 2003.
+//
+// A guide table indexed by u then locates the interval containing a given
+// probability in constant expected time.  Probabilities in the extreme
+// tails, outside the tabulated range, are passed on to quantile(dist, u).
+
+#include <boost/math/distributions/complement.hpp>
+#include <boost/math/distributions/detail/common_error_handling.hpp>
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <boost/math/tools/precision.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace boost{ namespace math{
+
+template <class Distribution>
+class inverse_cdf_table
+{
+public:
+   using distribution_type = Distribution;
+   using value_type = typename Distribution::value_type;
+   using policy_type = typename Distribution::policy_type;
+
+   //
+   // u_tolerance is the largest acceptable |cdf(x) - u| for the
+   // interpolated quantile x, and tail the probability in each tail
+   // which is left to the distribution's own quantile.  Zero gives the
+   // defaults: a tolerance of 1e-10 (or 64 epsilon for low precision
+   // types) and a tail equal to the tolerance.
+   //
+   explicit inverse_cdf_table(const Distribution& dist, value_type u_tolerance = 0, value_type tail = 0)
+      : m_dist(dist)
+   {
+      if(u_tolerance <= 0)
+         u_tolerance = (std::max)(value_type(1e-10f), 64 * tools::epsilon<value_type>());
+      if(tail <= 0)
+         tail = u_tolerance;
+      m_tolerance = u_tolerance;
+      m_u_lo = tail;
+      m_u_hi = 1 - tail;
+      build();
+   }
+
+   //
+   // The interpolated quantile at u:
+   //
+   value_type operator()(value_type u)const
+   {
+      if(!((u >= m_u_lo) && (u <= m_u_hi)))
+         return quantile(m_dist, u);  // tails, and domain errors for u outside [0,1]
+      std::size_t j = static_cast<std::size_t>((u - m_u_lo) * m_guide_scale);
+      std::size_t i = m_guide[(std::min)(j, m_guide.size() - 1)];
+      while((i + 2 < m_u.size()) && (u > m_u[i + 1]))
+         ++i;
+      return interpolate(i, u);
+   }
+
+   //
+   // As above, followed by a single Newton step on cdf(x) = u, which
+   // roughly squares the relative error at the cost of evaluating the
+   // cdf and pdf once each:
+   //
+   value_type polished(value_type u)const
+   {
+      value_type x = (*this)(u);
+      if(!((u >= m_u_lo) && (u <= m_u_hi)))
+         return x;
+      value_type d = pdf(m_dist, x);
+      if(!(d > 0))
+         return x;
+      // cdf(x) - u, avoiding cancellation in the upper half by working with the complement:
+      value_type r = u < 0.5f ? value_type(cdf(m_dist, x) - u) : value_type((1 - u) - cdf(complement(m_dist, x)));
+      value_type result = x - r / d;
+      return (boost::math::isfinite)(result) ? result : x;
+   }
+
+   const Distribution& distribution()const { return m_dist; }
+   value_type tolerance()const { return m_tolerance; }
+   // The range of probabilities which are interpolated:
+   std::pair<value_type, value_type> table_range()const { return std::pair<value_type, value_type>(m_u_lo, m_u_hi); }
+   // The number of intervals in the table:
+   std::size_t size()const { return m_u.size() - 1; }
+
+private:
+   struct knot
+   {
+      value_type u, x, dx;
+   };
+
+   knot make_knot(value_type u)const
+   {
+      knot k;
+      k.u = u;
+      k.x = quantile(m_dist, u);
+      // dx/du = 1 / pdf, which may not be representable very close to
+      // the edge of the support, in which case a flat slope is used and
+      // the adaptive refinement takes care of the rest:
+      k.dx = 1 / pdf(m_dist, k.x);
+      if(!(boost::math::isfinite)(k.dx))
+         k.dx = 0;
+      return k;
+   }
+
+   static value_type hermite(const knot& k0, const knot& k1, value_type u)
+   {
+      value_type h = k1.u - k0.u;
+      value_type t = (u - k0.u) / h;
+      value_type t2 = t * t;
+      value_type t3 = t2 * t;
+      value_type h00 = 2 * t3 - 3 * t2 + 1;
+      value_type h10 = t3 - 2 * t2 + t;
+      value_type h01 = 3 * t2 - 2 * t3;
+      value_type h11 = t3 - t2;
+      return h00 * k0.x + h10 * h * k0.dx + h01 * k1.x + h11 * h * k1.dx;
+   }
+
+   value_type interpolate(std::size_t i, value_type u)const
+   {
+      knot k0 = { m_u[i], m_x[i], m_dx[i] };
+      knot k1 = { m_u[i + 1], m_x[i + 1], m_dx[i + 1] };
+      return hermite(k0, k1, u);
+   }
+
+   bool accurate(const knot& k0, const knot& k1)const
+   {
+      BOOST_MATH_STD_USING
+      value_type u = (k0.u + k1.u) / 2;
+      value_type x = hermite(k0, k1, u);
+      if(!(boost::math::isfinite)(x) || (x < k0.x) || (x > k1.x))
+         return false;
+      value_type err = u < 0.5f ? value_type(cdf(m_dist, x) - u) : value_type((1 - u) - cdf(complement(m_dist, x)));
+      return fabs(err) <= m_tolerance;
+   }
+
+   void build()
+   {
+      BOOST_MATH_STD_USING
+      static const char* function = "boost::math::inverse_cdf_table<%1%>::inverse_cdf_table";
+      const std::size_t initial_intervals = 32;
+      // Safety net for distributions which can not meet the tolerance:
+      const std::size_t max_intervals = 1u << 20;
+      const value_type min_width = 64 * tools::epsilon<value_type>();
+
+      std::vector<knot> knots;
+      knot left = make_knot(m_u_lo);
+      knots.push_back(left);
+      std::vector<knot> stack;
+      for(std::size_t n = 1; n <= initial_intervals; ++n)
+      {
+         value_type u = n == initial_intervals ? m_u_hi : value_type(m_u_lo + (m_u_hi - m_u_lo) * n / initial_intervals);
+         stack.push_back(make_knot(u));
+         //
+         // Depth first refinement, the stack holds the right hand ends of
+         // the intervals still to be checked, so knots come out in order:
+         //
+         while(!stack.empty())
+         {
+            const knot& right = stack.back();
+            if((knots.size() >= max_intervals) || (right.u - left.u <= min_width * right.u) || accurate(left, right))
+            {
+               left = right;
+               knots.push_back(right);
+               stack.pop_back();
+            }
+            else
+            {
+               stack.push_back(make_knot((left.u + right.u) / 2));
+            }
+         }
+      }
+      if(knots.size() >= max_intervals)
+      {
+         policies::raise_evaluation_error<value_type>(function, "Unable to tabulate the quantile to the requested tolerance, the table is only accurate to approximately %1%", m_tolerance, policy_type());
+      }
+
+      m_u.resize(knots.size());
+      m_x.resize(knots.size());
+      m_dx.resize(knots.size());
+      for(std::size_t i = 0; i < knots.size(); ++i)
+      {
+         m_u[i] = knots[i].u;
+         m_x[i] = knots[i].x;
+         m_dx[i] = knots[i].dx;
+      }
+      //
+      // Guide table: m_guide[j] is the interval containing the start of
+      // the j'th of size() equal width cells spanning [m_u_lo, m_u_hi]:
+      //
+      std::size_t cells = size();
+      m_guide.resize(cells);
+      m_guide_scale = cells / (m_u_hi - m_u_lo);
+      std::size_t i = 0;
+      for(std::size_t j = 0; j < cells; ++j)
+      {
+         value_type u = m_u_lo + j / m_guide_scale;
+         while((i + 2 < m_u.size()) && (u >= m_u[i + 1]))
+            ++i;
+         m_guide[j] = i;
+      }
+   }
+
+   Distribution m_dist;
+   value_type m_tolerance;
+   value_type m_u_lo;
+   value_type m_u_hi;
+   value_type m_guide_scale;
+   std::vector<value_type> m_u;
+   std::vector<value_type> m_x;
+   std::vector<value_type> m_dx;
+   std::vector<std::size_t> m_guide;
+};
+
+}} // namespaces
+
+#endif // BOOST_STATS_INVERSE_CDF_TABLE_HPP
@@ -281,8 +281,21 @@ namespace boost
             return sum;
          }
 
+         //
+         // The Poisson weight at the start of the series in the PDF below,
+         // this depends only on the non-centrality parameter:
+         //
          template <class T, class Policy>
-         T non_central_chi_square_pdf(T x, T n, T lambda, const Policy& pol)
+         inline T non_central_chi_square_pdf_weight(T lambda, const Policy& pol)
+         {
+            BOOST_MATH_STD_USING
+            T l2 = lambda / 2;
+            long long k = lltrunc(l2);
+            return gamma_p_derivative(static_cast<T>(k + 1), l2, pol);
+         }
+
+         template <class T, class Policy>
+         T non_central_chi_square_pdf(T x, T n, T lambda, const Policy& pol, T weight)
          {
             //
             // As above but for the PDF:
@@ -295,7 +308,7 @@ namespace boost
             T l2 = lambda / 2;
             T sum = 0;
             long long k = lltrunc(l2);
-            T pois = gamma_p_derivative(static_cast<T>(k + 1), l2, pol) * gamma_p_derivative(static_cast<T>(n2 + k), x2);
+            T pois = weight * gamma_p_derivative(static_cast<T>(n2 + k), x2);
             if(pois == 0)
                return 0;
             T poisb = pois;
@@ -320,6 +333,12 @@ namespace boost
             return sum / 2;
          }
 
+         template <class T, class Policy>
+         inline T non_central_chi_square_pdf(T x, T n, T lambda, const Policy& pol)
+         {
+            return non_central_chi_square_pdf(x, n, lambda, pol, non_central_chi_square_pdf_weight(lambda, pol));
+         }
+
          template <class RealType, class Policy>
          inline RealType non_central_chi_squared_cdf(RealType x, RealType k, RealType l, bool invert, const Policy&)
          {
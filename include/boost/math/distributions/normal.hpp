@@ -19,6 +19,7 @@
 #include <boost/math/special_functions/erf.hpp> // for erf/erfc.
 #include <boost/math/distributions/complement.hpp>
 #include <boost/math/distributions/detail/common_error_handling.hpp>
+#include <boost/math/distributions/detail/batch_evaluation.hpp>
 
 #include <utility>
 #include <type_traits>
@@ -302,6 +303,132 @@ inline RealType quantile(const complemented2_type<normal_distribution<RealType,
    return result;
 } // quantile
 
+//
+// Array-at-a-time versions: the scale and location are checked once
+// for the whole range, and the per-element work is a straight loop
+// over a block of arguments.  Non-finite arguments are rare, so rather
+// than complicate the kernels, those elements are simply recomputed
+// with the scalar functions which know how to handle them.  Results
+// are identical to those of the scalar functions.
+//
+template <class RealType, class Policy, class ForwardIterator, class OutputIterator>
+OutputIterator pdf(const normal_distribution<RealType, Policy>& dist, ForwardIterator first, ForwardIterator last, OutputIterator out)
+{
+   BOOST_MATH_STD_USING  // for ADL of std functions
+
+   if(first == last)
+      return out;
+
+   const RealType sd = dist.standard_deviation();
+   const RealType mean = dist.mean();
+   static const char* function = "boost::math::pdf(const normal_distribution<%1%>&, %1%)";
+
+   RealType result = 0;
+   if((false == detail::check_scale(function, sd, &result, Policy()))
+      || (false == detail::check_location(function, mean, &result, Policy())))
+   {
+      return detail::distribution_batch_fill(first, last, out, result);
+   }
+
+   const RealType denom = 2 * sd * sd;
+   const RealType norm = sd * sqrt(2 * constants::pi<RealType>());
+
+   return detail::distribution_batch<RealType>(first, last, out,
+      [&](const RealType* x, RealType* r, std::size_t n)
+      {
+         for(std::size_t i = 0; i < n; ++i)
+         {
+            RealType exponent = x[i] - mean;
+            exponent *= -exponent;
+            exponent /= denom;
+            r[i] = exp(exponent) / norm;
+         }
+         for(std::size_t i = 0; i < n; ++i)
+         {
+            if(!(boost::math::isfinite)(x[i]))
+               r[i] = pdf(dist, x[i]);
+         }
+      });
+} // pdf
+
+template <class RealType, class Policy, class ForwardIterator, class OutputIterator>
+OutputIterator cdf(const normal_distribution<RealType, Policy>& dist, ForwardIterator first, ForwardIterator last, OutputIterator out)
+{
+   BOOST_MATH_STD_USING  // for ADL of std functions
+
+   if(first == last)
+      return out;
+
+   const RealType sd = dist.standard_deviation();
+   const RealType mean = dist.mean();
+   static const char* function = "boost::math::cdf(const normal_distribution<%1%>&, %1%)";
+
+   RealType result = 0;
+   if((false == detail::check_scale(function, sd, &result, Policy()))
+      || (false == detail::check_location(function, mean, &result, Policy())))
+   {
+      return detail::distribution_batch_fill(first, last, out, result);
+   }
+
+   const RealType scale = sd * constants::root_two<RealType>();
+
+   return detail::distribution_batch<RealType>(first, last, out,
+      [&](const RealType* x, RealType* r, std::size_t n)
+      {
+         RealType diff[detail::distribution_batch_block_size];
+         for(std::size_t i = 0; i < n; ++i)
+         {
+            // Non-finite values are patched up below, keep them away from erfc:
+            diff[i] = (boost::math::isfinite)(x[i]) ? RealType(-((x[i] - mean) / scale)) : RealType(0);
+         }
+         boost::math::erfc(diff, diff + n, r, Policy());
+         for(std::size_t i = 0; i < n; ++i)
+         {
+            r[i] /= 2;
+         }
+         for(std::size_t i = 0; i < n; ++i)
+         {
+            if(!(boost::math::isfinite)(x[i]))
+               r[i] = cdf(dist, x[i]);
+         }
+      });
+} // cdf
+
+template <class RealType, class Policy, class ForwardIterator, class OutputIterator>
+OutputIterator quantile(const normal_distribution<RealType, Policy>& dist, ForwardIterator first, ForwardIterator last, OutputIterator out)
+{
+   BOOST_MATH_STD_USING  // for ADL of std functions
+
+   if(first == last)
+      return out;
+
+   const RealType sd = dist.standard_deviation();
+   const RealType mean = dist.mean();
+   static const char* function = "boost::math::quantile(const normal_distribution<%1%>&, %1%)";
+
+   RealType result = 0;
+   if((false == detail::check_scale(function, sd, &result, Policy()))
+      || (false == detail::check_location(function, mean, &result, Policy())))
+   {
+      return detail::distribution_batch_fill(first, last, out, result);
+   }
+
+   const RealType scale = sd * constants::root_two<RealType>();
+
+   return detail::distribution_batch<RealType>(first, last, out,
+      [&](const RealType* p, RealType* r, std::size_t n)
+      {
+         for(std::size_t i = 0; i < n; ++i)
+         {
+            if(false == detail::check_probability(function, p[i], &r[i], Policy()))
+               continue;
+            r[i] = -boost::math::erfc_inv(2 * p[i], Policy());
+            r[i] *= scale;
+            r[i] += mean;
+         }
+      });
+} // quantile
+
 template <class RealType, class Policy>
 inline RealType mean(const normal_distribution<RealType, Policy>& dist)
 {
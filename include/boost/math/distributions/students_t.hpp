@@ -17,6 +17,7 @@
 #include <boost/math/special_functions/digamma.hpp>
 #include <boost/math/distributions/complement.hpp>
 #include <boost/math/distributions/detail/common_error_handling.hpp>
+#include <boost/math/distributions/detail/batch_evaluation.hpp>
 #include <boost/math/distributions/normal.hpp> 
 
 #include <utility>
@@ -274,6 +275,54 @@ inline RealType quantile(const complemented2_type<students_t_distribution<RealTy
    return -quantile(c.dist, c.param);
 }
 
+//
+// Array-at-a-time pdf: the degrees of freedom are checked once for the
+// whole range, and the normalising sqrt(df) * beta(df/2, 1/2) is calculated
+// just once.  Non-finite arguments, and every argument when df is so large
+// that the normal distribution is used, are passed on to the scalar version:
+//
+template <class RealType, class Policy, class ForwardIterator, class OutputIterator>
+OutputIterator pdf(const students_t_distribution<RealType, Policy>& dist, ForwardIterator first, ForwardIterator last, OutputIterator out)
+{
+   BOOST_FPU_EXCEPTION_GUARD
+   BOOST_MATH_STD_USING  // for ADL of std functions.
+
+   if(first == last)
+      return out;
+
+   const RealType df = dist.degrees_of_freedom();
+   RealType result;
+   if(false == detail::check_df_gt0_to_inf(
+      "boost::math::pdf(const students_t_distribution<%1%>&, %1%)", df, &result, Policy()))
+      return detail::distribution_batch_fill(first, last, out, result);
+
+   const bool use_normal = df > 1 / policies::get_epsilon<RealType, Policy>();
+   const RealType norm = use_normal ? RealType(0) : RealType(sqrt(df) * boost::math::beta(df / 2, RealType(0.5f), Policy()));
+
+   return detail::distribution_batch<RealType>(first, last, out,
+      [&](const RealType* x, RealType* r, std::size_t n)
+      {
+         for(std::size_t i = 0; i < n; ++i)
+         {
+            if(use_normal || !(boost::math::isfinite)(x[i]))
+            {
+               r[i] = pdf(dist, x[i]);
+               continue;
+            }
+            RealType basem1 = x[i] * x[i] / df;
+            if(basem1 < 0.125)
+            {
+               r[i] = exp(-boost::math::log1p(basem1, Policy()) * (1+df) / 2);
+            }
+            else
+            {
+               r[i] = pow(1 / (1 + basem1), (df + 1) / 2);
+            }
+            r[i] /= norm;
+         }
+      });
+} // pdf
+
 //
 // Parameter estimation follows:
 //
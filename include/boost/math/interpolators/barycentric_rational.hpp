@@ -27,7 +27,14 @@
 #define BOOST_MATH_INTERPOLATORS_BARYCENTRIC_RATIONAL_HPP
 
 #include <memory>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
 #include <boost/math/interpolators/detail/barycentric_rational_detail.hpp>
+#include <boost/math/tools/config.hpp>
+#ifdef BOOST_HAS_THREADS
+#include <boost/math/statistics/detail/executor.hpp>
+#endif
 
 namespace boost{ namespace math{ namespace interpolators{
 
@@ -42,8 +49,28 @@ public:
     template <class InputIterator1, class InputIterator2>
     barycentric_rational(InputIterator1 start_x, InputIterator1 end_x, InputIterator2 start_y, size_t approximation_order = 3, typename std::enable_if<!std::is_integral<InputIterator2>::value>::type* = nullptr);
 
+#ifdef BOOST_HAS_THREADS
+    // Computes the weights on an executor such as boost::math::tools::thread_pool:
+    template <class Executor, typename std::enable_if<boost::math::statistics::detail::is_executor<Executor>::value, bool>::type = true>
+    barycentric_rational(Executor&& exec, std::vector<Real>&& x, std::vector<Real>&& y, size_t approximation_order = 3);
+#endif
+
+    // Appends a point to the right of the others, recomputing only the weights which depend on it:
+    void push_back(Real x, Real y);
+
     Real operator()(Real x) const;
 
+    // Evaluates at each abscissa in [first, last), reusing each node for a block of abscissas:
+    template<class InputIterator, class OutputIterator>
+    OutputIterator operator()(InputIterator first, InputIterator last, OutputIterator out) const;
+
+#ifdef BOOST_HAS_THREADS
+    // As above, but the abscissas are split between the tasks of an executor such as boost::math::tools::thread_pool:
+    template<class Executor, class RandomAccessIterator1, class RandomAccessIterator2>
+    auto operator()(Executor&& exec, RandomAccessIterator1 first, RandomAccessIterator1 last, RandomAccessIterator2 out) const
+       -> typename std::enable_if<boost::math::statistics::detail::is_executor<Executor>::value, RandomAccessIterator2>::type;
+#endif
+
     Real prime(Real x) const;
 
     std::vector<Real>&& return_x()
@@ -82,12 +109,61 @@ barycentric_rational<Real>::barycentric_rational(InputIterator1 start_x, InputIt
 {
 }
 
+#ifdef BOOST_HAS_THREADS
+template <class Real>
+template <class Executor, typename std::enable_if<boost::math::statistics::detail::is_executor<Executor>::value, bool>::type>
+barycentric_rational<Real>::barycentric_rational(Executor&& exec, std::vector<Real>&& x, std::vector<Real>&& y, size_t approximation_order)
+ : m_imp(std::make_shared<detail::barycentric_rational_imp<Real>>(exec, std::move(x), std::move(y), approximation_order))
+{
+}
+#endif
+
+template<class Real>
+void barycentric_rational<Real>::push_back(Real x, Real y)
+{
+    m_imp->push_back(x, y);
+}
+
 template<class Real>
 Real barycentric_rational<Real>::operator()(Real x) const
 {
     return m_imp->operator()(x);
 }
 
+template<class Real>
+template<class InputIterator, class OutputIterator>
+OutputIterator barycentric_rational<Real>::operator()(InputIterator first, InputIterator last, OutputIterator out) const
+{
+    return m_imp->operator()(first, last, out);
+}
+
+#ifdef BOOST_HAS_THREADS
+template<class Real>
+template<class Executor, class RandomAccessIterator1, class RandomAccessIterator2>
+auto barycentric_rational<Real>::operator()(Executor&& exec, RandomAccessIterator1 first, RandomAccessIterator1 last, RandomAccessIterator2 out) const
+   -> typename std::enable_if<boost::math::statistics::detail::is_executor<Executor>::value, RandomAccessIterator2>::type
+{
+    using boost::math::statistics::detail::parallel_chunk_count;
+    using boost::math::statistics::detail::task_launch_cost;
+    const std::size_t n = static_cast<std::size_t>(std::distance(first, last));
+    // Each abscissa costs roughly a nanosecond per node:
+    const unsigned chunks = parallel_chunk_count(n, exec.concurrency(), static_cast<double>(m_imp->size()), task_launch_cost(exec));
+    if (chunks < 2)
+    {
+        return m_imp->operator()(first, last, out);
+    }
+    const std::size_t chunk_length = (n + chunks - 1)/chunks;
+    const auto& imp = *m_imp;
+    exec.bulk_execute(chunks, [&](std::size_t i)
+    {
+        const std::size_t begin = (std::min)(i*chunk_length, n);
+        const std::size_t end = (std::min)(begin + chunk_length, n);
+        imp(first + static_cast<std::ptrdiff_t>(begin), first + static_cast<std::ptrdiff_t>(end), out + static_cast<std::ptrdiff_t>(begin));
+    });
+    return out + static_cast<std::ptrdiff_t>(n);
+}
+#endif
+
 template<class Real>
 Real barycentric_rational<Real>::prime(Real x) const
 {
@@ -22,6 +22,9 @@
 #ifndef BOOST_MATH_INTERPOLATORS_CARDINAL_CUBIC_B_SPLINE_HPP
 #define BOOST_MATH_INTERPOLATORS_CARDINAL_CUBIC_B_SPLINE_HPP
 
+#include <type_traits>
+#include <utility>
+#include <vector>
 #include <boost/math/interpolators/detail/cardinal_cubic_b_spline_detail.hpp>
 
 namespace boost{ namespace math{ namespace interpolators {
@@ -39,6 +42,17 @@ public:
     cardinal_cubic_b_spline(const Real* const f, size_t length, Real left_endpoint, Real step_size,
        Real left_endpoint_derivative = std::numeric_limits<Real>::quiet_NaN(),
        Real right_endpoint_derivative = std::numeric_limits<Real>::quiet_NaN());
+    // The coefficients overwrite the samples, so if f has capacity for f.size() + 2 no more memory is allocated:
+    cardinal_cubic_b_spline(std::vector<Real>&& f, Real left_endpoint, Real step_size,
+       Real left_endpoint_derivative = std::numeric_limits<Real>::quiet_NaN(),
+       Real right_endpoint_derivative = std::numeric_limits<Real>::quiet_NaN());
+#ifdef BOOST_HAS_THREADS
+    // As above, with the linear system solved in blocks by the tasks of exec:
+    template <class Executor, typename std::enable_if<boost::math::statistics::detail::is_executor<Executor>::value, bool>::type = true>
+    cardinal_cubic_b_spline(Executor&& exec, std::vector<Real>&& f, Real left_endpoint, Real step_size,
+       Real left_endpoint_derivative = std::numeric_limits<Real>::quiet_NaN(),
+       Real right_endpoint_derivative = std::numeric_limits<Real>::quiet_NaN());
+#endif
 
     cardinal_cubic_b_spline() = default;
     Real operator()(Real x) const;
@@ -64,6 +78,21 @@ cardinal_cubic_b_spline<Real>::cardinal_cubic_b_spline(BidiIterator f, BidiItera
 {
 }
 
+template <class Real>
+cardinal_cubic_b_spline<Real>::cardinal_cubic_b_spline(std::vector<Real>&& f, Real left_endpoint, Real step_size,
+   Real left_endpoint_derivative, Real right_endpoint_derivative) : m_imp(std::make_shared<detail::cardinal_cubic_b_spline_imp<Real>>(std::move(f), left_endpoint, step_size, left_endpoint_derivative, right_endpoint_derivative))
+{
+}
+
+#ifdef BOOST_HAS_THREADS
+template <class Real>
+template <class Executor, typename std::enable_if<boost::math::statistics::detail::is_executor<Executor>::value, bool>::type>
+cardinal_cubic_b_spline<Real>::cardinal_cubic_b_spline(Executor&& exec, std::vector<Real>&& f, Real left_endpoint, Real step_size,
+   Real left_endpoint_derivative, Real right_endpoint_derivative) : m_imp(std::make_shared<detail::cardinal_cubic_b_spline_imp<Real>>(exec, std::move(f), left_endpoint, step_size, left_endpoint_derivative, right_endpoint_derivative))
+{
+}
+#endif
+
 template<class Real>
 Real cardinal_cubic_b_spline<Real>::operator()(Real x) const
 {
@@ -6,8 +6,10 @@
 
 #ifndef BOOST_MATH_INTERPOLATORS_CUBIC_HERMITE_HPP
 #define BOOST_MATH_INTERPOLATORS_CUBIC_HERMITE_HPP
+#include <array>
 #include <memory>
 #include <boost/math/interpolators/detail/cubic_hermite_detail.hpp>
+#include <boost/math/interpolators/detail/hermite_segments_detail.hpp>
 
 namespace boost {
 namespace math {
@@ -30,6 +32,17 @@ public:
         return impl_->prime(x);
     }
 
+    // Evaluates at each abscissa in [first, last), which is fastest when they are sorted:
+    template<class InputIterator, class OutputIterator>
+    inline OutputIterator operator()(InputIterator first, InputIterator last, OutputIterator out) const {
+        return impl_->operator()(first, last, out);
+    }
+
+    template<class InputIterator, class OutputIterator>
+    inline OutputIterator prime(InputIterator first, InputIterator last, OutputIterator out) const {
+        return impl_->prime(first, last, out);
+    }
+
     friend std::ostream& operator<<(std::ostream & os, const cubic_hermite & m)
     {
         os << *m.impl_;
@@ -55,6 +68,66 @@ private:
     std::shared_ptr<detail::cubic_hermite_detail<RandomAccessContainer>> impl_;
 };
 
+//
+// The same interpolant, stored as the coefficients of a polynomial for each interval, which takes more
+// memory, but reads the coefficients of an interval from a single cache line rather than one from each array:
+//
+template<class RandomAccessContainer>
+class cubic_hermite_segments {
+public:
+    using Real = typename RandomAccessContainer::value_type;
+
+    cubic_hermite_segments(RandomAccessContainer && x, RandomAccessContainer && y, RandomAccessContainer && dydx)
+     : impl_(std::make_shared<detail::hermite_segments_detail<Real, 1>>(x, std::array<const RandomAccessContainer*, 2>{{&y, &dydx}}))
+    {}
+
+    Real operator()(Real x) const
+    {
+        return impl_->operator()(x);
+    }
+
+    Real prime(Real x) const
+    {
+        return impl_->prime(x);
+    }
+
+    template<class InputIterator, class OutputIterator>
+    OutputIterator operator()(InputIterator first, InputIterator last, OutputIterator out) const
+    {
+        return impl_->operator()(first, last, out);
+    }
+
+    template<class InputIterator, class OutputIterator>
+    OutputIterator prime(InputIterator first, InputIterator last, OutputIterator out) const
+    {
+        return impl_->prime(first, last, out);
+    }
+
+    friend std::ostream& operator<<(std::ostream & os, const cubic_hermite_segments & m)
+    {
+        os << *m.impl_;
+        return os;
+    }
+
+    void push_back(Real x, Real y, Real dydx)
+    {
+        impl_->push_back(x, {{y, dydx}});
+    }
+
+    int64_t bytes() const
+    {
+        return impl_->bytes() + sizeof(impl_);
+    }
+
+    std::pair<Real, Real> domain() const
+    {
+        return impl_->domain();
+    }
+
+private:
+    std::shared_ptr<detail::hermite_segments_detail<Real, 1>> impl_;
+};
+
 template<class RandomAccessContainer>
 class cardinal_cubic_hermite {
 public:
@@ -12,8 +12,14 @@
 #include <utility> // for std::move
 #include <algorithm> // for std::is_sorted
 #include <string>
+#include <cstddef>
+#include <iterator>
 #include <boost/math/special_functions/fpclassify.hpp>
 #include <boost/math/tools/assert.hpp>
+#include <boost/math/tools/config.hpp>
+#ifdef BOOST_HAS_THREADS
+#include <boost/math/statistics/detail/executor.hpp>
+#endif
 
 namespace boost{ namespace math{ namespace interpolators { namespace detail{
 
@@ -26,8 +32,20 @@ public:
 
     barycentric_rational_imp(std::vector<Real>&& x, std::vector<Real>&& y, size_t approximation_order = 3);
 
+#ifdef BOOST_HAS_THREADS
+    // Computes the weights in chunks on an executor such as boost::math::tools::thread_pool:
+    template<class Executor>
+    barycentric_rational_imp(Executor& exec, std::vector<Real>&& x, std::vector<Real>&& y, size_t approximation_order = 3);
+#endif
+
+    // Appends a node, which must lie to the right of the others, updating the weights which depend on it:
+    void push_back(Real x, Real y);
+
     Real operator()(Real x) const;
 
+    template<class InputIterator, class OutputIterator>
+    OutputIterator operator()(InputIterator first, InputIterator last, OutputIterator out) const;
+
     Real prime(Real x) const;
 
     // The barycentric weights are not really that interesting; except to the unit tests!
@@ -43,13 +61,33 @@ public:
         return std::move(m_y);
     }
 
+    std::size_t size() const { return m_x.size(); }
+
 private:
 
     void calculate_weights(size_t approximation_order);
 
+#ifdef BOOST_HAS_THREADS
+    template<class Executor>
+    void calculate_weights(Executor& exec, size_t approximation_order);
+#endif
+
+    // Computes the weights of the nodes in [first, last):
+    void calculate_weight_range(std::size_t first, std::size_t last);
+
+    void accumulate(const Real* x, Real* numerator, Real* denominator, std::size_t first_node, std::size_t last_node) const;
+
+    // The number of abscissas whose sums are accumulated together, which the compiler can vectorize:
+    static constexpr std::size_t block_size = 8;
+    // The number of abscissas whose sums are kept in L1 cache while sweeping over the nodes:
+    static constexpr std::size_t chunk_size = 256;
+    // The number of nodes reused by each block of a chunk, which also stay in L1 cache:
+    static constexpr std::size_t tile_size = 512;
+
     std::vector<Real> m_x;
     std::vector<Real> m_y;
     std::vector<Real> m_w;
+    size_t m_approximation_order;
 };
 
 template <class Real>
@@ -96,14 +134,63 @@ barycentric_rational_imp<Real>::barycentric_rational_imp(std::vector<Real>&& x,
     calculate_weights(approximation_order);
 }
 
+#ifdef BOOST_HAS_THREADS
+template <class Real>
+template <class Executor>
+barycentric_rational_imp<Real>::barycentric_rational_imp(Executor& exec, std::vector<Real>&& x, std::vector<Real>&& y, size_t approximation_order) : m_x(std::move(x)), m_y(std::move(y))
+{
+    BOOST_MATH_ASSERT_MSG(m_x.size() == m_y.size(), "There must be the same number of abscissas and ordinates.");
+    BOOST_MATH_ASSERT_MSG(approximation_order < m_x.size(), "Approximation order must be < data length.");
+    BOOST_MATH_ASSERT_MSG(std::is_sorted(m_x.begin(), m_x.end()), "The abscissas must be listed in increasing order x[0] < x[1] < ... < x[n-1].");
+    calculate_weights(exec, approximation_order);
+}
+#endif
+
 template<class Real>
 void barycentric_rational_imp<Real>::calculate_weights(size_t approximation_order)
+{
+    m_approximation_order = approximation_order;
+    m_w.resize(m_x.size());
+    calculate_weight_range(0, m_x.size());
+}
+
+#ifdef BOOST_HAS_THREADS
+// The weights are independent of one another, so are computed in contiguous chunks by the tasks of the executor:
+template<class Real>
+template<class Executor>
+void barycentric_rational_imp<Real>::calculate_weights(Executor& exec, size_t approximation_order)
+{
+    using boost::math::statistics::detail::parallel_chunk_count;
+    using boost::math::statistics::detail::task_launch_cost;
+    m_approximation_order = approximation_order;
+    const std::size_t n = m_x.size();
+    m_w.resize(n);
+    // Each weight costs a few nanoseconds for each of the (d+1)^2 factors:
+    const double ns_per_weight = 2.0*static_cast<double>((approximation_order + 1)*(approximation_order + 1));
+    const unsigned chunks = parallel_chunk_count(n, exec.concurrency(), ns_per_weight, task_launch_cost(exec));
+    if (chunks < 2)
+    {
+        calculate_weight_range(0, n);
+        return;
+    }
+    const std::size_t chunk_length = (n + chunks - 1)/chunks;
+    exec.bulk_execute(chunks, [&](std::size_t i)
+    {
+        const std::size_t first = (std::min)(i*chunk_length, n);
+        calculate_weight_range(first, (std::min)(first + chunk_length, n));
+    });
+}
+#endif
+
+template<class Real>
+void barycentric_rational_imp<Real>::calculate_weight_range(std::size_t first, std::size_t last)
 {
     using std::abs;
+    const size_t approximation_order = m_approximation_order;
     int64_t n = m_x.size();
-    m_w.resize(n, 0);
-    for(int64_t k = 0; k < n; ++k)
+    for(int64_t k = static_cast<int64_t>(first); k < static_cast<int64_t>(last); ++k)
     {
+        Real w = 0;
         int64_t i_min = (std::max)(k - static_cast<int64_t>(approximation_order), static_cast<int64_t>(0));
         int64_t i_max = k;
         if (k >= n - (std::ptrdiff_t)approximation_order)
@@ -137,16 +224,39 @@ void barycentric_rational_imp<Real>::calculate_weights(size_t approximation_orde
             }
             if (i % 2 == 0)
             {
-                m_w[k] += 1/inv_product;
+                w += 1/inv_product;
             }
             else
             {
-                m_w[k] -= 1/inv_product;
+                w -= 1/inv_product;
             }
         }
+        m_w[k] = w;
     }
 }
 
+//
+// Appending a node changes the upper limit of the sum only for the weights of the last
+// approximation_order + 1 nodes, so only those are recomputed, and the weights are the
+// same as if the interpolant had been constructed with all the nodes:
+//
+template<class Real>
+void barycentric_rational_imp<Real>::push_back(Real x, Real y)
+{
+    if (boost::math::isnan(x) || boost::math::isnan(y))
+    {
+        throw std::domain_error("The abscissa and ordinate of a new point must not be NaN.");
+    }
+    if (x <= m_x.back())
+    {
+        throw std::domain_error("Calling push_back must preserve the monotonicity of the x's");
+    }
+    m_x.push_back(x);
+    m_y.push_back(y);
+    m_w.push_back(0);
+    const std::size_t n = m_x.size();
+    calculate_weight_range(n - (std::min)(n, m_approximation_order + 1), n);
+}
 
 template<class Real>
 Real barycentric_rational_imp<Real>::operator()(Real x) const
@@ -169,6 +279,76 @@ Real barycentric_rational_imp<Real>::operator()(Real x) const
     return numerator/denominator;
 }
 
+//
+// Evaluates the interpolant at each abscissa in [first, last).  The abscissas are taken chunk_size
+// at a time, and the sums for each block_size of them accumulated over a tile of nodes, before moving
+// to the next tile, so that each node is loaded once per block rather than once per abscissa, and the
+// divisions of a block are independent.  The sums for each abscissa are formed in the same order as by
+// the single abscissa overload, but the results may differ in the last bit if the compiler contracts
+// them to fused multiply-adds differently.  An abscissa which is equal to a node makes the sums infinite,
+// and is passed to the single abscissa overload, which returns the ordinate:
+//
+template<class Real>
+template<class InputIterator, class OutputIterator>
+OutputIterator barycentric_rational_imp<Real>::operator()(InputIterator first, InputIterator last, OutputIterator out) const
+{
+    std::vector<Real> x(chunk_size);
+    std::vector<Real> numerator(chunk_size);
+    std::vector<Real> denominator(chunk_size);
+    const std::size_t n = m_x.size();
+    while (first != last)
+    {
+        std::size_t m = 0;
+        for (; (m < chunk_size) && (first != last); ++m, ++first)
+        {
+            x[m] = *first;
+        }
+        // Pad the last block with copies of the last abscissa, whose sums are discarded:
+        const std::size_t padded = ((m + block_size - 1)/block_size)*block_size;
+        for (std::size_t q = m; q < padded; ++q)
+        {
+            x[q] = x[m - 1];
+        }
+        std::fill(numerator.begin(), numerator.begin() + padded, Real(0));
+        std::fill(denominator.begin(), denominator.begin() + padded, Real(0));
+        for (std::size_t i = 0; i < n; i += tile_size)
+        {
+            const std::size_t tile_end = (std::min)(i + tile_size, n);
+            for (std::size_t q = 0; q < padded; q += block_size)
+            {
+                accumulate(x.data() + q, numerator.data() + q, denominator.data() + q, i, tile_end);
+            }
+        }
+        for (std::size_t q = 0; q < m; ++q, ++out)
+        {
+            Real r = numerator[q]/denominator[q];
+            if (!(boost::math::isfinite)(r))
+            {
+                r = this->operator()(x[q]);
+            }
+            *out = r;
+        }
+    }
+    return out;
+}
+
+template<class Real>
+void barycentric_rational_imp<Real>::accumulate(const Real* x, Real* numerator, Real* denominator, std::size_t first_node, std::size_t last_node) const
+{
+    for (std::size_t i = first_node; i < last_node; ++i)
+    {
+        const Real xi = m_x[i];
+        const Real wi = m_w[i];
+        const Real yi = m_y[i];
+        for (std::size_t q = 0; q < block_size; ++q)
+        {
+            Real t = wi/(x[q] - xi);
+            numerator[q] += t*yi;
+            denominator[q] += t;
+        }
+    }
+}
+
 /*
  * A formula for computing the derivative of the barycentric representation is given in
  * "Some New Aspects of Rational Interpolation", by Claus Schneider and Wilhelm Werner,
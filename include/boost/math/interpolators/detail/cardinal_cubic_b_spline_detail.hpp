@@ -7,13 +7,22 @@
 #ifndef BOOST_MATH_INTERPOLATORS_CARDINAL_CUBIC_B_SPLINE_DETAIL_HPP
 #define BOOST_MATH_INTERPOLATORS_CARDINAL_CUBIC_B_SPLINE_DETAIL_HPP
 
+#include <algorithm>
+#include <cstddef>
 #include <limits>
 #include <cmath>
+#include <stdexcept>
+#include <string>
 #include <vector>
 #include <memory>
 #include <boost/math/constants/constants.hpp>
 #include <boost/math/special_functions/fpclassify.hpp>
 #include <boost/math/special_functions/trunc.hpp>
+#include <boost/math/tools/config.hpp>
+#include <boost/math/tools/precision.hpp>
+#ifdef BOOST_HAS_THREADS
+#include <boost/math/statistics/detail/executor.hpp>
+#endif
 
 namespace boost{ namespace math{ namespace interpolators{ namespace detail{
 
@@ -29,6 +38,19 @@ public:
                        Real left_endpoint_derivative = std::numeric_limits<Real>::quiet_NaN(),
                        Real right_endpoint_derivative = std::numeric_limits<Real>::quiet_NaN());
 
+    // Takes the samples, and overwrites them with the coefficients, so that no more memory is needed if f has capacity for two more:
+    cardinal_cubic_b_spline_imp(std::vector<Real>&& f, Real left_endpoint, Real step_size,
+                       Real left_endpoint_derivative = std::numeric_limits<Real>::quiet_NaN(),
+                       Real right_endpoint_derivative = std::numeric_limits<Real>::quiet_NaN());
+
+#ifdef BOOST_HAS_THREADS
+    // As above, but the system is solved in blocks by the tasks of an executor such as boost::math::tools::thread_pool:
+    template <class Executor>
+    cardinal_cubic_b_spline_imp(Executor& exec, std::vector<Real>&& f, Real left_endpoint, Real step_size,
+                       Real left_endpoint_derivative = std::numeric_limits<Real>::quiet_NaN(),
+                       Real right_endpoint_derivative = std::numeric_limits<Real>::quiet_NaN());
+#endif
+
     Real operator()(Real x) const;
 
     Real prime(Real x) const;
@@ -36,6 +58,24 @@ public:
     Real double_prime(Real x) const;
 
 private:
+    void check_arguments(std::size_t length, Real left_endpoint, Real step_size, Real left_endpoint_derivative, Real right_endpoint_derivative);
+
+    void estimate_endpoint_derivatives(Real& a1, Real& b1) const;
+
+    // The average of the samples [first, last), which throws if any is a NaN:
+    Real average(std::size_t first, std::size_t last) const;
+
+    void average();
+
+    void solve(Real step_size, Real a1, Real b1);
+
+    void solve_last_rows(const std::vector<Real>& c);
+
+#ifdef BOOST_HAS_THREADS
+    template <class Executor>
+    void solve(Executor& exec, Real step_size, Real a1, Real b1);
+#endif
+
     std::vector<Real> m_beta;
     Real m_h_inv;
     Real m_a;
@@ -107,10 +147,52 @@ template <class BidiIterator>
 cardinal_cubic_b_spline_imp<Real>::cardinal_cubic_b_spline_imp(BidiIterator f, BidiIterator end_p, Real left_endpoint, Real step_size,
                                              Real left_endpoint_derivative, Real right_endpoint_derivative) : m_a(left_endpoint), m_avg(0)
 {
-    using boost::math::constants::third;
-
     std::size_t length = end_p - f;
+    check_arguments(length, left_endpoint, step_size, left_endpoint_derivative, right_endpoint_derivative);
+
+    // The samples are copied to m_beta[1], ..., m_beta[length], where they are overwritten by the coefficients:
+    m_beta.resize(length + 2, std::numeric_limits<Real>::quiet_NaN());
+    for (std::size_t i = 1; f != end_p; ++f, ++i)
+    {
+        m_beta[i] = *f;
+    }
+    estimate_endpoint_derivatives(left_endpoint_derivative, right_endpoint_derivative);
+    average();
+    solve(step_size, left_endpoint_derivative, right_endpoint_derivative);
+}
+
+template <class Real>
+cardinal_cubic_b_spline_imp<Real>::cardinal_cubic_b_spline_imp(std::vector<Real>&& f, Real left_endpoint, Real step_size,
+                                             Real left_endpoint_derivative, Real right_endpoint_derivative) : m_beta(std::move(f)), m_a(left_endpoint), m_avg(0)
+{
+    const std::size_t length = m_beta.size();
+    check_arguments(length, left_endpoint, step_size, left_endpoint_derivative, right_endpoint_derivative);
+    m_beta.resize(length + 2, std::numeric_limits<Real>::quiet_NaN());
+    std::move_backward(m_beta.begin(), m_beta.begin() + length, m_beta.begin() + length + 1);
+    estimate_endpoint_derivatives(left_endpoint_derivative, right_endpoint_derivative);
+    average();
+    solve(step_size, left_endpoint_derivative, right_endpoint_derivative);
+}
+
+#ifdef BOOST_HAS_THREADS
+template <class Real>
+template <class Executor>
+cardinal_cubic_b_spline_imp<Real>::cardinal_cubic_b_spline_imp(Executor& exec, std::vector<Real>&& f, Real left_endpoint, Real step_size,
+                                             Real left_endpoint_derivative, Real right_endpoint_derivative) : m_beta(std::move(f)), m_a(left_endpoint), m_avg(0)
+{
+    const std::size_t length = m_beta.size();
+    check_arguments(length, left_endpoint, step_size, left_endpoint_derivative, right_endpoint_derivative);
+    m_beta.resize(length + 2, std::numeric_limits<Real>::quiet_NaN());
+    std::move_backward(m_beta.begin(), m_beta.begin() + length, m_beta.begin() + length + 1);
+    estimate_endpoint_derivatives(left_endpoint_derivative, right_endpoint_derivative);
+    solve(exec, step_size, left_endpoint_derivative, right_endpoint_derivative);
+}
+#endif
 
+template <class Real>
+void cardinal_cubic_b_spline_imp<Real>::check_arguments(std::size_t length, Real left_endpoint, Real step_size,
+                                                        Real left_endpoint_derivative, Real right_endpoint_derivative)
+{
     if (length < 5)
     {
         if (boost::math::isnan(left_endpoint_derivative) || boost::math::isnan(right_endpoint_derivative))
@@ -138,9 +220,15 @@ cardinal_cubic_b_spline_imp<Real>::cardinal_cubic_b_spline_imp(BidiIterator f, B
     // Storing the inverse of the stepsize does provide a measurable speedup.
     // It's not huge, but nonetheless worthwhile.
     m_h_inv = 1/step_size;
+}
+
+// Following Kress's notation, s'(a) = a1, s'(b) = b1.  The samples f[i] are in m_beta[i + 1]:
+template <class Real>
+void cardinal_cubic_b_spline_imp<Real>::estimate_endpoint_derivatives(Real& a1, Real& b1) const
+{
+    using boost::math::constants::third;
+    const Real* f = m_beta.data() + 1;
 
-    // Following Kress's notation, s'(a) = a1, s'(b) = b1
-    Real a1 = left_endpoint_derivative;
     // See the finite-difference table on Wikipedia for reference on how
     // to construct high-order estimates for one-sided derivatives:
     // https://en.wikipedia.org/wiki/Finite_difference_coefficient#Forward_and_backward_finite_difference
@@ -155,39 +243,70 @@ cardinal_cubic_b_spline_imp<Real>::cardinal_cubic_b_spline_imp(BidiIterator f, B
         a1 = m_h_inv*(t0 + t1);
     }
 
-    Real b1 = right_endpoint_derivative;
     if (boost::math::isnan(b1))
     {
-        size_t n = length - 1;
+        size_t n = m_beta.size() - 3;
         Real t0 = -4*(f[n - 1] + third<Real>()*f[n - 3]);
         Real t1 = (25*third<Real>()*f[n] + f[n - 4])/4  + 3*f[n - 2];
 
         b1 = m_h_inv*(t0 + t1);
     }
+}
 
-    // s(x) = \sum \alpha_i B_{3}( (x- x_i - a)/h )
-    // Of course we must reindex from Kress's notation, since he uses negative indices which make C++ unhappy.
-    m_beta.resize(length + 2, std::numeric_limits<Real>::quiet_NaN());
-
-    // Since the splines have compact support, they decay to zero very fast outside the endpoints.
-    // This is often very annoying; we'd like to evaluate the interpolant a little bit outside the
-    // boundary [a,b] without massive error.
-    // A simple way to deal with this is just to subtract the DC component off the signal, so we need the average.
-    // This algorithm for computing the average is recommended in
-    // http://www.heikohoffmann.de/htmlthesis/node134.html
+// Since the splines have compact support, they decay to zero very fast outside the endpoints.
+// This is often very annoying; we'd like to evaluate the interpolant a little bit outside the
+// boundary [a,b] without massive error.
+// A simple way to deal with this is just to subtract the DC component off the signal, so we need the average.
+// This algorithm for computing the average is recommended in
+// http://www.heikohoffmann.de/htmlthesis/node134.html
+template <class Real>
+Real cardinal_cubic_b_spline_imp<Real>::average(std::size_t first, std::size_t last) const
+{
+    Real avg = 0;
     Real t = 1;
-    for (size_t i = 0; i < length; ++i)
+    for (size_t i = first; i < last; ++i)
     {
-        if (boost::math::isnan(f[i]))
+        if (boost::math::isnan(m_beta[i + 1]))
         {
             std::string err = "This function you are trying to interpolate is a nan at index " + std::to_string(i) + "\n";
             throw std::logic_error(err);
         }
-        m_avg += (f[i] - m_avg) / t;
+        avg += (m_beta[i + 1] - avg) / t;
         t += 1;
     }
+    return avg;
+}
 
+template <class Real>
+void cardinal_cubic_b_spline_imp<Real>::average()
+{
+    m_avg = average(0, m_beta.size() - 2);
+}
 
+//
+// The super diagonal of the reduced system below, c_1 = 1/2 and c_i = 1/(4 - c_{i-1}), converges
+// to 2 - sqrt(3), and reaches its floating point fixed point after a few dozen rows, so only the rows
+// before that are stored.  The row reduction multiplies by c_i, which is the inverse of the diagonal:
+//
+template <class Real>
+std::vector<Real> cubic_b_spline_super_diagonal(std::size_t n)
+{
+    std::vector<Real> c{Real(0), Real(1)/2};
+    while (c.size() <= n)
+    {
+        Real next = 1/(4 - c.back());
+        if (next == c.back())
+        {
+            break;
+        }
+        c.push_back(next);
+    }
+    return c;
+}
+
+template <class Real>
+void cardinal_cubic_b_spline_imp<Real>::solve(Real step_size, Real a1, Real b1)
+{
     // Now we must solve an almost-tridiagonal system, which requires O(N) operations.
     // There are, in fact 5 diagonals, but they only differ from zero on the first and last row,
     // so we can patch up the tridiagonal row reduction algorithm to deal with two special rows.
@@ -201,21 +320,19 @@ cardinal_cubic_b_spline_imp<Real>::cardinal_cubic_b_spline_imp(BidiIterator f, B
     //          1  4  1
     //          1  0 -1
     // Numerical estimate indicate that as N->Infinity, cond(A) -> 6.9, so this matrix is good.
-    std::vector<Real> rhs(length + 2, std::numeric_limits<Real>::quiet_NaN());
-    std::vector<Real> super_diagonal(length + 2, std::numeric_limits<Real>::quiet_NaN());
+    // The right hand side overwrites the samples in m_beta, and is in turn overwritten by the solution.
+    const std::size_t n = m_beta.size() - 2;
+    const std::vector<Real> c = cubic_b_spline_super_diagonal<Real>(n);
+    const std::size_t settled = c.size() - 1;
+    Real* rhs = m_beta.data();
 
     rhs[0] = -2*step_size*a1;
-    rhs[rhs.size() - 1] = -2*step_size*b1;
-
-    super_diagonal[0] = 0;
-
-    for(size_t i = 1; i < rhs.size() - 1; ++i)
+    rhs[n + 1] = -2*step_size*b1;
+    for (size_t i = 1; i <= n; ++i)
     {
-        rhs[i] = 6*(f[i - 1] - m_avg);
-        super_diagonal[i] = 1;
+        rhs[i] = 6*(rhs[i] - m_avg);
     }
 
-
     // One step of row reduction on the first row to patch up the 5-diagonal problem:
     // 1 0 -1 | r0
     // 1 4 1  | r1
@@ -225,41 +342,167 @@ cardinal_cubic_b_spline_imp<Real>::cardinal_cubic_b_spline_imp(BidiIterator f, B
     // mapsto
     // 1 0 -1 | r0
     // 0 1 1/2| (r1 - r0)/4
-    super_diagonal[1] = 0.5;
     rhs[1] = (rhs[1] - rhs[0])/4;
 
     // Now do a tridiagonal row reduction the standard way, until just before the last row:
-    for (size_t i = 2; i < rhs.size() - 1; ++i)
+    for (size_t i = 2; i <= n; ++i)
     {
-        Real diagonal = 4 - super_diagonal[i - 1];
-        rhs[i] = (rhs[i] - rhs[i - 1])/diagonal;
-        super_diagonal[i] /= diagonal;
+        rhs[i] = (rhs[i] - rhs[i - 1])*c[(std::min)(i, settled)];
     }
 
+    solve_last_rows(c);
+
+    // Back substitutions:
+    for (size_t i = n; i > 0; --i)
+    {
+        m_beta[i] = rhs[i] - c[(std::min)(i, settled)]*m_beta[i + 1];
+    }
+    m_beta[0] = m_beta[2] + rhs[0];
+}
+
+template <class Real>
+void cardinal_cubic_b_spline_imp<Real>::solve_last_rows(const std::vector<Real>& c)
+{
+    const std::size_t n = m_beta.size() - 2;
+    const std::size_t settled = c.size() - 1;
+    Real* rhs = m_beta.data();
     // Now the last row, which is in the form
     // 1 sd[n-3] 0      | rhs[n-3]
     // 0  1     sd[n-2] | rhs[n-2]
     // 1  0     -1      | rhs[n-1]
-    Real final_subdiag = -super_diagonal[rhs.size() - 3];
-    rhs[rhs.size() - 1] = (rhs[rhs.size() - 1] - rhs[rhs.size() - 3])/final_subdiag;
+    Real final_subdiag = -c[(std::min)(n - 1, settled)];
+    rhs[n + 1] = (rhs[n + 1] - rhs[n - 1])/final_subdiag;
     Real final_diag = -1/final_subdiag;
     // Now we're here:
     // 1 sd[n-3] 0         | rhs[n-3]
     // 0  1     sd[n-2]    | rhs[n-2]
     // 0  1     final_diag | (rhs[n-1] - rhs[n-3])/diag
 
-    final_diag = final_diag - super_diagonal[rhs.size() - 2];
-    rhs[rhs.size() - 1] = rhs[rhs.size() - 1] - rhs[rhs.size() - 2];
+    final_diag = final_diag - c[(std::min)(n, settled)];
+    rhs[n + 1] = rhs[n + 1] - rhs[n];
+    m_beta[n + 1] = rhs[n + 1]/final_diag;
+}
 
+#ifdef BOOST_HAS_THREADS
+//
+// The same system, solved by splitting the rows into contiguous blocks for the tasks of an executor.
+// Since c_i converges to 2 - sqrt(3) = 0.268, the influence of the rows before a block on its
+// forward reduction, and of the rows after it on its back substitution, decays by that factor per row.
+// So each block starts its forward reduction a fixed number of rows before its first row, with the
+// reduced right hand side taken to be zero, and likewise its back substitution after its last row,
+// which truncates the influence of the other blocks to far below the rounding error.  The overlapping rows
+// are copied before each sweep, since another block overwrites them.  The coefficients, and the average,
+// which is combined from the averages of the blocks, agree with those of the sequential solution to
+// within rounding error.
+//
+template <class Real>
+template <class Executor>
+void cardinal_cubic_b_spline_imp<Real>::solve(Executor& exec, Real step_size, Real a1, Real b1)
+{
+    using boost::math::statistics::detail::parallel_chunk_count;
+    using boost::math::statistics::detail::task_launch_cost;
+    const std::size_t n = m_beta.size() - 2;
+    const std::vector<Real> c = cubic_b_spline_super_diagonal<Real>(n);
+    const std::size_t settled = c.size() - 1;
+    // (2 - sqrt(3))^overlap < 2^-(digits + 10):
+    const std::size_t overlap = static_cast<std::size_t>((boost::math::tools::digits<Real>() + 10)*0.5264) + 1;
+    // Each block must have room for the overlap of the block before it, and of the block after it:
+    const std::size_t min_block = 2*overlap + settled + 2;
+    std::size_t blocks = parallel_chunk_count(n, exec.concurrency(), 4.0, task_launch_cost(exec));
+    blocks = (std::min)(blocks, n/min_block);
+    if (blocks < 2)
+    {
+        average();
+        solve(step_size, a1, b1);
+        return;
+    }
+    // Block k is the rows [first[k], first[k+1]):
+    std::vector<std::size_t> first(blocks + 1);
+    for (std::size_t k = 0; k <= blocks; ++k)
+    {
+        first[k] = 1 + k*n/blocks;
+    }
+    Real* rhs = m_beta.data();
 
-    // Back substitutions:
-    m_beta[rhs.size() - 1] = rhs[rhs.size() - 1]/final_diag;
-    for(size_t i = rhs.size() - 2; i > 0; --i)
+    std::vector<Real> averages(blocks);
+    exec.bulk_execute(blocks, [&](std::size_t k)
+    {
+        averages[k] = average(first[k] - 1, first[k + 1] - 1);
+    });
+    m_avg = 0;
+    for (std::size_t k = 0; k < blocks; ++k)
     {
-        m_beta[i] = rhs[i] - super_diagonal[i]*m_beta[i + 1];
+        m_avg += averages[k]*static_cast<Real>(first[k + 1] - first[k]);
     }
+    m_avg /= n;
+
+    rhs[0] = -2*step_size*a1;
+    rhs[n + 1] = -2*step_size*b1;
+    exec.bulk_execute(blocks, [&](std::size_t k)
+    {
+        for (std::size_t i = first[k]; i < first[k + 1]; ++i)
+        {
+            rhs[i] = 6*(rhs[i] - m_avg);
+        }
+    });
+
+    std::vector<Real> copies(blocks*overlap);
+    for (std::size_t k = 1; k < blocks; ++k)
+    {
+        std::copy(rhs + first[k] - overlap, rhs + first[k], copies.begin() + k*overlap);
+    }
+    exec.bulk_execute(blocks, [&](std::size_t k)
+    {
+        std::size_t i = first[k];
+        Real previous = 0;
+        if (k == 0)
+        {
+            rhs[1] = (rhs[1] - rhs[0])/4;
+            previous = rhs[1];
+            i = 2;
+        }
+        else
+        {
+            for (std::size_t j = 0; j < overlap; ++j)
+            {
+                previous = (copies[k*overlap + j] - previous)*c[(std::min)(first[k] - overlap + j, settled)];
+            }
+        }
+        for (; i < first[k + 1]; ++i)
+        {
+            rhs[i] = (rhs[i] - previous)*c[(std::min)(i, settled)];
+            previous = rhs[i];
+        }
+        if (k == blocks - 1)
+        {
+            solve_last_rows(c);
+        }
+    });
+
+    for (std::size_t k = 0; k + 1 < blocks; ++k)
+    {
+        std::copy(rhs + first[k + 1], rhs + first[k + 1] + overlap, copies.begin() + k*overlap);
+    }
+    exec.bulk_execute(blocks, [&](std::size_t k)
+    {
+        Real next = m_beta[n + 1];
+        if (k + 1 < blocks)
+        {
+            next = 0;
+            for (std::size_t j = overlap; j-- > 0;)
+            {
+                next = copies[k*overlap + j] - c[(std::min)(first[k + 1] + j, settled)]*next;
+            }
+        }
+        for (std::size_t i = first[k + 1]; i-- > first[k];)
+        {
+            m_beta[i] = rhs[i] - c[(std::min)(i, settled)]*next;
+            next = m_beta[i];
+        }
+    });
     m_beta[0] = m_beta[2] + rhs[0];
 }
+#endif
 
 template<class Real>
 Real cardinal_cubic_b_spline_imp<Real>::operator()(Real x) const
@@ -18,6 +18,78 @@ namespace math {
 namespace interpolators {
 namespace detail {
 
+//
+// Returns i such that knots[i] <= x < knots[i+1], given knots[0] <= x < knots.back().  The search
+// starts at the interval hint, and gallops away from it in steps of 1, 2, 4, ... 32
+// until x is bracketed, then bisects the bracket.  Beyond that x is unrelated to the
+// hint, and all the knots are bisected, as by the single abscissa overloads, since the
+// first few midpoints are then the same every time and stay in cache:
+//
+template<class RandomAccessContainer, class Real, class Size>
+Size hermite_find_interval(const RandomAccessContainer& knots, Real x, Size hint)
+{
+    const Size last = knots.size() - 1;
+    if (hint >= last)
+    {
+        hint = last - 1;
+    }
+    Size lo, hi;
+    if (x < knots[hint])
+    {
+        hi = hint;
+        for (Size step = 1; ; step *= 2)
+        {
+            if (step > 32)
+            {
+                lo = 0;
+                hi = last;
+                break;
+            }
+            if (step >= hi)
+            {
+                lo = 0;
+                break;
+            }
+            lo = hi - step;
+            if (knots[lo] <= x)
+            {
+                break;
+            }
+            hi = lo;
+        }
+    }
+    else
+    {
+        if (x < knots[hint + 1])
+        {
+            return hint;
+        }
+        lo = hint + 1;
+        for (Size step = 1; ; step *= 2)
+        {
+            if (step > 32)
+            {
+                lo = 0;
+                hi = last;
+                break;
+            }
+            if (step >= last - lo)
+            {
+                hi = last;
+                break;
+            }
+            hi = lo + step;
+            if (x < knots[hi])
+            {
+                break;
+            }
+            lo = hi;
+        }
+    }
+    auto it = std::upper_bound(knots.begin() + lo, knots.begin() + hi, x);
+    return static_cast<Size>(std::distance(knots.begin(), it) - 1);
+}
+
 template<class RandomAccessContainer>
 class cubic_hermite_detail {
 public:
@@ -71,6 +143,75 @@ public:
     }
 
     Real operator()(Real x) const
+    {
+        check_domain(x);
+        // We need t := (x-x_k)/(x_{k+1}-x_k) \in [0,1) for this to work.
+        // Sadly this neccessitates this loathesome check, otherwise we get t = 1 at x = xf.
+        if (x == x_.back())
+        {
+            return y_.back();
+        }
+
+        auto it = std::upper_bound(x_.begin(), x_.end(), x);
+        return unchecked_evaluation(x, static_cast<Size>(std::distance(x_.begin(), it) - 1));
+    }
+
+    Real prime(Real x) const
+    {
+        check_domain(x);
+        if (x == x_.back())
+        {
+            return dydx_.back();
+        }
+        auto it = std::upper_bound(x_.begin(), x_.end(), x);
+        return unchecked_prime(x, static_cast<Size>(std::distance(x_.begin(), it) - 1));
+    }
+
+    //
+    // Evaluates the interpolant at each abscissa in [first, last), and writes the values to out.
+    // Each abscissa is located by searching outwards from the interval of the one before, so that
+    // sorted, or nearly sorted, abscissas cost O(1) each rather than O(log n), and no abscissa
+    // costs more than O(log n).  The values are identical to those of the single abscissa overloads:
+    //
+    template<class InputIterator, class OutputIterator>
+    OutputIterator operator()(InputIterator first, InputIterator last, OutputIterator out) const
+    {
+        Size i = 0;
+        for (; first != last; ++first, ++out)
+        {
+            Real x = *first;
+            check_domain(x);
+            if (x == x_.back())
+            {
+                *out = y_.back();
+                continue;
+            }
+            i = hermite_find_interval(x_, x, i);
+            *out = unchecked_evaluation(x, i);
+        }
+        return out;
+    }
+
+    template<class InputIterator, class OutputIterator>
+    OutputIterator prime(InputIterator first, InputIterator last, OutputIterator out) const
+    {
+        Size i = 0;
+        for (; first != last; ++first, ++out)
+        {
+            Real x = *first;
+            check_domain(x);
+            if (x == x_.back())
+            {
+                *out = dydx_.back();
+                continue;
+            }
+            i = hermite_find_interval(x_, x, i);
+            *out = unchecked_prime(x, i);
+        }
+        return out;
+    }
+
+    void check_domain(Real x) const
     {
         if  (x < x_[0] || x > x_.back())
         {
@@ -80,17 +221,12 @@ public:
                 << x_[0] << ", " << x_.back() << "]";
             throw std::domain_error(oss.str());
         }
-        // We need t := (x-x_k)/(x_{k+1}-x_k) \in [0,1) for this to work.
-        // Sadly this neccessitates this loathesome check, otherwise we get t = 1 at x = xf.
-        if (x == x_.back())
-        {
-            return y_.back();
-        }
+    }
 
-        auto it = std::upper_bound(x_.begin(), x_.end(), x);
-        auto i = std::distance(x_.begin(), it) -1;
-        Real x0 = *(it-1);
-        Real x1 = *it;
+    Real unchecked_evaluation(Real x, Size i) const
+    {
+        Real x0 = x_[i];
+        Real x1 = x_[i+1];
         Real y0 = y_[i];
         Real y1 = y_[i+1];
         Real s0 = dydx_[i];
@@ -105,24 +241,10 @@ public:
         return y;
     }
 
-    Real prime(Real x) const
+    Real unchecked_prime(Real x, Size i) const
     {
-        if  (x < x_[0] || x > x_.back())
-        {
-            std::ostringstream oss;
-            oss.precision(std::numeric_limits<Real>::digits10+3);
-            oss << "Requested abscissa x = " << x << ", which is outside of allowed range ["
-                << x_[0] << ", " << x_.back() << "]";
-            throw std::domain_error(oss.str());
-        }
-        if (x == x_.back())
-        {
-            return dydx_.back();
-        }
-        auto it = std::upper_bound(x_.begin(), x_.end(), x);
-        auto i = std::distance(x_.begin(), it) -1;
-        Real x0 = *(it-1);
-        Real x1 = *it;
+        Real x0 = x_[i];
+        Real x1 = x_[i+1];
         Real y0 = y_[i];
         Real y1 = y_[i+1];
         Real s0 = dydx_[i];
@@ -133,7 +255,7 @@ public:
         Real d2 = (s1 - s0)/(2*dx);
         Real c2 = 3*d1 - 2*d2;
         Real c3 = 2*(d2 - d1)/dx;
-        return s0 + 2*c2*(x-x0) + 3*c3*(x-x0)*(x-x0); 
+        return s0 + 2*c2*(x-x0) + 3*c3*(x-x0)*(x-x0);
     }
 
 
@@ -0,0 +1,368 @@
+// Copyright Boost.Math contributors 2026.
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_INTERPOLATORS_DETAIL_HERMITE_SEGMENTS_DETAIL_HPP
+#define BOOST_MATH_INTERPOLATORS_DETAIL_HERMITE_SEGMENTS_DETAIL_HPP
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <boost/math/interpolators/detail/cubic_hermite_detail.hpp>
+
+namespace boost {
+namespace math {
+namespace interpolators {
+namespace detail {
+
+//
+// A Hermite interpolant which matches the function and its first Derivatives derivatives at each
+// knot, stored as the coefficients of a polynomial of degree 2*Derivatives + 1 in t = (x - x_i)/(x_{i+1} - x_i)
+// for each interval.  The coefficients of an interval are contiguous, and padded to a power of two, and
+// the first interval starts on a cache line, so that an evaluation reads the knots to locate x, and
+// then a single cache line (for double precision), rather than a line from each of the arrays of ordinates
+// and derivatives.  The price is the memory, 2*Derivatives + 2 coefficients per interval, padded to 4 or 8,
+// rather than the Derivatives + 1 data per knot, and that the interpolant only matches the data at the right
+// hand end of each interval to within rounding error.
+//
+template<class Real, std::size_t Derivatives>
+class hermite_segments_detail {
+public:
+    static_assert(Derivatives >= 1 && Derivatives <= 3, "Hermite segments are implemented for the cubic, quintic and septic interpolants.");
+    using Size = std::size_t;
+    using Point = std::array<Real, Derivatives + 1>;
+    static constexpr Size degree = 2*Derivatives + 1;
+    static constexpr Size stride = degree < 4 ? 4 : 8;
+    static constexpr Size alignment = 64;
+
+    template<class RandomAccessContainer>
+    hermite_segments_detail(const RandomAccessContainer & x, const std::array<const RandomAccessContainer*, Derivatives + 1> & data)
+     : x_(x.begin(), x.end()), offset_{0}, capacity_{0}
+    {
+        if (x_.size() != data[0]->size())
+        {
+            throw std::domain_error("There must be the same number of ordinates as abscissas.");
+        }
+        for (Size k = 1; k <= Derivatives; ++k)
+        {
+            if (x_.size() != data[k]->size())
+            {
+                throw std::domain_error("There must be the same number of ordinates as derivative values.");
+            }
+        }
+        if (x_.size() < 2)
+        {
+            throw std::domain_error("Must be at least two data points.");
+        }
+        Real x0 = x_[0];
+        for (Size i = 1; i < x_.size(); ++i)
+        {
+            Real x1 = x_[i];
+            if (x1 <= x0)
+            {
+                std::ostringstream oss;
+                oss.precision(std::numeric_limits<Real>::digits10+3);
+                oss << "Abscissas must be listed in strictly increasing order x0 < x1 < ... < x_{n-1}, ";
+                oss << "but at x[" << i - 1 << "] = " << x0 << ", and x[" << i << "] = " << x1 << ".\n";
+                throw std::domain_error(oss.str());
+            }
+            x0 = x1;
+        }
+
+        reserve(x_.size() - 1);
+        Point p0 = point(data, 0);
+        for (Size i = 0; i < x_.size() - 1; ++i)
+        {
+            Point p1 = point(data, i + 1);
+            set_segment(i, p0, p1);
+            p0 = p1;
+        }
+        last_ = p0;
+    }
+
+    hermite_segments_detail(const hermite_segments_detail &) = delete;
+    hermite_segments_detail& operator=(const hermite_segments_detail &) = delete;
+
+    void push_back(Real x, const Point & p)
+    {
+        if (x <= x_.back())
+        {
+             throw std::domain_error("Calling push_back must preserve the monotonicity of the x's");
+        }
+        const Size segments = x_.size() - 1;
+        if (segments == capacity_)
+        {
+            reserve(2*capacity_);
+        }
+        x_.push_back(x);
+        set_segment(segments, last_, p);
+        last_ = p;
+    }
+
+    Real operator()(Real x) const
+    {
+        check_domain(x);
+        if (x == x_.back())
+        {
+            return last_[0];
+        }
+        auto it = std::upper_bound(x_.begin(), x_.end(), x);
+        return unchecked_evaluation(x, static_cast<Size>(std::distance(x_.begin(), it) - 1));
+    }
+
+    Real prime(Real x) const
+    {
+        check_domain(x);
+        if (x == x_.back())
+        {
+            return last_[1];
+        }
+        auto it = std::upper_bound(x_.begin(), x_.end(), x);
+        return unchecked_prime(x, static_cast<Size>(std::distance(x_.begin(), it) - 1));
+    }
+
+    Real double_prime(Real x) const
+    {
+        static_assert(Derivatives >= 2, "The second derivative of the cubic interpolant is not continuous.");
+        check_domain(x);
+        if (x == x_.back())
+        {
+            return last_[2];
+        }
+        auto it = std::upper_bound(x_.begin(), x_.end(), x);
+        return unchecked_double_prime(x, static_cast<Size>(std::distance(x_.begin(), it) - 1));
+    }
+
+    template<class InputIterator, class OutputIterator>
+    OutputIterator operator()(InputIterator first, InputIterator last, OutputIterator out) const
+    {
+        Size i = 0;
+        for (; first != last; ++first, ++out)
+        {
+            Real x = *first;
+            check_domain(x);
+            if (x == x_.back())
+            {
+                *out = last_[0];
+                continue;
+            }
+            i = hermite_find_interval(x_, x, i);
+            *out = unchecked_evaluation(x, i);
+        }
+        return out;
+    }
+
+    template<class InputIterator, class OutputIterator>
+    OutputIterator prime(InputIterator first, InputIterator last, OutputIterator out) const
+    {
+        Size i = 0;
+        for (; first != last; ++first, ++out)
+        {
+            Real x = *first;
+            check_domain(x);
+            if (x == x_.back())
+            {
+                *out = last_[1];
+                continue;
+            }
+            i = hermite_find_interval(x_, x, i);
+            *out = unchecked_prime(x, i);
+        }
+        return out;
+    }
+
+    void check_domain(Real x) const
+    {
+        if  (x < x_[0] || x > x_.back())
+        {
+            std::ostringstream oss;
+            oss.precision(std::numeric_limits<Real>::digits10+3);
+            oss << "Requested abscissa x = " << x << ", which is outside of allowed range ["
+                << x_[0] << ", " << x_.back() << "]";
+            throw std::domain_error(oss.str());
+        }
+    }
+
+    Real unchecked_evaluation(Real x, Size i) const
+    {
+        const Real* c = segment(i);
+        Real t = (x - x_[i])/(x_[i+1] - x_[i]);
+        Real y = c[degree];
+        for (Size k = degree; k-- > 0;)
+        {
+            y = y*t + c[k];
+        }
+        return y;
+    }
+
+    Real unchecked_prime(Real x, Size i) const
+    {
+        const Real* c = segment(i);
+        Real dx = x_[i+1] - x_[i];
+        Real t = (x - x_[i])/dx;
+        Real y = degree*c[degree];
+        for (Size k = degree - 1; k > 0; --k)
+        {
+            y = y*t + k*c[k];
+        }
+        return y/dx;
+    }
+
+    Real unchecked_double_prime(Real x, Size i) const
+    {
+        const Real* c = segment(i);
+        Real dx = x_[i+1] - x_[i];
+        Real t = (x - x_[i])/dx;
+        Real y = degree*(degree - 1)*c[degree];
+        for (Size k = degree - 1; k > 1; --k)
+        {
+            y = y*t + k*(k - 1)*c[k];
+        }
+        return y/(dx*dx);
+    }
+
+    friend std::ostream& operator<<(std::ostream & os, const hermite_segments_detail & m)
+    {
+        os << "(x, c_0, ..., c_" << degree << ") = {";
+        for (Size i = 0; i < m.x_.size() - 1; ++i)
+        {
+            const Real* c = m.segment(i);
+            os << "(" << m.x_[i];
+            for (Size k = 0; k <= degree; ++k)
+            {
+                os << ", " << c[k];
+            }
+            os << "),  ";
+        }
+        os << "(" << m.x_.back() << ")}";
+        return os;
+    }
+
+    Size size() const
+    {
+        return x_.size();
+    }
+
+    int64_t bytes() const
+    {
+        return (x_.size() + storage_.size() + last_.size())*sizeof(Real) + 2*sizeof(x_);
+    }
+
+    std::pair<Real, Real> domain() const
+    {
+        return {x_.front(), x_.back()};
+    }
+
+private:
+    template<class RandomAccessContainer>
+    static Point point(const std::array<const RandomAccessContainer*, Derivatives + 1> & data, Size i)
+    {
+        Point p;
+        for (Size k = 0; k <= Derivatives; ++k)
+        {
+            p[k] = (*data[k])[i];
+        }
+        return p;
+    }
+
+    const Real* segment(Size i) const
+    {
+        return storage_.data() + offset_ + i*stride;
+    }
+
+    //
+    // With f_k = h^k/k! times the kth derivative, the coefficients c_0, ..., c_Derivatives are f_0, ..., f_Derivatives
+    // at the left hand end, and the rest solve a linear system with the binomial coefficients C(j, k), for j > Derivatives,
+    // which matches f_0, ..., f_Derivatives at the right hand end.  The inverses of these matrices are integer:
+    //
+    void set_segment(Size i, const Point & p0, const Point & p1)
+    {
+        static constexpr int inverse_1[2][2] = {{3, -1}, {-2, 1}};
+        static constexpr int inverse_2[3][3] = {{10, -4, 1}, {-15, 7, -2}, {6, -3, 1}};
+        static constexpr int inverse_3[4][4] = {{35, -15, 5, -1}, {-84, 39, -14, 3}, {70, -34, 13, -3}, {-20, 10, -4, 1}};
+        const int* inverse = Derivatives == 1 ? &inverse_1[0][0] : Derivatives == 2 ? &inverse_2[0][0] : &inverse_3[0][0];
+
+        Real h = x_[i+1] - x_[i];
+        Real* c = storage_.data() + offset_ + i*stride;
+        Point r;
+        Real scale = 1;
+        for (Size k = 0; k <= Derivatives; ++k)
+        {
+            c[k] = p0[k]*scale;
+            r[k] = p1[k]*scale;
+            scale *= h/(k + 1);
+        }
+        for (Size k = 0; k <= Derivatives; ++k)
+        {
+            for (Size j = k; j <= Derivatives; ++j)
+            {
+                r[k] -= binomial(j, k)*c[j];
+            }
+        }
+        for (Size m = 0; m <= Derivatives; ++m)
+        {
+            Real a = 0;
+            for (Size k = 0; k <= Derivatives; ++k)
+            {
+                a += inverse[m*(Derivatives + 1) + k]*r[k];
+            }
+            c[Derivatives + 1 + m] = a;
+        }
+        for (Size k = degree + 1; k < stride; ++k)
+        {
+            c[k] = 0;
+        }
+    }
+
+    static int binomial(Size n, Size k)
+    {
+        int b = 1;
+        for (Size j = 0; j < k; ++j)
+        {
+            b = b*static_cast<int>(n - j)/static_cast<int>(j + 1);
+        }
+        return b;
+    }
+
+    // Reallocates the coefficients with room for the given number of intervals, keeping those already computed:
+    void reserve(Size segments)
+    {
+        std::vector<Real> storage(segments*stride + alignment/sizeof(Real) + 1);
+        Size offset = 0;
+        for (Size k = 0; k*sizeof(Real) < alignment && k < storage.size(); ++k)
+        {
+            if (reinterpret_cast<std::uintptr_t>(storage.data() + k) % alignment == 0)
+            {
+                offset = k;
+                break;
+            }
+        }
+        if (capacity_ > 0)
+        {
+            std::move(storage_.begin() + offset_, storage_.begin() + offset_ + (x_.size() - 1)*stride, storage.begin() + offset);
+        }
+        storage_.swap(storage);
+        offset_ = offset;
+        capacity_ = segments;
+    }
+
+    std::vector<Real> x_;
+    std::vector<Real> storage_;
+    Size offset_;
+    Size capacity_;
+    Point last_;
+};
+
+}
+}
+}
+}
+#endif
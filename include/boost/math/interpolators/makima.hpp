@@ -117,6 +117,17 @@ public:
         return impl_->prime(x);
     }
 
+    // Evaluates at each abscissa in [first, last), which is fastest when they are sorted:
+    template<class InputIterator, class OutputIterator>
+    OutputIterator operator()(InputIterator first, InputIterator last, OutputIterator out) const {
+        return impl_->operator()(first, last, out);
+    }
+
+    template<class InputIterator, class OutputIterator>
+    OutputIterator prime(InputIterator first, InputIterator last, OutputIterator out) const {
+        return impl_->prime(first, last, out);
+    }
+
     friend std::ostream& operator<<(std::ostream & os, const makima & m)
     {
         os << *m.impl_;
@@ -9,8 +9,10 @@
 #define BOOST_MATH_INTERPOLATORS_QUINTIC_HERMITE_HPP
 #include <algorithm>
 #include <stdexcept>
+#include <array>
 #include <memory>
 #include <boost/math/interpolators/detail/quintic_hermite_detail.hpp>
+#include <boost/math/interpolators/detail/hermite_segments_detail.hpp>
 
 namespace boost {
 namespace math {
@@ -64,6 +66,71 @@ private:
     std::shared_ptr<detail::quintic_hermite_detail<RandomAccessContainer>> impl_;
 };
 
+//
+// The same interpolant, stored as the coefficients of a polynomial for each interval, which takes more
+// memory, but reads the coefficients of an interval from a single cache line rather than one from each array:
+//
+template<class RandomAccessContainer>
+class quintic_hermite_segments {
+public:
+    using Real = typename RandomAccessContainer::value_type;
+
+    quintic_hermite_segments(RandomAccessContainer && x, RandomAccessContainer && y, RandomAccessContainer && dydx, RandomAccessContainer && d2ydx2)
+     : impl_(std::make_shared<detail::hermite_segments_detail<Real, 2>>(x, std::array<const RandomAccessContainer*, 3>{{&y, &dydx, &d2ydx2}}))
+    {}
+
+    Real operator()(Real x) const
+    {
+        return impl_->operator()(x);
+    }
+
+    Real prime(Real x) const
+    {
+        return impl_->prime(x);
+    }
+
+    Real double_prime(Real x) const
+    {
+        return impl_->double_prime(x);
+    }
+
+    template<class InputIterator, class OutputIterator>
+    OutputIterator operator()(InputIterator first, InputIterator last, OutputIterator out) const
+    {
+        return impl_->operator()(first, last, out);
+    }
+
+    template<class InputIterator, class OutputIterator>
+    OutputIterator prime(InputIterator first, InputIterator last, OutputIterator out) const
+    {
+        return impl_->prime(first, last, out);
+    }
+
+    friend std::ostream& operator<<(std::ostream & os, const quintic_hermite_segments & m)
+    {
+        os << *m.impl_;
+        return os;
+    }
+
+    void push_back(Real x, Real y, Real dydx, Real d2ydx2)
+    {
+        impl_->push_back(x, {{y, dydx, d2ydx2}});
+    }
+
+    int64_t bytes() const
+    {
+        return impl_->bytes() + sizeof(impl_);
+    }
+
+    std::pair<Real, Real> domain() const
+    {
+        return impl_->domain();
+    }
+
+private:
+    std::shared_ptr<detail::hermite_segments_detail<Real, 2>> impl_;
+};
+
 template<class RandomAccessContainer>
 class cardinal_quintic_hermite {
 public:
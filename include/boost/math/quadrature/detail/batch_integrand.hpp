@@ -0,0 +1,195 @@
+//  Copyright Boost.Math contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_QUADRATURE_DETAIL_BATCH_INTEGRAND_HPP
+#define BOOST_MATH_QUADRATURE_DETAIL_BATCH_INTEGRAND_HPP
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <boost/math/tools/is_detected.hpp>
+
+namespace boost { namespace math { namespace quadrature { namespace detail {
+
+//
+// A batch integrand is a callable f(const Real* x, Real* y, std::size_t n)
+// which sets y[i] to the value of the integrand at x[i] for each i in [0, n).
+// It lets integrands which are vectorized, or which have a large setup cost,
+// process a whole row of abscissas at a time.
+//
+template <typename Real, typename F>
+using batch_call_t = decltype(std::declval<const F&>()(std::declval<const Real*>(), std::declval<Real*>(), std::size_t(0)));
+
+template <typename Real, typename F>
+struct is_batch_callable
+{
+   static constexpr bool value = boost::math::tools::is_detected<batch_call_t, Real, F>::value;
+};
+
+// The transformation used when the integrand is evaluated at the abscissas unchanged:
+template <typename Real>
+struct identity_transform
+{
+   template <typename... Args>
+   std::pair<Real, Real> operator()(const Real& x, Args...) const
+   {
+      return std::pair<Real, Real>(x, Real(1));
+   }
+};
+
+//
+// Wraps a batch integrand together with the change of variables applied by the
+// integrator: transform(args...) returns the pair {x, s}, and the transformed
+// integrand is s*f(x).  The quadrature routines may call this one point at a
+// time, as an ordinary integrand, or a row at a time via evaluate_points.
+//
+template <typename Real, typename F, typename Transform>
+class batch_integrand
+{
+public:
+   batch_integrand(const F& f, const Transform& transform) : m_f(f), m_transform(transform) {}
+
+   template <typename... Args>
+   Real operator()(Args... args) const
+   {
+      std::pair<Real, Real> p = m_transform(args...);
+      Real y;
+      m_f(&p.first, &y, 1);
+      return y * p.second;
+   }
+
+   // Sets y[i] to the transformed integrand at args[i]... for each i in [0, n):
+   template <typename... Args>
+   void evaluate(std::size_t n, Real* y, const Args*... args) const
+   {
+      evaluate(n, y, std::is_same<Transform, identity_transform<Real>>(), args...);
+   }
+
+private:
+   // The abscissas are passed straight through when there is no change of variables:
+   template <typename... Args>
+   void evaluate(std::size_t n, Real* y, const std::true_type&, const Real* x, const Args*...) const
+   {
+      m_f(x, y, n);
+   }
+
+   template <typename... Args>
+   void evaluate(std::size_t n, Real* y, const std::false_type&, const Args*... args) const
+   {
+      m_x.resize(n);
+      m_scale.resize(n);
+      for (std::size_t i = 0; i < n; ++i)
+      {
+         std::pair<Real, Real> p = m_transform(args[i]...);
+         m_x[i] = p.first;
+         m_scale[i] = p.second;
+      }
+      m_f(m_x.data(), y, n);
+      for (std::size_t i = 0; i < n; ++i)
+      {
+         y[i] *= m_scale[i];
+      }
+   }
+
+   const F& m_f;
+   Transform m_transform;
+   mutable std::vector<Real> m_x;
+   mutable std::vector<Real> m_scale;
+};
+
+template <typename Real, typename F, typename Transform>
+inline batch_integrand<Real, F, Transform> make_batch_integrand(const F& f, const Transform& transform)
+{
+   return batch_integrand<Real, F, Transform>(f, transform);
+}
+
+//
+// The ordinary integrand counterpart of batch_integrand: transform(args...) returns
+// the pair {x, s}, and the transformed integrand is f(x)*s.
+//
+template <typename Real, typename F, typename Transform>
+class transformed_integrand
+{
+public:
+   typedef decltype(std::declval<const F&>()(std::declval<Real>())) result_type;
+
+   transformed_integrand(const F& f, const Transform& transform) : m_f(f), m_transform(transform) {}
+
+   template <typename... Args>
+   result_type operator()(Args... args) const
+   {
+      std::pair<Real, Real> p = m_transform(args...);
+      return m_f(p.first) * p.second;
+   }
+
+private:
+   const F& m_f;
+   Transform m_transform;
+};
+
+// With no change of variables f is called directly:
+template <typename Real, typename F>
+class transformed_integrand<Real, F, identity_transform<Real>>
+{
+public:
+   typedef decltype(std::declval<const F&>()(std::declval<Real>())) result_type;
+
+   transformed_integrand(const F& f, const identity_transform<Real>&) : m_f(f) {}
+
+   template <typename... Args>
+   result_type operator()(const Real& x, Args...) const
+   {
+      return m_f(x);
+   }
+
+private:
+   const F& m_f;
+};
+
+//
+// Applies a change of variables to f, so that the integrators express each of their
+// transformations once, for both ordinary and batch integrands:
+//
+template <typename Real, typename F, typename Transform>
+inline typename std::enable_if<!is_batch_callable<Real, F>::value, transformed_integrand<Real, F, Transform>>::type make_transformed_integrand(const F& f, const Transform& transform)
+{
+   return transformed_integrand<Real, F, Transform>(f, transform);
+}
+
+template <typename Real, typename F, typename Transform>
+inline typename std::enable_if<is_batch_callable<Real, F>::value, batch_integrand<Real, F, Transform>>::type make_transformed_integrand(const F& f, const Transform& transform)
+{
+   return batch_integrand<Real, F, Transform>(f, transform);
+}
+
+template <typename F>
+struct is_batch_integrand : std::false_type {};
+
+template <typename Real, typename F, typename Transform>
+struct is_batch_integrand<batch_integrand<Real, F, Transform>> : std::true_type {};
+
+//
+// Sets y[i] = f(args[i]...) for each i in [0, n), in a single call when f is a
+// batch integrand:
+//
+template <typename F, typename R, typename... Args>
+inline void evaluate_points(const F& f, std::size_t n, R* y, const Args*... args)
+{
+   for (std::size_t i = 0; i < n; ++i)
+   {
+      y[i] = f(args[i]...);
+   }
+}
+
+template <typename Real, typename F, typename Transform, typename... Args>
+inline void evaluate_points(const batch_integrand<Real, F, Transform>& f, std::size_t n, Real* y, const Args*... args)
+{
+   f.evaluate(n, y, args...);
+}
+
+}}}} // namespaces
+
+#endif // BOOST_MATH_QUADRATURE_DETAIL_BATCH_INTEGRAND_HPP
@@ -7,9 +7,12 @@
 #ifndef BOOST_MATH_QUADRATURE_DETAIL_EXP_SINH_DETAIL_HPP
 #define BOOST_MATH_QUADRATURE_DETAIL_EXP_SINH_DETAIL_HPP
 
+#include <algorithm>
 #include <cmath>
 #include <vector>
 #include <typeinfo>
+#include <boost/math/quadrature/detail/batch_integrand.hpp>
+#include <boost/math/quadrature/detail/node_table_io.hpp>
 #include <boost/math/constants/constants.hpp>
 #include <boost/math/special_functions/next.hpp>
 #include <boost/math/tools/atomic.hpp>
@@ -46,7 +49,23 @@ public:
     template<class F>
     auto integrate(const F& f, Real* error, Real* L1, const char* function, Real tolerance, std::size_t* levels) const ->decltype(std::declval<F>()(std::declval<Real>()));
 
+    //
+    // Writes the rows computed so far to os, and adopts the rows read from is which
+    // we have not yet computed, see node_table_io.hpp:
+    //
+    void save_nodes(std::ostream& os)const;
+    bool load_nodes(std::istream& is)const;
+
 private:
+   // Evaluates a batch integrand at the entries [begin, end) of row, and stores the values at the same positions in values:
+   template<class F, class K>
+   void evaluate_batch_row(const F& f, const std::vector<Real>& row, std::size_t begin, std::size_t end, std::vector<K>& values)const
+   {
+      values.resize(row.size());
+      if (end > begin)
+         evaluate_points(f, end - begin, values.data() + begin, row.data() + begin);
+   }
+
    const std::vector<Real>& get_abscissa_row(std::size_t n)const
    {
 #if !defined(BOOST_MATH_NO_ATOMIC_INT) && defined(BOOST_HAS_THREADS)
@@ -171,9 +190,17 @@ auto exp_sinh_detail<Real, Policy>::integrate(const F& f, Real* error, Real* L1,
     Real min_abscissa{ 0 }, max_abscissa{ boost::math::tools::max_value<Real>() };
     K I0 = 0;
     Real L1_I0 = 0;
+    //
+    // A batch integrand is evaluated at all the points of each row in a single call,
+    // even though the first row may be cut short below, and the values stored here:
+    //
+    const bool batch = is_batch_integrand<F>::value;
+    std::vector<K> row_values;
+    if (batch)
+       evaluate_batch_row(f, m_abscissas[0], 0, m_abscissas[0].size(), row_values);
     for(size_t i = 0; i < m_abscissas[0].size(); ++i)
     {
-        K y = f(m_abscissas[0][i]);
+        K y = batch ? row_values[i] : f(m_abscissas[0][i]);
         K I0_last = I0;
         I0 += y*m_weights[0][i];
         L1_I0 += abs(y)*m_weights[0][i];
@@ -189,9 +216,11 @@ auto exp_sinh_detail<Real, Policy>::integrate(const F& f, Real* error, Real* L1,
     Real L1_I1 = L1_I0;
     bool have_first_j = false;
     std::size_t first_j = 0;
+    if (batch)
+       evaluate_batch_row(f, m_abscissas[1], 0, static_cast<std::size_t>(std::lower_bound(m_abscissas[1].begin(), m_abscissas[1].end(), max_abscissa) - m_abscissas[1].begin()), row_values);
     for (size_t i = 0; (i < m_abscissas[1].size()) && (m_abscissas[1][i] < max_abscissa); ++i)
     {
-        K y = f(m_abscissas[1][i]);
+        K y = batch ? row_values[i] : f(m_abscissas[1][i]);
         K I1_last = I1;
         I1 += y*m_weights[1][i];
         L1_I1 += abs(y)*m_weights[1][i];
@@ -230,10 +259,12 @@ auto exp_sinh_detail<Real, Policy>::integrate(const F& f, Real* error, Real* L1,
         std::size_t j = first_j;
         while (abscissas_row[j] < min_abscissa)
            ++j;
+        if (batch)
+           evaluate_batch_row(f, abscissas_row, j, static_cast<std::size_t>(std::lower_bound(abscissas_row.begin() + j, abscissas_row.begin() + m_weights[i].size(), max_abscissa) - abscissas_row.begin()), row_values);
         for(; (j < m_weights[i].size()) && (abscissas_row[j] < max_abscissa); ++j)
         {
             Real x = abscissas_row[j];
-            K y = f(x);
+            K y = batch ? row_values[j] : f(x);
             sum += y*weight_row[j];
             Real abterm0 = abs(y)*weight_row[j];
             absum += abterm0;
@@ -274,6 +305,53 @@ auto exp_sinh_detail<Real, Policy>::integrate(const F& f, Real* error, Real* L1,
 }
 
 
+template<class Real, class Policy>
+void exp_sinh_detail<Real, Policy>::save_nodes(std::ostream& os)const
+{
+#if !defined(BOOST_MATH_NO_ATOMIC_INT) && defined(BOOST_HAS_THREADS)
+   std::lock_guard<std::mutex> guard(m_mutex);
+   std::size_t rows = m_committed_refinements.load() + 1;
+#else
+   std::size_t rows = m_committed_refinements + 1;
+#endif
+   write_node_table(os, "exp_sinh", m_abscissas, m_weights, rows);
+}
+
+template<class Real, class Policy>
+bool exp_sinh_detail<Real, Policy>::load_nodes(std::istream& is)const
+{
+   std::vector<std::vector<Real>> abscissas, weights;
+   if (!read_node_table(is, "exp_sinh", abscissas, weights, m_abscissas.size()))
+      return false;
+#if !defined(BOOST_MATH_NO_ATOMIC_INT) && defined(BOOST_HAS_THREADS)
+   std::lock_guard<std::mutex> guard(m_mutex);
+   std::size_t committed = m_committed_refinements.load();
+#else
+   std::size_t committed = m_committed_refinements;
+#endif
+   // The rows we have already must be identical to those read, otherwise the table was written for a different precision:
+   for (std::size_t row = 0; (row <= committed) && (row < abscissas.size()); ++row)
+   {
+      if ((abscissas[row] != m_abscissas[row]) || (weights[row] != m_weights[row]))
+         return false;
+   }
+   for (std::size_t row = committed + 1; row < abscissas.size(); ++row)
+   {
+      m_abscissas[row].swap(abscissas[row]);
+      m_weights[row].swap(weights[row]);
+   }
+   // Only now are the new rows visible to other threads:
+   if (abscissas.size() > committed + 1)
+   {
+#if !defined(BOOST_MATH_NO_ATOMIC_INT) && defined(BOOST_HAS_THREADS)
+      m_committed_refinements = static_cast<boost::math::detail::atomic_unsigned_integer_type>(abscissas.size() - 1);
+#else
+      m_committed_refinements = static_cast<unsigned>(abscissas.size() - 1);
+#endif
+   }
+   return true;
+}
+
 template<class Real, class Policy>
 void exp_sinh_detail<Real, Policy>::init(const std::integral_constant<int, 0>&)
 {
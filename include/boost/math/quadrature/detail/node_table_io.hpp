@@ -0,0 +1,193 @@
+// Copyright Boost.Math contributors 2026.
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_QUADRATURE_DETAIL_NODE_TABLE_IO_HPP
+#define BOOST_MATH_QUADRATURE_DETAIL_NODE_TABLE_IO_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <boost/math/special_functions/sign.hpp>
+#include <boost/math/tools/precision.hpp>
+
+namespace boost{ namespace math{ namespace quadrature { namespace detail{
+
+//
+// The abscissas and weights of the double exponential quadratures are written as a header,
+// which identifies the quadrature and the floating point type, followed by the rows:
+//
+// "BMQNODES", uint32 version, uint32 byte order mark,
+// uint64 length of the name of the quadrature, followed by its characters,
+// uint64 encoding, sizeof(Real), digits and max_exponent of Real,
+// uint64 number of rows, then for each row the uint64 number of nodes, the abscissas and the weights.
+//
+// Integers are written in the byte order of the machine.  Trivially copyable binary types are
+// written as their object representation, so that a table written by one process can be read
+// by another with no conversions, and other types, such as the multiprecision types, as
+// length prefixed decimal strings with enough digits to round trip.
+//
+struct node_table_header
+{
+   static constexpr std::uint32_t version = 1;
+   static constexpr std::uint32_t byte_order_mark = 0x01020304;
+};
+
+template<class Real>
+using node_table_raw_encoding = std::integral_constant<bool,
+   std::is_trivially_copyable<Real>::value && std::numeric_limits<Real>::is_specialized && (std::numeric_limits<Real>::radix == 2)>;
+
+inline void write_node_table_integer(std::ostream& os, std::uint64_t i)
+{
+   os.write(reinterpret_cast<const char*>(&i), sizeof(i));
+}
+
+inline bool read_node_table_integer(std::istream& is, std::uint64_t& i)
+{
+   return static_cast<bool>(is.read(reinterpret_cast<char*>(&i), sizeof(i)));
+}
+
+template<class Real>
+void write_node_table_value(std::ostream& os, const Real& x, const std::true_type&)
+{
+   os.write(reinterpret_cast<const char*>(&x), sizeof(Real));
+}
+
+template<class Real>
+void write_node_table_value(std::ostream& os, const Real& x, const std::false_type&)
+{
+   std::ostringstream ss;
+   ss.imbue(std::locale::classic());
+   ss.precision(2 + boost::math::tools::digits<Real>() * 30103L / 100000L);
+   ss << std::scientific << x;
+   const std::string s = ss.str();
+   write_node_table_integer(os, s.size());
+   os.write(s.data(), static_cast<std::streamsize>(s.size()));
+}
+
+template<class Real>
+bool read_node_table_value(std::istream& is, Real& x, const std::true_type&)
+{
+   return static_cast<bool>(is.read(reinterpret_cast<char*>(&x), sizeof(Real)));
+}
+
+template<class Real>
+bool read_node_table_value(std::istream& is, Real& x, const std::false_type&)
+{
+   std::uint64_t n;
+   // No decimal representation of a number comes anywhere near this long:
+   if (!read_node_table_integer(is, n) || (n > 100000))
+      return false;
+   std::string s(static_cast<std::size_t>(n), ' ');
+   if (!is.read(&s[0], static_cast<std::streamsize>(n)))
+      return false;
+   std::istringstream ss(s);
+   ss.imbue(std::locale::classic());
+   if (!(ss >> x))
+      return false;
+   // Not every type preserves the sign of zero when reading, but the tanh_sinh tables depend on it:
+   if ((s[0] == '-') && !(boost::math::signbit)(x))
+      x = -x;
+   return true;
+}
+
+template<class Real>
+std::uint64_t node_table_digits()
+{
+   return static_cast<std::uint64_t>(boost::math::tools::digits<Real>());
+}
+
+template<class Real>
+void write_node_table(std::ostream& os, const char* name, const std::vector<std::vector<Real>>& abscissas, const std::vector<std::vector<Real>>& weights, std::size_t rows)
+{
+   typedef node_table_raw_encoding<Real> tag_type;
+   os.write("BMQNODES", 8);
+   std::uint32_t marks[2] = { node_table_header::version, node_table_header::byte_order_mark };
+   os.write(reinterpret_cast<const char*>(marks), sizeof(marks));
+   const std::size_t name_length = std::strlen(name);
+   write_node_table_integer(os, name_length);
+   os.write(name, static_cast<std::streamsize>(name_length));
+   write_node_table_integer(os, tag_type::value ? 0 : 1);
+   write_node_table_integer(os, sizeof(Real));
+   write_node_table_integer(os, node_table_digits<Real>());
+   write_node_table_integer(os, static_cast<std::uint64_t>(static_cast<std::int64_t>(std::numeric_limits<Real>::max_exponent)));
+   write_node_table_integer(os, rows);
+   for (std::size_t row = 0; row < rows; ++row)
+   {
+      write_node_table_integer(os, abscissas[row].size());
+      for (const Real& x : abscissas[row])
+         write_node_table_value(os, x, tag_type());
+      for (const Real& w : weights[row])
+         write_node_table_value(os, w, tag_type());
+   }
+}
+
+//
+// Reads a table written by write_node_table, returning false if it fails, or if the table was
+// written for a different quadrature or type.  At most max_rows rows are read:
+//
+template<class Real>
+bool read_node_table(std::istream& is, const char* name, std::vector<std::vector<Real>>& abscissas, std::vector<std::vector<Real>>& weights, std::size_t max_rows)
+{
+   typedef node_table_raw_encoding<Real> tag_type;
+   char magic[8];
+   std::uint32_t marks[2];
+   if (!is.read(magic, 8) || std::memcmp(magic, "BMQNODES", 8) || !is.read(reinterpret_cast<char*>(marks), sizeof(marks)))
+      return false;
+   if ((marks[0] != node_table_header::version) || (marks[1] != node_table_header::byte_order_mark))
+      return false;
+   std::uint64_t name_length;
+   if (!read_node_table_integer(is, name_length) || (name_length != std::strlen(name)))
+      return false;
+   std::string stored_name(static_cast<std::size_t>(name_length), ' ');
+   if (!is.read(&stored_name[0], static_cast<std::streamsize>(name_length)) || (stored_name != name))
+      return false;
+   std::uint64_t key[4];
+   const std::uint64_t expected[4] = { tag_type::value ? 0u : 1u, sizeof(Real), node_table_digits<Real>(),
+      static_cast<std::uint64_t>(static_cast<std::int64_t>(std::numeric_limits<Real>::max_exponent)) };
+   for (std::size_t i = 0; i < 4; ++i)
+   {
+      if (!read_node_table_integer(is, key[i]) || (key[i] != expected[i]))
+         return false;
+   }
+   std::uint64_t rows;
+   if (!read_node_table_integer(is, rows))
+      return false;
+   if (rows > max_rows)
+      rows = max_rows;
+   abscissas.assign(static_cast<std::size_t>(rows), std::vector<Real>());
+   weights.assign(static_cast<std::size_t>(rows), std::vector<Real>());
+   for (std::size_t row = 0; row < rows; ++row)
+   {
+      std::uint64_t n;
+      // Each row is at most twice the length of the one before:
+      if (!read_node_table_integer(is, n) || (row && (n > 2 * abscissas[row - 1].size() + 2)) || (!row && (n > 100000)))
+         return false;
+      abscissas[row].resize(static_cast<std::size_t>(n));
+      weights[row].resize(static_cast<std::size_t>(n));
+      for (Real& x : abscissas[row])
+      {
+         if (!read_node_table_value(is, x, tag_type()))
+            return false;
+      }
+      for (Real& w : weights[row])
+      {
+         if (!read_node_table_value(is, w, tag_type()))
+            return false;
+      }
+   }
+   return true;
+}
+
+}}}} // namespaces
+
+#endif
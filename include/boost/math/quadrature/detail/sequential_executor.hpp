@@ -0,0 +1,36 @@
+//  Copyright Boost.Math contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_QUADRATURE_DETAIL_SEQUENTIAL_EXECUTOR_HPP
+#define BOOST_MATH_QUADRATURE_DETAIL_SEQUENTIAL_EXECUTOR_HPP
+
+#include <cstddef>
+
+namespace boost { namespace math { namespace quadrature { namespace detail {
+
+//
+// An executor, in the sense of boost/math/statistics/detail/executor.hpp, which
+// runs each task one after another on the calling thread.  The quadrature
+// routines which can evaluate their integrand concurrently use this when no
+// executor is supplied.
+//
+struct sequential_executor
+{
+   unsigned concurrency() const
+   {
+      return 1;
+   }
+
+   template<class F>
+   void bulk_execute(std::size_t n, F&& f) const
+   {
+      for (std::size_t i = 0; i < n; ++i)
+         f(i);
+   }
+};
+
+}}}} // namespaces
+
+#endif // BOOST_MATH_QUADRATURE_DETAIL_SEQUENTIAL_EXECUTOR_HPP
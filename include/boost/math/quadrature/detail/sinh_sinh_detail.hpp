@@ -11,6 +11,7 @@
 #include <string>
 #include <vector>
 #include <typeinfo>
+#include <boost/math/quadrature/detail/batch_integrand.hpp>
 #include <boost/math/constants/constants.hpp>
 #include <boost/math/tools/atomic.hpp>
 #include <boost/math/policies/error_handling.hpp>
@@ -50,6 +51,19 @@ public:
     auto integrate(const F f, Real tolerance, Real* error, Real* L1, std::size_t* levels) const ->decltype(std::declval<F>()(std::declval<Real>()));
 
 private:
+   // Evaluates a batch integrand at each x and -x in row, and stores the values as interleaved pairs in values:
+   template<class F, class K>
+   void evaluate_batch_row(const F& f, const std::vector<Real>& row, std::vector<K>& values)const
+   {
+      std::vector<Real> x(2 * row.size());
+      for (std::size_t j = 0; j < row.size(); ++j)
+      {
+         x[2 * j] = row[j];
+         x[2 * j + 1] = -row[j];
+      }
+      values.resize(x.size());
+      evaluate_points(f, x.size(), values.data(), x.data());
+   }
 
    const std::vector<Real>& get_abscissa_row(std::size_t n)const
    {
@@ -177,11 +191,19 @@ auto sinh_sinh_detail<Real, Policy>::integrate(const F f, Real tolerance, Real*
     // Get the party started with two estimates of the integral:
     K I0 = f(0)*half_pi<Real>();
     Real L1_I0 = abs(I0);
+    //
+    // A batch integrand is evaluated at all the points of each row in a single call,
+    // even though later rows may be cut short below, and the values stored here:
+    //
+    const bool batch = is_batch_integrand<F>::value;
+    std::vector<K> row_values;
+    if (batch)
+       evaluate_batch_row(f, m_abscissas[0], row_values);
     for(size_t i = 0; i < m_abscissas[0].size(); ++i)
     {
         Real x = m_abscissas[0][i];
-        K yp = f(x);
-        K ym = f(-x);
+        K yp = batch ? row_values[2 * i] : f(x);
+        K ym = batch ? row_values[2 * i + 1] : f(-x);
         I0 += (yp + ym)*m_weights[0][i];
         L1_I0 += (abs(yp)+abs(ym))*m_weights[0][i];
     }
@@ -191,11 +213,13 @@ auto sinh_sinh_detail<Real, Policy>::integrate(const F f, Real tolerance, Real*
     // std::cout << "First estimate : " << I0 << std::endl;
     K I1 = I0;
     Real L1_I1 = L1_I0;
+    if (batch)
+       evaluate_batch_row(f, m_abscissas[1], row_values);
     for (size_t i = 0; i < m_abscissas[1].size(); ++i)
     {
         Real x= m_abscissas[1][i];
-        K yp = f(x);
-        K ym = f(-x);
+        K yp = batch ? row_values[2 * i] : f(x);
+        K ym = batch ? row_values[2 * i + 1] : f(-x);
         I1 += (yp + ym)*m_weights[1][i];
         L1_I1 += (abs(yp) + abs(ym))*m_weights[1][i];
     }
@@ -223,11 +247,13 @@ auto sinh_sinh_detail<Real, Policy>::integrate(const F f, Real tolerance, Real*
         auto abscissa_row = get_abscissa_row(i);
         auto weight_row = get_weight_row(i);
 
+        if (batch)
+           evaluate_batch_row(f, abscissa_row, row_values);
         for(size_t j = 0; j < abscissa_row.size(); ++j)
         {
             Real x = abscissa_row[j];
-            K yp = f(x);
-            K ym = f(-x);
+            K yp = batch ? row_values[2 * j] : f(x);
+            K ym = batch ? row_values[2 * j + 1] : f(-x);
             sum += (yp + ym)*weight_row[j];
             Real abterm0 = (abs(yp) + abs(ym))*weight_row[j];
             absum += abterm0;
@@ -7,9 +7,15 @@
 #ifndef BOOST_MATH_QUADRATURE_DETAIL_TANH_SINH_DETAIL_HPP
 #define BOOST_MATH_QUADRATURE_DETAIL_TANH_SINH_DETAIL_HPP
 
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <vector>
 #include <typeinfo>
+#include <boost/math/quadrature/detail/batch_integrand.hpp>
+#include <boost/math/quadrature/detail/node_table_io.hpp>
+#include <boost/math/quadrature/detail/sequential_executor.hpp>
+#include <boost/math/quadrature/detail/vector_value.hpp>
 #include <boost/math/tools/atomic.hpp>
 #include <boost/math/constants/constants.hpp>
 #include <boost/math/special_functions/next.hpp>
@@ -21,7 +27,6 @@
 
 namespace boost{ namespace math{ namespace quadrature { namespace detail{
 
-
 // Returns the tanh-sinh quadrature of a function f over the open interval (-1, 1)
 
 template<class Real, class Policy>
@@ -49,7 +54,26 @@ public:
     }
 
     template<class F>
-    decltype(std::declval<F>()(std::declval<Real>(), std::declval<Real>())) integrate(const F f, Real* error, Real* L1, const char* function, Real left_min_complement, Real right_min_complement, Real tolerance, std::size_t* levels) const;
+    decltype(std::declval<F>()(std::declval<Real>(), std::declval<Real>())) integrate(const F f, Real* error, Real* L1, const char* function, Real left_min_complement, Real right_min_complement, Real tolerance, std::size_t* levels) const
+    {
+       sequential_executor exec;
+       return integrate(f, error, L1, function, left_min_complement, right_min_complement, tolerance, levels, exec);
+    }
+    //
+    // As above, but the points of each refinement level are evaluated as
+    // exec.bulk_execute tasks whenever exec.concurrency() > 1.  The sums are
+    // always formed in the same order, so the result does not depend on the
+    // executor:
+    //
+    template<class F, class Executor>
+    decltype(std::declval<F>()(std::declval<Real>(), std::declval<Real>())) integrate(const F f, Real* error, Real* L1, const char* function, Real left_min_complement, Real right_min_complement, Real tolerance, std::size_t* levels, Executor& exec) const;
+
+    //
+    // Writes the rows computed so far to os, and adopts the rows read from is which
+    // we have not yet computed, see node_table_io.hpp:
+    //
+    void save_nodes(std::ostream& os)const;
+    bool load_nodes(std::istream& is)const;
 
 private:
    const std::vector<Real>& get_abscissa_row(std::size_t n)const
@@ -92,6 +116,50 @@ private:
       return m_first_complements[n];
    }
 
+   //
+   // Evaluates a batch integrand at the right hand points (x_j, -xc_j) for j < right_end,
+   // and the left hand points (-x_j, xc_j) for j < left_end, of the entries [begin, end)
+   // of row, and stores the values as interleaved pairs in values:
+   //
+   template<class F, class R>
+   void evaluate_batch_row(const F& f, const std::vector<Real>& row, std::size_t begin, std::size_t end, std::size_t right_end, std::size_t left_end, std::vector<R>& values)const
+   {
+      std::vector<Real> t, tc;
+      t.reserve(2 * end);
+      tc.reserve(2 * end);
+      for (std::size_t j = begin; j < end; ++j)
+      {
+         Real x = row[j];
+         Real xc = x;
+         if ((boost::math::signbit)(x))
+            // We have stored x - 1:
+            x = 1 + xc;
+         else
+            xc = x - 1;
+         if (j < right_end)
+         {
+            t.push_back(x);
+            tc.push_back(-xc);
+         }
+         if (j < left_end)
+         {
+            t.push_back(-x);
+            tc.push_back(xc);
+         }
+      }
+      std::vector<R> y(t.size());
+      evaluate_points(f, t.size(), y.data(), t.data(), tc.data());
+      values.assign(2 * end, R(0));
+      std::size_t k = 0;
+      for (std::size_t j = begin; j < end; ++j)
+      {
+         if (j < right_end)
+            values[2 * j] = y[k++];
+         if (j < left_end)
+            values[2 * j + 1] = y[k++];
+      }
+   }
+
    void init(const Real& min_complement, const std::integral_constant<int, 0>&);
    void init(const Real& min_complement, const std::integral_constant<int, 1>&);
    void init(const Real& min_complement, const std::integral_constant<int, 2>&);
@@ -188,8 +256,8 @@ private:
 };
 
 template<class Real, class Policy>
-template<class F>
-decltype(std::declval<F>()(std::declval<Real>(), std::declval<Real>())) tanh_sinh_detail<Real, Policy>::integrate(const F f, Real* error, Real* L1, const char* function, Real left_min_complement, Real right_min_complement, Real tolerance, std::size_t* levels) const
+template<class F, class Executor>
+decltype(std::declval<F>()(std::declval<Real>(), std::declval<Real>())) tanh_sinh_detail<Real, Policy>::integrate(const F f, Real* error, Real* L1, const char* function, Real left_min_complement, Real right_min_complement, Real tolerance, std::size_t* levels, Executor& exec) const
 {
     using std::abs;
     using std::fabs;
@@ -289,6 +357,17 @@ decltype(std::declval<F>()(std::declval<Real>(), std::declval<Real>())) tanh_sin
     BOOST_MATH_ASSERT(m_abscissas[0][max_left_position] < 0);
     BOOST_MATH_ASSERT(m_abscissas[0][max_right_position] < 0);
 
+    //
+    // A batch integrand is evaluated at all the points of each row in a single
+    // call, and when the executor is concurrent f(x_i) and f(-x_i) for each row
+    // after the first are computed up front as executor tasks.  Either way the
+    // values are stored here as interleaved pairs:
+    //
+    const bool batch = is_batch_integrand<F>::value;
+    std::vector<result_type> row_values;
+    if (batch)
+       evaluate_batch_row(f, m_abscissas[0], 1, (std::min)(m_abscissas[0].size(), (std::max)(max_left_position, max_right_position)), max_right_position, max_left_position, row_values);
+
     for(size_t i = 1; i < m_abscissas[0].size(); ++i)
     {
         if ((i >= max_right_position) && (i >= max_left_position))
@@ -303,8 +382,16 @@ decltype(std::declval<F>()(std::declval<Real>(), std::declval<Real>())) tanh_sin
         }
         else
            xc = x - 1;
-        yp = i < max_right_position ? f(x, -xc) : 0;
-        ym = i < max_left_position ? f(-x, xc) : 0;
+        if (batch)
+        {
+           yp = row_values[2 * i];
+           ym = row_values[2 * i + 1];
+        }
+        else
+        {
+           yp = i < max_right_position ? f(x, -xc) : 0;
+           ym = i < max_left_position ? f(-x, xc) : 0;
+        }
         I0 += (yp + ym)*w;
         L1_I0 += (abs(yp) + abs(ym))*w;
     }
@@ -324,6 +411,7 @@ decltype(std::declval<F>()(std::declval<Real>(), std::declval<Real>())) tanh_sin
     // rather than decreased, if this gets too high we abort...
     //
     unsigned thrash_count = 0;
+    const unsigned concurrency = exec.concurrency();
 
     while (k < 4 || (k < m_weights.size() && k < m_max_refinements) )
     {
@@ -414,15 +502,10 @@ decltype(std::declval<F>()(std::declval<Real>(), std::declval<Real>())) tanh_sin
         //
         endpoint_error = absum;
 
-        for(size_t j = 0; j < weight_row.size(); ++j)
+        auto evaluate = [&](std::size_t j, result_type& right, result_type& left)
         {
-            // If both left and right abscissa values are out of bounds at this step
-            // we can just stop this loop right now:
-            if ((j >= max_left_index) && (j >= max_right_index))
-                break;
             Real x = abscissa_row[j];
             Real xc = x;
-            Real w = weight_row[j];
             if (j >= first_complement_index)
             {
                // We have stored x - 1:
@@ -434,9 +517,36 @@ decltype(std::declval<F>()(std::declval<Real>(), std::declval<Real>())) tanh_sin
                BOOST_MATH_ASSERT(x >= 0);
                xc = x - 1;
             }
+            right = j >= max_right_index ? 0 : f(x, -xc);
+            left = j >= max_left_index ? 0 : f(-x, xc);
+        };
+        // Both left and right abscissa values are out of bounds from here on:
+        const std::size_t row_end = (std::min)(weight_row.size(), (std::max)(max_left_index, max_right_index));
+        const bool concurrent = !batch && (concurrency > 1) && (row_end > 1);
+        if (batch)
+            evaluate_batch_row(f, abscissa_row, 0, row_end, max_right_index, max_left_index, row_values);
+        else if (concurrent)
+        {
+            row_values.resize(2 * row_end);
+            // Interleaving the points spreads the cheap and expensive ends of the row over all tasks:
+            const std::size_t tasks = (std::min)(row_end, static_cast<std::size_t>(concurrency));
+            exec.bulk_execute(tasks, [&](std::size_t t)
+            {
+               for (std::size_t j = t; j < row_end; j += tasks)
+                  evaluate(j, row_values[2 * j], row_values[2 * j + 1]);
+            });
+        }
 
-            yp = j >= max_right_index ? 0 : f(x, -xc);
-            ym = j >= max_left_index ? 0 : f(-x, xc);
+        for(size_t j = 0; j < row_end; ++j)
+        {
+            Real w = weight_row[j];
+            if (batch || concurrent)
+            {
+               yp = row_values[2 * j];
+               ym = row_values[2 * j + 1];
+            }
+            else
+               evaluate(j, yp, ym);
             result_type term = (yp + ym)*w;
             sum += term;
 
@@ -557,6 +667,62 @@ decltype(std::declval<F>()(std::declval<Real>(), std::declval<Real>())) tanh_sin
     return I1;
 }
 
+template<class Real, class Policy>
+void tanh_sinh_detail<Real, Policy>::save_nodes(std::ostream& os)const
+{
+#if !defined(BOOST_MATH_NO_ATOMIC_INT) && defined(BOOST_HAS_THREADS)
+   std::lock_guard<std::mutex> guard(m_mutex);
+   std::size_t rows = m_committed_refinements.load() + 1;
+#else
+   std::size_t rows = m_committed_refinements + 1;
+#endif
+   write_node_table(os, "tanh_sinh", m_abscissas, m_weights, rows);
+}
+
+template<class Real, class Policy>
+bool tanh_sinh_detail<Real, Policy>::load_nodes(std::istream& is)const
+{
+   std::vector<std::vector<Real>> abscissas, weights;
+   if (!read_node_table(is, "tanh_sinh", abscissas, weights, m_abscissas.size()))
+      return false;
+#if !defined(BOOST_MATH_NO_ATOMIC_INT) && defined(BOOST_HAS_THREADS)
+   std::lock_guard<std::mutex> guard(m_mutex);
+   std::size_t committed = m_committed_refinements.load();
+#else
+   std::size_t committed = m_committed_refinements;
+#endif
+   //
+   // The rows we have already must be identical to those read, otherwise the table
+   // was written with a different min_complement or precision:
+   //
+   for (std::size_t row = 0; (row <= committed) && (row < abscissas.size()); ++row)
+   {
+      if ((abscissas[row] != m_abscissas[row]) || (weights[row] != m_weights[row]))
+         return false;
+   }
+   for (std::size_t row = committed + 1; row < abscissas.size(); ++row)
+   {
+      std::size_t first_complement = 0;
+      while ((first_complement < abscissas[row].size()) && !(boost::math::signbit)(abscissas[row][first_complement]))
+         ++first_complement;
+      m_abscissas[row].swap(abscissas[row]);
+      m_weights[row].swap(weights[row]);
+      m_first_complements[row] = first_complement;
+   }
+   //
+   // Only now are the new rows visible to other threads:
+   //
+   if (abscissas.size() > committed + 1)
+   {
+#if !defined(BOOST_MATH_NO_ATOMIC_INT) && defined(BOOST_HAS_THREADS)
+      m_committed_refinements = static_cast<boost::math::detail::atomic_unsigned_integer_type>(abscissas.size() - 1);
+#else
+      m_committed_refinements = static_cast<unsigned>(abscissas.size() - 1);
+#endif
+   }
+   return true;
+}
+
 template<class Real, class Policy>
 void tanh_sinh_detail<Real, Policy>::init(const Real& min_complement, const std::integral_constant<int, 0>&)
 {
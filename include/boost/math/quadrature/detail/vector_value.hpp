@@ -0,0 +1,211 @@
+//  Copyright Boost.Math contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_QUADRATURE_DETAIL_VECTOR_VALUE_HPP
+#define BOOST_MATH_QUADRATURE_DETAIL_VECTOR_VALUE_HPP
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <boost/math/tools/is_detected.hpp>
+
+namespace boost { namespace math { namespace quadrature { namespace detail {
+
+//
+// The value of an integrand returning std::array<Real, K>, with the arithmetic
+// the quadrature routines apply to their result type.  abs() is the max norm,
+// so that the error estimate, L1 norm and termination criterion of a vector
+// valued integral are those of its largest component.  Every component is
+// computed from the same evaluations, at the same nodes and weights.
+//
+template <typename Real, std::size_t K>
+class vector_value
+{
+public:
+   vector_value() : m_data() {}
+   // Conversion from a scalar sets every component, as used for zero and tolerances:
+   vector_value(const Real& x)
+   {
+      m_data.fill(x);
+   }
+   vector_value(const std::array<Real, K>& x) : m_data(x) {}
+
+   const std::array<Real, K>& data() const
+   {
+      return m_data;
+   }
+
+   vector_value& operator+=(const vector_value& x)
+   {
+      for (std::size_t i = 0; i < K; ++i)
+         m_data[i] += x.m_data[i];
+      return *this;
+   }
+   vector_value& operator-=(const vector_value& x)
+   {
+      for (std::size_t i = 0; i < K; ++i)
+         m_data[i] -= x.m_data[i];
+      return *this;
+   }
+   vector_value& operator*=(const Real& x)
+   {
+      for (std::size_t i = 0; i < K; ++i)
+         m_data[i] *= x;
+      return *this;
+   }
+   vector_value operator-() const
+   {
+      vector_value result(*this);
+      for (std::size_t i = 0; i < K; ++i)
+         result.m_data[i] = -m_data[i];
+      return result;
+   }
+
+   friend vector_value operator+(vector_value a, const vector_value& b)
+   {
+      return a += b;
+   }
+   friend vector_value operator-(vector_value a, const vector_value& b)
+   {
+      return a -= b;
+   }
+   friend vector_value operator*(vector_value a, const Real& b)
+   {
+      return a *= b;
+   }
+   friend vector_value operator*(const Real& a, vector_value b)
+   {
+      return b *= a;
+   }
+   friend vector_value operator/(const Real& a, const vector_value& b)
+   {
+      vector_value result;
+      for (std::size_t i = 0; i < K; ++i)
+         result.m_data[i] = a / b.m_data[i];
+      return result;
+   }
+
+   friend Real abs(const vector_value& x)
+   {
+      using std::abs;
+      Real result = 0;
+      for (std::size_t i = 0; i < K; ++i)
+      {
+         Real a = abs(x.m_data[i]);
+         if ((boost::math::isnan)(a))
+            return a;
+         if (a > result)
+            result = a;
+      }
+      return result;
+   }
+
+   friend std::ostream& operator<<(std::ostream& os, const vector_value& x)
+   {
+      os << "(";
+      for (std::size_t i = 0; i < K; ++i)
+         os << (i ? ", " : "") << x.m_data[i];
+      return os << ")";
+   }
+
+private:
+   std::array<Real, K> m_data;
+};
+
+template <typename T>
+struct is_std_array : std::false_type {};
+
+template <typename Real, std::size_t K>
+struct is_std_array<std::array<Real, K>> : std::true_type {};
+
+template <typename T>
+struct vector_value_of {};
+
+template <typename Real, std::size_t K>
+struct vector_value_of<std::array<Real, K>>
+{
+   using type = vector_value<Real, K>;
+};
+
+// Adapts an integrand returning std::array<Real, K> to one returning vector_value<Real, K>:
+template <typename F>
+class vector_integrand
+{
+public:
+   explicit vector_integrand(const F& f) : m_f(f) {}
+
+   template <typename... Args>
+   auto operator()(const Args&... args) const -> typename vector_value_of<decltype(std::declval<const F&>()(args...))>::type
+   {
+      return m_f(args...);
+   }
+
+private:
+   const F& m_f;
+};
+
+template <typename Real, typename F>
+using unary_result_t = decltype(std::declval<const F&>()(std::declval<Real>()));
+
+template <typename Real, typename F>
+using binary_result_t = decltype(std::declval<const F&>()(std::declval<Real>(), std::declval<Real>()));
+
+// True when F, called with one or two Real arguments, returns a std::array:
+template <typename Real, typename F>
+struct is_vector_integrand
+{
+   static constexpr bool value = is_std_array<boost::math::tools::detected_t<unary_result_t, Real, F>>::value
+      || is_std_array<boost::math::tools::detected_t<binary_result_t, Real, F>>::value;
+};
+
+//
+// The quadrature routines pass their integrand through make_vector_integrand,
+// which wraps it only when it returns a std::array, and their result through
+// vector_result, which unwraps it again:
+//
+template <typename Real, typename F>
+inline typename std::enable_if<!is_vector_integrand<Real, F>::value, const F&>::type make_vector_integrand(const F& f)
+{
+   return f;
+}
+
+template <typename Real, typename F>
+inline typename std::enable_if<is_vector_integrand<Real, F>::value, vector_integrand<F>>::type make_vector_integrand(const F& f)
+{
+   return vector_integrand<F>(f);
+}
+
+template <typename T>
+inline const T& vector_result(const T& x)
+{
+   return x;
+}
+
+template <typename Real, std::size_t K>
+inline const std::array<Real, K>& vector_result(const vector_value<Real, K>& x)
+{
+   return x.data();
+}
+
+}} // namespace quadrature::detail
+
+template <typename Real, std::size_t K>
+inline bool (isfinite)(const quadrature::detail::vector_value<Real, K>& x)
+{
+   for (std::size_t i = 0; i < K; ++i)
+   {
+      if (!(boost::math::isfinite)(x.data()[i]))
+         return false;
+   }
+   return true;
+}
+
+}} // namespaces
+
+#endif // BOOST_MATH_QUADRATURE_DETAIL_VECTOR_VALUE_HPP
@@ -19,10 +19,28 @@
 #include <limits>
 #include <memory>
 #include <string>
+#include <type_traits>
+#include <utility>
 #include <boost/math/quadrature/detail/exp_sinh_detail.hpp>
 
 namespace boost{ namespace math{ namespace quadrature {
 
+namespace detail {
+
+// Maps t in (0, infinity) to limit + t when sign is 1, and limit - t when it is -1:
+template <class Real>
+struct exp_sinh_shift_transform
+{
+   Real limit;
+   Real sign;
+   std::pair<Real, Real> operator()(const Real& t) const
+   {
+      return std::pair<Real, Real>(limit + sign * t, 1);
+   }
+};
+
+}
+
 template<class Real, class Policy = policies::policy<> >
 class exp_sinh
 {
@@ -35,7 +53,28 @@ public:
     template<class F>
     auto integrate(const F& f, Real tol = boost::math::tools::root_epsilon<Real>(), Real* error = nullptr, Real* L1 = nullptr, std::size_t* levels = nullptr) const ->decltype(std::declval<F>()(std::declval<Real>()));
 
+    //
+    // Overloads for batch integrands f(const Real* x, Real* y, std::size_t n), which set
+    // y[i] to the value of the integrand at x[i], and are passed a whole row of abscissas at a time:
+    //
+    template<class F>
+    auto integrate(const F& f, Real a, Real b, Real tol = boost::math::tools::root_epsilon<Real>(), Real* error = nullptr, Real* L1 = nullptr, std::size_t* levels = nullptr) const ->typename std::enable_if<detail::is_batch_callable<Real, F>::value, Real>::type;
+    template<class F>
+    auto integrate(const F& f, Real tol = boost::math::tools::root_epsilon<Real>(), Real* error = nullptr, Real* L1 = nullptr, std::size_t* levels = nullptr) const ->typename std::enable_if<detail::is_batch_callable<Real, F>::value, Real>::type;
+
+    //
+    // Writes the abscissas and weights computed so far to a binary stream, and reads them back, so that
+    // the nodes for a high precision type need only be computed once.  load_nodes returns false, and
+    // changes nothing, unless the stream was written by save_nodes for the same type:
+    //
+    void save_nodes(std::ostream& os) const { m_imp->save_nodes(os); }
+    bool load_nodes(std::istream& is) { return m_imp->load_nodes(is); }
+
 private:
+    // The changes of variables for the limits of integration, for ordinary and batch integrands, whose values are of type K:
+    template<class K, class F>
+    K integrate_over_limits(const F& f, Real a, Real b, Real tolerance, Real* error, Real* L1, std::size_t* levels) const;
+
     std::shared_ptr<detail::exp_sinh_detail<Real, Policy>> m_imp;
 };
 
@@ -46,9 +85,14 @@ auto exp_sinh<Real, Policy>::integrate(const F& f, Real a, Real b, Real toleranc
     typedef decltype(f(a)) K;
     static_assert(!std::is_integral<K>::value,
                   "The return type cannot be integral, it must be either a real or complex floating point type.");
-    using std::abs;
-    using boost::math::constants::half;
-    using boost::math::quadrature::detail::exp_sinh_detail;
+    return integrate_over_limits<K>(f, a, b, tolerance, error, L1, levels);
+}
+
+template<class Real, class Policy>
+template<class K, class F>
+K exp_sinh<Real, Policy>::integrate_over_limits(const F& f, Real a, Real b, Real tolerance, Real* error, Real* L1, std::size_t* levels) const
+{
+    using boost::math::quadrature::detail::make_transformed_integrand;
 
     static const char* function = "boost::math::quadrature::exp_sinh<%1%>::integrate";
 
@@ -63,16 +107,16 @@ auto exp_sinh<Real, Policy>::integrate(const F& f, Real a, Real b, Real toleranc
         // If a = 0, don't use an additional level of indirection:
         if (a == static_cast<Real>(0))
         {
-            return m_imp->integrate(f, error, L1, function, tolerance, levels);
+            return m_imp->integrate(make_transformed_integrand<Real>(f, detail::identity_transform<Real>()), error, L1, function, tolerance, levels);
         }
-        const auto u = [&](Real t)->K { return f(t + a); };
-        return m_imp->integrate(u, error, L1, function, tolerance, levels);
+        detail::exp_sinh_shift_transform<Real> transform = { a, Real(1) };
+        return m_imp->integrate(make_transformed_integrand<Real>(f, transform), error, L1, function, tolerance, levels);
     }
 
     if ((boost::math::isfinite)(b) && a <= -boost::math::tools::max_value<Real>())
     {
-        const auto u = [&](Real t)->K { return f(b-t);};
-        return m_imp->integrate(u, error, L1, function, tolerance, levels);
+        detail::exp_sinh_shift_transform<Real> transform = { b, Real(-1) };
+        return m_imp->integrate(make_transformed_integrand<Real>(f, transform), error, L1, function, tolerance, levels);
     }
 
     // Infinite limits:
@@ -97,6 +141,26 @@ auto exp_sinh<Real, Policy>::integrate(const F& f, Real tolerance, Real* error,
     return m_imp->integrate(f, error, L1, function, tolerance, levels);
 }
 
+template<class Real, class Policy>
+template<class F>
+auto exp_sinh<Real, Policy>::integrate(const F& f, Real a, Real b, Real tolerance, Real* error, Real* L1, std::size_t* levels) const ->typename std::enable_if<detail::is_batch_callable<Real, F>::value, Real>::type
+{
+    return integrate_over_limits<Real>(f, a, b, tolerance, error, L1, levels);
+}
+
+template<class Real, class Policy>
+template<class F>
+auto exp_sinh<Real, Policy>::integrate(const F& f, Real tolerance, Real* error, Real* L1, std::size_t* levels) const ->typename std::enable_if<detail::is_batch_callable<Real, F>::value, Real>::type
+{
+    static const char* function = "boost::math::quadrature::exp_sinh<%1%>::integrate";
+    using std::abs;
+    if (abs(tolerance) > 1) {
+        std::string msg = std::string(__FILE__) + ":" + std::to_string(__LINE__) + ":" + std::string(function) + ": The tolerance provided is unusually large; did you confuse it with a domain bound?";
+        throw std::domain_error(msg);
+    }
+    const auto u = detail::make_transformed_integrand<Real>(f, detail::identity_transform<Real>());
+    return m_imp->integrate(u, error, L1, function, tolerance, levels);
+}
 
 }}}
 #endif
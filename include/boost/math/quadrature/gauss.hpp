@@ -10,10 +10,14 @@
 #pragma once
 #endif
 
+#include <array>
 #include <limits>
+#include <type_traits>
+#include <utility>
 #include <vector>
 #include <boost/math/special_functions/legendre.hpp>
 #include <boost/math/constants/constants.hpp>
+#include <boost/math/quadrature/detail/batch_integrand.hpp>
 
 #ifdef _MSC_VER
 #pragma warning(push)
@@ -1165,6 +1169,119 @@ public:
    }
 };
 
+//
+// The changes of variables onto (-1, 1) used for infinite ranges: each returns
+// the abscissa and the Jacobian at t.
+//
+template <class Real>
+struct gauss_infinite_transform
+{
+   std::pair<Real, Real> operator()(const Real& t) const
+   {
+      Real t_sq = t*t;
+      Real inv = 1 / (1 - t_sq);
+      return std::pair<Real, Real>(t*inv, (1 + t_sq)*inv*inv);
+   }
+};
+
+template <class Real>
+struct gauss_right_infinite_transform
+{
+   Real a;
+   std::pair<Real, Real> operator()(const Real& t) const
+   {
+      Real z = 1 / (t + 1);
+      return std::pair<Real, Real>(2 * z + a - 1, z*z);
+   }
+};
+
+template <class Real>
+struct gauss_left_infinite_transform
+{
+   Real b;
+   std::pair<Real, Real> operator()(const Real& t) const
+   {
+      Real z = 1 / (t + 1);
+      Real arg = 2 * z - 1;
+      return std::pair<Real, Real>(b - arg, z*z);
+   }
+};
+
+//
+// Applies the change of variables for the limits [a, b], shared by the Gauss and
+// Gauss-Kronrod rules for ordinary and batch integrands.  rule(g, lower, upper)
+// integrates g over [lower, upper], and sets *pL1; the values of f are of type K.
+//
+template <class Real, class Policy, class K, class F, class Rule>
+K integrate_over_limits(const F& f, Real a, Real b, Real* pL1, const char* function, const Rule& rule)
+{
+   if (!(boost::math::isnan)(a) && !(boost::math::isnan)(b))
+   {
+      // Infinite limits:
+      if ((a <= -tools::max_value<Real>()) && (b >= tools::max_value<Real>()))
+      {
+         return rule(make_transformed_integrand<Real>(f, gauss_infinite_transform<Real>()), Real(-1), Real(1));
+      }
+
+      // Right limit is infinite:
+      if ((boost::math::isfinite)(a) && (b >= tools::max_value<Real>()))
+      {
+         gauss_right_infinite_transform<Real> transform = { a };
+         K Q = Real(2) * rule(make_transformed_integrand<Real>(f, transform), Real(-1), Real(1));
+         if (pL1)
+         {
+            *pL1 *= 2;
+         }
+         return Q;
+      }
+
+      if ((boost::math::isfinite)(b) && (a <= -tools::max_value<Real>()))
+      {
+         gauss_left_infinite_transform<Real> transform = { b };
+         K Q = Real(2) * rule(make_transformed_integrand<Real>(f, transform), Real(-1), Real(1));
+         if (pL1)
+         {
+            *pL1 *= 2;
+         }
+         return Q;
+      }
+
+      if ((boost::math::isfinite)(a) && (boost::math::isfinite)(b))
+      {
+         if (a == b)
+         {
+            return K(0);
+         }
+         auto g = make_transformed_integrand<Real>(f, identity_transform<Real>());
+         if (b < a)
+         {
+            return -rule(g, b, a);
+         }
+         return rule(g, a, b);
+      }
+   }
+   return static_cast<K>(policies::raise_domain_error(function, "The domain of integration is not sensible; please check the bounds.", a, Policy()));
+}
+
+//
+// Sets t to the nodes of a symmetric rule with non-negative abscissas x, mapped
+// to mean + scale * x: the node at zero first when there is one, then the
+// positive nodes, then their reflections, so that each pair of values can be
+// combined from two contiguous runs.
+//
+template <class Real, std::size_t N, class Abscissa>
+inline void symmetric_nodes(const Abscissa& x, unsigned start, Real mean, Real scale, std::array<Real, N>& t)
+{
+   const unsigned pairs = static_cast<unsigned>(x.size()) - start;
+   if (start)
+      t[0] = mean;
+   for (unsigned i = 0; i < pairs; ++i)
+   {
+      t[start + i] = scale * x[start + i] + mean;
+      t[start + pairs + i] = scale * -x[start + i] + mean;
+   }
+}
+
 }
 
 template <class Real, unsigned N, class Policy = boost::math::policies::policy<> >
@@ -1203,89 +1320,81 @@ public:
          *pL1 = L1;
       return result;
    }
+   //
+   // Batch integrands, f(const Real* x, Real* y, std::size_t n), are evaluated at
+   // all N nodes in a single call:
+   //
    template <class F>
-   static auto integrate(F f, Real a, Real b, Real* pL1 = nullptr)->decltype(std::declval<F>()(std::declval<Real>()))
+   static auto integrate(F f, Real* pL1 = nullptr)->typename std::enable_if<detail::is_batch_callable<Real, F>::value, Real>::type
+   {
+      return integrate_batch(detail::make_batch_integrand<Real>(f, detail::identity_transform<Real>()), Real(0), Real(1), pL1);
+   }
+   template <class F>
+   static auto integrate(F f, Real a, Real b, Real* pL1 = nullptr)->typename std::enable_if<detail::is_batch_callable<Real, F>::value, Real>::type
    {
-      typedef decltype(f(a)) K;
       static const char* function = "boost::math::quadrature::gauss<%1%>::integrate(f, %1%, %1%)";
-      if (!(boost::math::isnan)(a) && !(boost::math::isnan)(b))
+      return detail::integrate_over_limits<Real, Policy, Real>(f, a, b, pL1, function, [pL1](const auto& g, Real lower, Real upper)
       {
-         // Infinite limits:
-         Real min_inf = -tools::max_value<Real>();
-         if ((a <= min_inf) && (b >= tools::max_value<Real>()))
+         Real avg = (lower + upper)*constants::half<Real>();
+         Real scale = (upper - lower)*constants::half<Real>();
+         Real Q = scale*integrate_batch(g, avg, scale, pL1);
+         if (pL1)
          {
-            auto u = [&](const Real& t)->K
-            {
-               Real t_sq = t*t;
-               Real inv = 1 / (1 - t_sq);
-               K res = f(t*inv)*(1 + t_sq)*inv*inv;
-               return res;
-            };
-            return integrate(u, pL1);
+            *pL1 *= scale;
          }
-
-         // Right limit is infinite:
-         if ((boost::math::isfinite)(a) && (b >= tools::max_value<Real>()))
+         return Q;
+      });
+   }
+   template <class F>
+   static auto integrate(F f, Real a, Real b, Real* pL1 = nullptr)->decltype(std::declval<F>()(std::declval<Real>()))
+   {
+      typedef decltype(f(a)) K;
+      static const char* function = "boost::math::quadrature::gauss<%1%>::integrate(f, %1%, %1%)";
+      return detail::integrate_over_limits<Real, Policy, K>(f, a, b, pL1, function, [pL1](const auto& g, Real lower, Real upper)->K
+      {
+         Real avg = (lower + upper)*constants::half<Real>();
+         Real scale = (upper - lower)*constants::half<Real>();
+         auto u = [&](Real z)->K
          {
-            auto u = [&](const Real& t)->K
-            {
-               Real z = 1 / (t + 1);
-               Real arg = 2 * z + a - 1;
-               K res = f(arg)*z*z;
-               return res;
-            };
-            K Q = Real(2) * integrate(u, pL1);
-            if (pL1)
-            {
-               *pL1 *= 2;
-            }
-            return Q;
-         }
-
-         if ((boost::math::isfinite)(b) && (a <= -tools::max_value<Real>()))
+            return g(avg + scale*z);
+         };
+         K Q = scale*integrate(u, pL1);
+         if (pL1)
          {
-            auto v = [&](const Real& t)->K
-            {
-               Real z = 1 / (t + 1);
-               Real arg = 2 * z - 1;
-               K res = f(b - arg) * z * z;
-               return res;
-            };
-            K Q = Real(2) * integrate(v, pL1);
-            if (pL1)
-            {
-               *pL1 *= 2;
-            }
-            return Q;
+            *pL1 *= scale;
          }
+         return Q;
+      });
+   }
 
-         if ((boost::math::isfinite)(a) && (boost::math::isfinite)(b))
-         {
-            if (a == b)
-            {
-               return K(0);
-            }
-            if (b < a)
-            {
-               return -integrate(f, b, a, pL1);
-            }
-            Real avg = (a + b)*constants::half<Real>();
-            Real scale = (b - a)*constants::half<Real>();
-
-            auto u = [&](Real z)->K
-            {
-               return f(avg + scale*z);
-            };
-            K Q = scale*integrate(u, pL1);
-
-            if (pL1)
-            {
-               *pL1 *= scale;
-            }
-            return Q;
-         }
+private:
+   //
+   // Applies the rule to g(mean + scale * x) over (-1, 1), evaluating all the nodes
+   // in one batch and then forming the weighted sums over the pairs of symmetric
+   // nodes, in the same order as the scalar loop above:
+   //
+   template <class G>
+   static Real integrate_batch(const G& g, Real mean, Real scale, Real* pL1)
+   {
+      using std::abs;
+      const unsigned start = (N & 1) ? 1 : 0;
+      const unsigned pairs = static_cast<unsigned>(base::abscissa().size()) - start;
+      std::array<Real, N> t;
+      std::array<Real, N> y;
+      detail::symmetric_nodes(base::abscissa(), start, mean, scale, t);
+      detail::evaluate_points(g, N, y.data(), t.data());
+      Real result = start ? Real(y[0] * base::weights()[0]) : Real(0);
+      Real L1 = abs(result);
+      const Real* yp = y.data() + start;
+      const Real* ym = yp + pairs;
+      for (unsigned i = 0; i < pairs; ++i)
+      {
+         result += (yp[i] + ym[i]) * base::weights()[start + i];
+         L1 += (abs(yp[i]) + abs(ym[i])) * base::weights()[start + i];
       }
-      return static_cast<K>(policies::raise_domain_error(function, "The domain of integration is not sensible; please check the bounds.", a, Policy()));
+      if (pL1)
+         *pL1 = L1;
+      return result;
    }
 };
 
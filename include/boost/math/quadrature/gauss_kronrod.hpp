@@ -19,6 +19,7 @@
 #include <boost/math/special_functions/legendre.hpp>
 #include <boost/math/special_functions/legendre_stieltjes.hpp>
 #include <boost/math/quadrature/gauss.hpp>
+#include <boost/math/quadrature/detail/vector_value.hpp>
 
 namespace boost { namespace math{ namespace quadrature{ namespace detail{
 
@@ -1820,6 +1821,55 @@ private:
       return kronrod_result;
    }
 
+   //
+   // As integrate_non_adaptive_m1_1, for a batch integrand g(mean + scale * x):
+   // all N nodes are evaluated in one call, and the Kronrod and Gauss sums are
+   // then formed over the pairs of symmetric nodes in the same order as above.
+   //
+   template <class G>
+   static Real integrate_batch_m1_1(const G& g, Real mean, Real scale, Real* error, Real* pL1)
+   {
+      using std::abs;
+      const unsigned pairs = static_cast<unsigned>(base::abscissa().size()) - 1;
+      std::array<Real, N> t;
+      std::array<Real, N> y;
+      detail::symmetric_nodes(base::abscissa(), 1, mean, scale, t);
+      detail::evaluate_points(g, N, y.data(), t.data());
+      const Real* yp = y.data();
+      const Real* ym = yp + pairs;
+      unsigned gauss_start = 2;
+      unsigned kronrod_start = 1;
+      unsigned gauss_order = (N - 1) / 2;
+      Real kronrod_result = y[0] * base::weights()[0];
+      Real gauss_result = 0;
+      if (gauss_order & 1)
+      {
+         gauss_result += y[0] * gauss<Real, (N - 1) / 2>::weights()[0];
+      }
+      else
+      {
+         gauss_start = 1;
+         kronrod_start = 2;
+      }
+      Real L1 = abs(kronrod_result);
+      for (unsigned i = gauss_start; i < base::abscissa().size(); i += 2)
+      {
+         kronrod_result += (yp[i] + ym[i]) * base::weights()[i];
+         L1 += (abs(yp[i]) + abs(ym[i])) *  base::weights()[i];
+         gauss_result += (yp[i] + ym[i]) * gauss<Real, (N - 1) / 2>::weights()[i / 2];
+      }
+      for (unsigned i = kronrod_start; i < base::abscissa().size(); i += 2)
+      {
+         kronrod_result += (yp[i] + ym[i]) * base::weights()[i];
+         L1 += (abs(yp[i]) + abs(ym[i])) *  base::weights()[i];
+      }
+      if (pL1)
+         *pL1 = L1;
+      if (error)
+         *error = (std::max)(static_cast<Real>(abs(kronrod_result - gauss_result)), static_cast<Real>(abs(kronrod_result * tools::epsilon<Real>() * Real(2))));
+      return kronrod_result;
+   }
+
    template <class F>
    struct recursive_info
    {
@@ -1827,6 +1877,24 @@ private:
       Real tol;
    };
 
+   // Applies the rule to info->f(scale * x + mean) over (-1, 1):
+   template <class F>
+   static auto apply_rule(const recursive_info<F>* info, Real mean, Real scale, Real* error, Real* L1, const std::false_type&)->decltype(std::declval<F>()(std::declval<Real>()))
+   {
+      typedef decltype(info->f(Real(mean))) K;
+      auto ff = [&](const Real& x)->K
+      {
+         return info->f(scale * x + mean);
+      };
+      return integrate_non_adaptive_m1_1(ff, error, L1);
+   }
+
+   template <class F>
+   static Real apply_rule(const recursive_info<F>* info, Real mean, Real scale, Real* error, Real* L1, const std::true_type&)
+   {
+      return integrate_batch_m1_1(info->f, mean, scale, error, L1);
+   }
+
    template <class F>
    static auto recursive_adaptive_integrate(const recursive_info<F>* info, Real a, Real b, unsigned max_levels, Real abs_tol, Real* error, Real* L1)->decltype(std::declval<F>()(std::declval<Real>()))
    {
@@ -1835,11 +1903,7 @@ private:
       Real error_local;
       Real mean = (b + a) / 2;
       Real scale = (b - a) / 2;
-      auto ff = [&](const Real& x)->K
-      {
-         return info->f(scale * x + mean);
-      };
-      K r1 = integrate_non_adaptive_m1_1(ff, &error_local, L1);
+      K r1 = apply_rule(info, mean, scale, &error_local, L1, detail::is_batch_integrand<F>());
       K estimate = scale * r1;
 
       K tmp = estimate * info->tol;
@@ -1866,84 +1930,159 @@ private:
       return estimate;
    }
 
-public:
+   // Estimates the integral over [a, b], a < b, from a single application of the rule:
    template <class F>
-   static auto integrate(F f, Real a, Real b, unsigned max_depth = 15, Real tol = tools::root_epsilon<Real>(), Real* error = nullptr, Real* pL1 = nullptr)->decltype(std::declval<F>()(std::declval<Real>()))
+   static auto integrate_subinterval(const recursive_info<F>* info, Real a, Real b, Real* error, Real* L1)->decltype(std::declval<F>()(std::declval<Real>()))
    {
-      typedef decltype(f(a)) K;
-      static_assert(!std::is_integral<K>::value,
-                  "The return type cannot be integral, it must be either a real or complex floating point type.");
-      static const char* function = "boost::math::quadrature::gauss_kronrod<%1%>::integrate(f, %1%, %1%)";
-      if (!(boost::math::isnan)(a) && !(boost::math::isnan)(b))
+      typedef decltype(info->f(Real(a))) K;
+      Real mean = (b + a) / 2;
+      Real scale = (b - a) / 2;
+      K result = scale * apply_rule(info, mean, scale, error, L1, detail::is_batch_integrand<F>());
+      *error *= scale;
+      *L1 *= scale;
+      return result;
+   }
+
+   template <class K>
+   struct subinterval
+   {
+      Real a;
+      Real b;
+      K value;
+      Real error;
+      Real L1;
+   };
+
+   //
+   // Globally adaptive integration, as in QUADPACK's qag: rather than refining every
+   // subinterval whose error exceeds its share of the tolerance, always bisect the
+   // one with the largest error estimate, until the total error is within tol of the
+   // L1 norm or there are max_intervals subintervals.  The tolerance is relative to
+   // the L1 norm rather than to the integral, else an integral which is zero (or
+   // nearly so) through cancellation would be refined until max_intervals is
+   // reached.  The subintervals are kept in a single store, the left half of a
+   // bisected interval reusing its parent's slot, with a max-heap of indices into
+   // it ordered by error estimate.
+   //
+   template <class F>
+   static auto global_adaptive_integrate(const recursive_info<F>* info, Real a, Real b, std::size_t max_intervals, Real* error, Real* L1)->decltype(std::declval<F>()(std::declval<Real>()))
+   {
+      typedef decltype(info->f(Real(a))) K;
+      using std::abs;
+      std::vector<subinterval<K> > intervals;
+      std::vector<std::size_t> heap;
+      intervals.reserve((std::min)(max_intervals, std::size_t(64)));
+      heap.reserve(intervals.capacity());
+      auto smaller_error = [&intervals](std::size_t i, std::size_t j)
       {
-         // Infinite limits:
-         if ((a <= -tools::max_value<Real>()) && (b >= tools::max_value<Real>()))
-         {
-            auto u = [&](const Real& t)->K
-            {
-               Real t_sq = t*t;
-               Real inv = 1 / (1 - t_sq);
-               Real w = (1 + t_sq)*inv*inv;
-               Real arg = t*inv;
-               K res = f(arg)*w;
-               return res;
-            };
-            recursive_info<decltype(u)> info = { u, tol };
-            K res = recursive_adaptive_integrate(&info, Real(-1), Real(1), max_depth, Real(0), error, pL1);
-            return res;
-         }
+         return intervals[i].error < intervals[j].error;
+      };
 
-         // Right limit is infinite:
-         if ((boost::math::isfinite)(a) && (b >= tools::max_value<Real>()))
-         {
-            auto u = [&](const Real& t)->K
-            {
-               Real z = 1 / (t + 1);
-               Real arg = 2 * z + a - 1;
-               K res = f(arg)*z*z;
-               return res;
-            };
-            recursive_info<decltype(u)> info = { u, tol };
-            K Q = Real(2) * recursive_adaptive_integrate(&info, Real(-1), Real(1), max_depth, Real(0), error, pL1);
-            if (pL1)
-            {
-               *pL1 *= 2;
-            }
-            return Q;
-         }
+      subinterval<K> whole = { a, b, K(0), Real(0), Real(0) };
+      whole.value = integrate_subinterval(info, a, b, &whole.error, &whole.L1);
+      intervals.push_back(whole);
+      heap.push_back(0);
+      K total = whole.value;
+      Real total_error = whole.error;
+      Real total_L1 = whole.L1;
 
-         if ((boost::math::isfinite)(b) && (a <= -tools::max_value<Real>()))
+      while ((intervals.size() < max_intervals) && (total_error > total_L1 * info->tol))
+      {
+         std::pop_heap(heap.begin(), heap.end(), smaller_error);
+         std::size_t worst = heap.back();
+         subinterval<K> parent = intervals[worst];
+         Real mid = (parent.a + parent.b) / 2;
+         if ((mid <= parent.a) || (mid >= parent.b))
          {
-            auto v = [&](const Real& t)->K
-            {
-               Real z = 1 / (t + 1);
-               Real arg = 2 * z - 1;
-               return f(b - arg) * z * z;
-            };
-            recursive_info<decltype(v)> info = { v, tol };
-            K Q = Real(2) * recursive_adaptive_integrate(&info, Real(-1), Real(1), max_depth, Real(0), error, pL1);
-            if (pL1)
-            {
-               *pL1 *= 2;
-            }
-            return Q;
+            // The worst subinterval cannot be bisected any further:
+            break;
          }
+         subinterval<K> left = { parent.a, mid, K(0), Real(0), Real(0) };
+         left.value = integrate_subinterval(info, parent.a, mid, &left.error, &left.L1);
+         subinterval<K> right = { mid, parent.b, K(0), Real(0), Real(0) };
+         right.value = integrate_subinterval(info, mid, parent.b, &right.error, &right.L1);
 
-         if ((boost::math::isfinite)(a) && (boost::math::isfinite)(b))
-         {
-            if (a==b)
-            {
-               return K(0);
-            }
-            recursive_info<F> info = { f, tol };
-            if (b < a)
-            {
-               return -recursive_adaptive_integrate(&info, b, a, max_depth, Real(0), error, pL1);
-            }
-            return recursive_adaptive_integrate(&info, a, b, max_depth, Real(0), error, pL1);
-         }
+         total += left.value;
+         total += right.value;
+         total -= parent.value;
+         total_error += left.error + right.error - parent.error;
+         total_L1 += left.L1 + right.L1 - parent.L1;
+
+         intervals[worst] = left;
+         std::push_heap(heap.begin(), heap.end(), smaller_error);
+         intervals.push_back(right);
+         heap.push_back(intervals.size() - 1);
+         std::push_heap(heap.begin(), heap.end(), smaller_error);
+      }
+
+      // Sum the store afresh, rather than returning the running totals with their accumulated rounding error:
+      K result = 0;
+      Real result_error = 0;
+      Real result_L1 = 0;
+      for (const subinterval<K>& s : intervals)
+      {
+         result += s.value;
+         result_error += s.error;
+         result_L1 += s.L1;
       }
-      return static_cast<K>(policies::raise_domain_error(function, "The domain of integration is not sensible; please check the bounds.", a, Policy()));
+      if (error)
+         *error = result_error;
+      if (L1)
+         *L1 = result_L1;
+      return result;
+   }
+
+   template <class F>
+   static auto adaptive_integrate(const recursive_info<F>* info, Real a, Real b, std::size_t limit, bool global, Real* error, Real* L1)->decltype(std::declval<F>()(std::declval<Real>()))
+   {
+      if (global)
+         return global_adaptive_integrate(info, a, b, limit, error, L1);
+      return recursive_adaptive_integrate(info, a, b, static_cast<unsigned>(limit), Real(0), error, L1);
+   }
+
+   // The limits are handled by detail::integrate_over_limits, for ordinary and batch integrands, whose values are of type K:
+   template <class K, class F>
+   static K integrate_impl(const F& f, Real a, Real b, std::size_t limit, bool global, Real tol, Real* error, Real* pL1)
+   {
+      static_assert(!std::is_integral<K>::value,
+                  "The return type cannot be integral, it must be either a real or complex floating point type.");
+      static const char* function = "boost::math::quadrature::gauss_kronrod<%1%>::integrate(f, %1%, %1%)";
+      return detail::integrate_over_limits<Real, Policy, K>(f, a, b, pL1, function, [=](const auto& g, Real lower, Real upper)->K
+      {
+         recursive_info<typename std::decay<decltype(g)>::type> info = { g, tol };
+         return adaptive_integrate(&info, lower, upper, limit, global, error, pL1);
+      });
+   }
+
+public:
+   template <class F>
+   static auto integrate(F f, Real a, Real b, unsigned max_depth = 15, Real tol = tools::root_epsilon<Real>(), Real* error = nullptr, Real* pL1 = nullptr)->decltype(std::declval<F>()(std::declval<Real>()))
+   {
+      typedef decltype(detail::make_vector_integrand<Real>(f)(a)) K;
+      return detail::vector_result(integrate_impl<K>(detail::make_vector_integrand<Real>(f), a, b, max_depth, false, tol, error, pL1));
+   }
+
+   template <class F>
+   static auto integrate_global(F f, Real a, Real b, std::size_t max_intervals = 1000, Real tol = tools::root_epsilon<Real>(), Real* error = nullptr, Real* pL1 = nullptr)->decltype(std::declval<F>()(std::declval<Real>()))
+   {
+      typedef decltype(detail::make_vector_integrand<Real>(f)(a)) K;
+      return detail::vector_result(integrate_impl<K>(detail::make_vector_integrand<Real>(f), a, b, (std::max)(max_intervals, std::size_t(1)), true, tol, error, pL1));
+   }
+
+   //
+   // Batch integrands, f(const Real* x, Real* y, std::size_t n), are evaluated at
+   // all N nodes of each subinterval in a single call:
+   //
+   template <class F>
+   static auto integrate(F f, Real a, Real b, unsigned max_depth = 15, Real tol = tools::root_epsilon<Real>(), Real* error = nullptr, Real* pL1 = nullptr)->typename std::enable_if<detail::is_batch_callable<Real, F>::value, Real>::type
+   {
+      return integrate_impl<Real>(f, a, b, max_depth, false, tol, error, pL1);
+   }
+
+   template <class F>
+   static auto integrate_global(F f, Real a, Real b, std::size_t max_intervals = 1000, Real tol = tools::root_epsilon<Real>(), Real* error = nullptr, Real* pL1 = nullptr)->typename std::enable_if<detail::is_batch_callable<Real, F>::value, Real>::type
+   {
+      return integrate_impl<Real>(f, a, b, (std::max)(max_intervals, std::size_t(1)), true, tol, error, pL1);
    }
 };
 
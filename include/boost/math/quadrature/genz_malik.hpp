@@ -0,0 +1,430 @@
+//  Copyright Boost.Math contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//
+// Globally adaptive cubature over hyperrectangles, using the degree 7 rule of
+// Genz and Malik with its embedded degree 5 rule for the error estimate:
+//
+// A. C. Genz and A. A. Malik, "An adaptive algorithm for numerical integration
+// over an N-dimensional rectangular region", J. Comput. Appl. Math. 6 (1980) 295-302.
+//
+// J. Berntsen, T. O. Espelid and A. Genz, "An adaptive algorithm for the approximate
+// calculation of multiple integrals", ACM Trans. Math. Soft. 17 (1991) 437-451.
+//
+
+#ifndef BOOST_MATH_QUADRATURE_GENZ_MALIK_HPP
+#define BOOST_MATH_QUADRATURE_GENZ_MALIK_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <boost/math/policies/error_handling.hpp>
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <boost/math/tools/precision.hpp>
+#include <boost/math/quadrature/detail/sequential_executor.hpp>
+#include <boost/math/statistics/detail/executor.hpp>
+
+namespace boost { namespace math { namespace quadrature {
+
+namespace detail {
+
+//
+// The Genz-Malik rule on the box with center c and half widths h, in dimension
+// d >= 2.  Its nodes are, in order: the center; c +- l2 h_i e_i and c +- l4 h_i e_i
+// for each i; c +- l4 h_i e_i +- l4 h_j e_j for each i < j; and the 2^d points
+// c +- l5 h, giving 2^d + 2d^2 + 2d + 1 in all.
+//
+template <class Real>
+class genz_malik_rule
+{
+public:
+   explicit genz_malik_rule(std::size_t dimension) : m_dimension(dimension)
+   {
+      using std::sqrt;
+      using std::ldexp;
+      const Real d = static_cast<Real>(dimension);
+      m_l2 = sqrt(Real(9) / 70);
+      m_l4 = sqrt(Real(9) / 10);
+      m_l5 = sqrt(Real(9) / 19);
+      m_w1 = (12824 - 9120 * d + 400 * d * d) / 19683;
+      m_w2 = Real(980) / 6561;
+      m_w4 = (1820 - 400 * d) / 19683;
+      m_w6 = Real(200) / 19683;
+      m_w8 = ldexp(Real(6859) / 19683, -static_cast<int>(dimension));
+      m_e1 = (729 - 950 * d + 50 * d * d) / 729;
+      m_e2 = Real(245) / 486;
+      m_e4 = (265 - 100 * d) / 1458;
+      m_e6 = Real(25) / 729;
+      m_points = (std::size_t(1) << dimension) + 2 * dimension * dimension + 2 * dimension + 1;
+   }
+
+   std::size_t dimension() const
+   {
+      return m_dimension;
+   }
+
+   std::size_t points() const
+   {
+      return m_points;
+   }
+
+   // Writes the nodes for the box (c, h) to x, one point of m_dimension coordinates after another:
+   void nodes(const Real* c, const Real* h, Real* x) const
+   {
+      const std::size_t d = m_dimension;
+      Real* p = x;
+      auto next = [&]()
+      {
+         std::copy(c, c + d, p);
+         p += d;
+         return p - d;
+      };
+      next();
+      for (std::size_t i = 0; i < d; ++i)
+      {
+         next()[i] += m_l2 * h[i];
+         next()[i] -= m_l2 * h[i];
+         next()[i] += m_l4 * h[i];
+         next()[i] -= m_l4 * h[i];
+      }
+      for (std::size_t i = 0; i < d; ++i)
+      {
+         for (std::size_t j = i + 1; j < d; ++j)
+         {
+            for (int s = 0; s < 4; ++s)
+            {
+               Real* q = next();
+               q[i] += (s & 1 ? -m_l4 : m_l4) * h[i];
+               q[j] += (s & 2 ? -m_l4 : m_l4) * h[j];
+            }
+         }
+      }
+      for (std::size_t k = 0; k < (std::size_t(1) << d); ++k)
+      {
+         Real* q = next();
+         for (std::size_t i = 0; i < d; ++i)
+         {
+            q[i] += ((k >> i) & 1 ? -m_l5 : m_l5) * h[i];
+         }
+      }
+   }
+
+   //
+   // Combines the values y at the nodes of the box with half widths h into the
+   // degree 7 estimate of the integral, returned, with the difference from the
+   // degree 5 estimate in *error, the same rule applied to |f| in *L1, and in *split the
+   // axis along which the fourth divided difference of f is largest, which is
+   // the one to bisect.
+   //
+   Real apply(const Real* y, const Real* h, Real* error, Real* L1, std::size_t* split) const
+   {
+      using std::abs;
+      const std::size_t d = m_dimension;
+      const Real ratio = (m_l2 * m_l2) / (m_l4 * m_l4);
+      const Real y0 = y[0];
+      Real s2 = 0;
+      Real s4 = 0;
+      Real a2 = 0;
+      Real a4 = 0;
+      Real largest_difference = -1;
+      const Real* p = y + 1;
+      for (std::size_t i = 0; i < d; ++i, p += 4)
+      {
+         Real f2 = p[0] + p[1];
+         Real f4 = p[2] + p[3];
+         s2 += f2;
+         s4 += f4;
+         a2 += abs(p[0]) + abs(p[1]);
+         a4 += abs(p[2]) + abs(p[3]);
+         Real difference = abs(f2 - 2 * y0 - ratio * (f4 - 2 * y0));
+         if ((difference > largest_difference) || ((difference == largest_difference) && (h[i] > h[*split])))
+         {
+            largest_difference = difference;
+            *split = i;
+         }
+      }
+      Real s6 = 0;
+      Real a6 = 0;
+      for (const Real* end = p + 2 * d * (d - 1); p != end; ++p)
+      {
+         s6 += *p;
+         a6 += abs(*p);
+      }
+      Real s8 = 0;
+      Real a8 = 0;
+      for (const Real* end = p + (std::size_t(1) << d); p != end; ++p)
+      {
+         s8 += *p;
+         a8 += abs(*p);
+      }
+      Real volume = 1;
+      for (std::size_t i = 0; i < d; ++i)
+      {
+         volume *= 2 * h[i];
+      }
+      Real I7 = volume * (m_w1 * y0 + m_w2 * s2 + m_w4 * s4 + m_w6 * s6 + m_w8 * s8);
+      Real I5 = volume * (m_e1 * y0 + m_e2 * s2 + m_e4 * s4 + m_e6 * s6);
+      *error = abs(I7 - I5);
+      *L1 = volume * (m_w1 * abs(y0) + m_w2 * a2 + m_w4 * a4 + m_w6 * a6 + m_w8 * a8);
+      return I7;
+   }
+
+private:
+   std::size_t m_dimension;
+   std::size_t m_points;
+   Real m_l2, m_l4, m_l5;
+   Real m_w1, m_w2, m_w4, m_w6, m_w8;
+   Real m_e1, m_e2, m_e4, m_e6;
+};
+
+} // namespace detail
+
+template<class Real, class Policy = boost::math::policies::policy<> >
+class genz_malik
+{
+public:
+   explicit genz_malik(std::size_t max_evaluations = 1000000) : m_max_evaluations(max_evaluations) {}
+
+   //
+   // Integrates f(const std::vector<Real>& x) over the box with the given (lower, upper)
+   // bounds, in two or more dimensions.
+   //
+   template<class F>
+   Real integrate(const F& f, const std::vector<std::pair<Real, Real>>& bounds, Real tolerance = tools::root_epsilon<Real>(), Real* error = nullptr, Real* L1 = nullptr, std::size_t* evaluations = nullptr) const
+   {
+      detail::sequential_executor exec;
+      return integrate_impl(exec, f, bounds, 1, tolerance, error, L1, evaluations);
+   }
+
+#ifdef BOOST_HAS_THREADS
+   //
+   // As above, but each round bisects the exec.concurrency() subregions with the largest
+   // error estimates, and the integrand is evaluated concurrently at the nodes of all the
+   // new subregions, using an executor such as boost::math::tools::thread_pool.  With a
+   // concurrency of one the result is identical to that of the sequential version:
+   //
+   template<class Executor, class F>
+   auto integrate(Executor&& exec, const F& f, const std::vector<std::pair<Real, Real>>& bounds, Real tolerance = tools::root_epsilon<Real>(), Real* error = nullptr, Real* L1 = nullptr, std::size_t* evaluations = nullptr) const
+      ->typename std::enable_if<boost::math::statistics::detail::is_executor<Executor>::value, Real>::type
+   {
+      return integrate_impl(exec, f, bounds, (std::max)(static_cast<std::size_t>(exec.concurrency()), std::size_t(1)), tolerance, error, L1, evaluations);
+   }
+#endif
+
+private:
+   struct region_estimate
+   {
+      Real value;
+      Real error;
+      Real L1;
+      std::size_t split;
+   };
+
+   //
+   // Applies the rule to the count boxes of the store with indices regions[0, count),
+   // evaluating the integrand at all their nodes in one bulk_execute.
+   //
+   template<class Executor, class F>
+   static void estimate_regions(Executor& exec, const F& f, const detail::genz_malik_rule<Real>& rule, const std::vector<Real>& centers, const std::vector<Real>& widths,
+                                const std::size_t* regions, std::size_t count, std::vector<Real>& x, std::vector<Real>& y, std::vector<region_estimate>& estimates)
+   {
+      const std::size_t d = rule.dimension();
+      const std::size_t m = rule.points();
+      const std::size_t n = count * m;
+      x.resize(n * d);
+      y.resize(n);
+      for (std::size_t r = 0; r < count; ++r)
+      {
+         rule.nodes(&centers[regions[r] * d], &widths[regions[r] * d], &x[r * m * d]);
+      }
+      const std::size_t tasks = (std::min)(n, static_cast<std::size_t>((std::max)(exec.concurrency(), 1u)));
+      exec.bulk_execute(tasks, [&](std::size_t task)
+      {
+         std::vector<Real> point(d);
+         for (std::size_t j = task; j < n; j += tasks)
+         {
+            std::copy(&x[j * d], &x[j * d] + d, point.begin());
+            y[j] = f(point);
+         }
+      });
+      for (std::size_t r = 0; r < count; ++r)
+      {
+         region_estimate& e = estimates[regions[r]];
+         e.split = 0;
+         e.value = rule.apply(&y[r * m], &widths[regions[r] * d], &e.error, &e.L1, &e.split);
+      }
+   }
+
+   static void sum_estimates(const std::vector<region_estimate>& estimates, Real* value, Real* error, Real* L1)
+   {
+      *value = 0;
+      *error = 0;
+      *L1 = 0;
+      for (const region_estimate& e : estimates)
+      {
+         *value += e.value;
+         *error += e.error;
+         *L1 += e.L1;
+      }
+   }
+
+   //
+   // Bisects up to batch subregions per round, those with the largest error estimates, until
+   // the sum of the error estimates is within tolerance of the L1 norm.  The tolerance is
+   // relative to the L1 norm rather than the integral, else an integral which is zero through
+   // cancellation would use up all m_max_evaluations.
+   //
+   template<class Executor, class F>
+   Real integrate_impl(Executor& exec, const F& f, const std::vector<std::pair<Real, Real>>& bounds, std::size_t batch, Real tolerance, Real* error, Real* L1, std::size_t* evaluations) const
+   {
+      using std::abs;
+      static const char* function = "boost::math::quadrature::genz_malik<%1%>::integrate";
+      const std::size_t d = bounds.size();
+      if (evaluations)
+         *evaluations = 0;
+      if (d < 2)
+      {
+         return policies::raise_domain_error(function, "Genz-Malik cubature requires at least two dimensions, but got %1%; please use one of the univariate routines.", static_cast<Real>(d), Policy());
+      }
+      if (d >= std::numeric_limits<std::size_t>::digits - 1)
+      {
+         return policies::raise_domain_error(function, "The dimension %1% is too large.", static_cast<Real>(d), Policy());
+      }
+      for (const std::pair<Real, Real>& bound : bounds)
+      {
+         if (!(boost::math::isfinite)(bound.first) || !(boost::math::isfinite)(bound.second))
+         {
+            return policies::raise_domain_error(function, "The bounds must be finite, but got %1%; please transform the integrand onto a finite region.", (boost::math::isfinite)(bound.first) ? bound.second : bound.first, Policy());
+         }
+         if (bound.second <= bound.first)
+         {
+            return policies::raise_domain_error(function, "The upper bound %1% is <= the lower bound.", bound.second, Policy());
+         }
+      }
+
+      const detail::genz_malik_rule<Real> rule(d);
+      if (rule.points() > m_max_evaluations)
+      {
+         return policies::raise_domain_error(function, "The rule needs %1% evaluations of the integrand, more than the maximum number of evaluations allowed.", static_cast<Real>(rule.points()), Policy());
+      }
+
+      // The subregions are stored contiguously, the center and half widths of box r
+      // at [r*d, (r+1)*d), with a max-heap of their indices ordered by error estimate:
+      std::vector<Real> centers(d);
+      std::vector<Real> widths(d);
+      for (std::size_t i = 0; i < d; ++i)
+      {
+         centers[i] = (bounds[i].first + bounds[i].second) / 2;
+         widths[i] = (bounds[i].second - bounds[i].first) / 2;
+      }
+      std::vector<region_estimate> estimates(1);
+      std::vector<std::size_t> heap(1, 0);
+      std::vector<Real> x;
+      std::vector<Real> y;
+      std::vector<std::size_t> parents;
+      std::vector<region_estimate> parent_estimates;
+      std::vector<std::size_t> halves;
+      auto smaller_error = [&estimates](std::size_t i, std::size_t j)
+      {
+         return estimates[i].error < estimates[j].error;
+      };
+
+      estimate_regions(exec, f, rule, centers, widths, &heap[0], 1, x, y, estimates);
+      std::size_t used = rule.points();
+      Real total = estimates[0].value;
+      Real total_error = estimates[0].error;
+      Real total_L1 = estimates[0].L1;
+
+      while (used + 2 * rule.points() <= m_max_evaluations)
+      {
+         if (total_error <= tolerance * total_L1)
+         {
+            // Confirm convergence with the totals summed afresh, free of the rounding
+            // error accumulated by the running updates:
+            sum_estimates(estimates, &total, &total_error, &total_L1);
+            if (total_error <= tolerance * total_L1)
+               break;
+         }
+         // Take the worst subregions, as many as the batch size and the remaining evaluations allow:
+         const std::size_t count = (std::min)((std::min)(batch, heap.size()), (m_max_evaluations - used) / (2 * rule.points()));
+         parents.clear();
+         while (parents.size() < count)
+         {
+            std::pop_heap(heap.begin(), heap.end(), smaller_error);
+            const std::size_t worst = heap.back();
+            const std::size_t axis = estimates[worst].split;
+            if (widths[worst * d + axis] / 2 <= tools::epsilon<Real>() * abs(centers[worst * d + axis]))
+            {
+               // This subregion cannot usefully be bisected any further, nor can those that follow be the worst:
+               std::push_heap(heap.begin(), heap.end(), smaller_error);
+               break;
+            }
+            heap.pop_back();
+            parents.push_back(worst);
+         }
+         if (parents.empty())
+            break;
+         // Bisect each along its chosen axis, the lower half taking the parent's slot
+         // and the upper half going to the end of the store; all the halves are then estimated together:
+         const std::size_t first_upper = estimates.size();
+         const std::size_t store = first_upper + parents.size();
+         centers.resize(store * d);
+         widths.resize(store * d);
+         estimates.resize(store);
+         parent_estimates.clear();
+         halves.clear();
+         for (std::size_t r = 0; r < parents.size(); ++r)
+         {
+            const std::size_t lower = parents[r];
+            const std::size_t upper = first_upper + r;
+            const std::size_t axis = estimates[lower].split;
+            parent_estimates.push_back(estimates[lower]);
+            widths[lower * d + axis] /= 2;
+            std::copy(&centers[lower * d], &centers[lower * d] + d, &centers[upper * d]);
+            std::copy(&widths[lower * d], &widths[lower * d] + d, &widths[upper * d]);
+            centers[lower * d + axis] -= widths[lower * d + axis];
+            centers[upper * d + axis] += widths[upper * d + axis];
+            halves.push_back(lower);
+            halves.push_back(upper);
+         }
+         estimate_regions(exec, f, rule, centers, widths, &halves[0], halves.size(), x, y, estimates);
+         used += halves.size() * rule.points();
+
+         for (std::size_t r = 0; r < parents.size(); ++r)
+         {
+            const std::size_t lower = parents[r];
+            const std::size_t upper = first_upper + r;
+            const region_estimate& parent = parent_estimates[r];
+            total += estimates[lower].value + estimates[upper].value - parent.value;
+            total_error += estimates[lower].error + estimates[upper].error - parent.error;
+            total_L1 += estimates[lower].L1 + estimates[upper].L1 - parent.L1;
+            heap.push_back(lower);
+            std::push_heap(heap.begin(), heap.end(), smaller_error);
+            heap.push_back(upper);
+            std::push_heap(heap.begin(), heap.end(), smaller_error);
+         }
+      }
+
+      Real result, result_error, result_L1;
+      sum_estimates(estimates, &result, &result_error, &result_L1);
+      if (error)
+         *error = result_error;
+      if (L1)
+         *L1 = result_L1;
+      if (evaluations)
+         *evaluations = used;
+      return result;
+   }
+
+   std::size_t m_max_evaluations;
+};
+
+}}} // namespaces
+
+#endif // BOOST_MATH_QUADRATURE_GENZ_MALIK_HPP
@@ -11,6 +11,8 @@
 #include <vector>
 #include <atomic>
 #include <memory>
+#include <new>
+#include <cstddef>
 #include <functional>
 #include <future>
 #include <thread>
@@ -21,14 +23,51 @@
 #include <map>
 #include <type_traits>
 #include <boost/math/policies/error_handling.hpp>
+#include <boost/math/quadrature/detail/monte_carlo_bounds.hpp>
 
 namespace boost { namespace math { namespace quadrature {
 
 namespace detail {
-  enum class limit_classification {FINITE,
-                                   LOWER_BOUND_INFINITE,
-                                   UPPER_BOUND_INFINITE,
-                                   DOUBLE_INFINITE};
+//
+// The running mean, sum of squared deviations and number of calls of one worker
+// thread.  Each thread's state occupies whole cache lines, so that a thread
+// publishing its statistics doesn't invalidate the lines of the others, and the
+// three values are published together under a sequence lock, so that the master
+// thread always reads a consistent set of them.
+//
+template<class Real>
+struct alignas(64) monte_carlo_thread_state
+{
+    void publish(Real average, Real S, uint64_t calls)
+    {
+        // The release stores order the odd sequence number before the values,
+        // and the values before the even one:
+        uint64_t sequence = m_sequence.load(std::memory_order_relaxed);
+        m_sequence.store(sequence + 1, std::memory_order_relaxed);
+        m_average.store(average, std::memory_order_release);
+        m_S.store(S, std::memory_order_release);
+        m_calls.store(calls, std::memory_order_release);
+        m_sequence.store(sequence + 2, std::memory_order_release);
+    }
+
+    void load(Real& average, Real& S, uint64_t& calls) const
+    {
+        uint64_t before, after;
+        do
+        {
+            before = m_sequence.load(std::memory_order_acquire);
+            average = m_average.load(std::memory_order_acquire);
+            S = m_S.load(std::memory_order_acquire);
+            calls = m_calls.load(std::memory_order_acquire);
+            after = m_sequence.load(std::memory_order_relaxed);
+        } while ((before & 1) || (before != after));
+    }
+
+    std::atomic<uint64_t> m_sequence{};
+    std::atomic<Real> m_average;
+    std::atomic<Real> m_S;
+    std::atomic<uint64_t> m_calls;
+};
 }
 
 template<class Real, class F, class RandomNumberGenerator = std::mt19937_64, class Policy = boost::math::policies::policy<>,
@@ -41,117 +80,24 @@ public:
                       Real error_goal,
                       bool singular = true,
                       uint64_t threads = std::thread::hardware_concurrency(),
-                      uint64_t seed = 0) noexcept : m_num_threads{threads}, m_seed{seed}, m_volume(1)
+                      uint64_t seed = 0) noexcept : m_num_threads{threads}, m_seed{seed}
     {
         using std::numeric_limits;
-        using std::sqrt;
-        uint64_t n = bounds.size();
-        m_lbs.resize(n);
-        m_dxs.resize(n);
-        m_limit_types.resize(n);
-
         static const char* function = "boost::math::quadrature::naive_monte_carlo<%1%>";
-        for (uint64_t i = 0; i < n; ++i)
+        if (!m_bounds.set(bounds, singular, function, Policy()))
         {
-            if (bounds[i].second <= bounds[i].first)
-            {
-                boost::math::policies::raise_domain_error(function, "The upper bound is <= the lower bound.\n", bounds[i].second, Policy());
-                return;
-            }
-            if (bounds[i].first == -numeric_limits<Real>::infinity())
-            {
-                if (bounds[i].second == numeric_limits<Real>::infinity())
-                {
-                    m_limit_types[i] = detail::limit_classification::DOUBLE_INFINITE;
-                }
-                else
-                {
-                    m_limit_types[i] = detail::limit_classification::LOWER_BOUND_INFINITE;
-                    // Ok ok this is bad to use the second bound as the lower limit and then reflect.
-                    m_lbs[i] = bounds[i].second;
-                    m_dxs[i] = numeric_limits<Real>::quiet_NaN();
-                }
-            }
-            else if (bounds[i].second == numeric_limits<Real>::infinity())
-            {
-                m_limit_types[i] = detail::limit_classification::UPPER_BOUND_INFINITE;
-                if (singular)
-                {
-                    // I've found that it's easier to sample on a closed set and perturb the boundary
-                    // than to try to sample very close to the boundary.
-                    m_lbs[i] = std::nextafter(bounds[i].first, (std::numeric_limits<Real>::max)());
-                }
-                else
-                {
-                    m_lbs[i] = bounds[i].first;
-                }
-                m_dxs[i] = numeric_limits<Real>::quiet_NaN();
-            }
-            else
-            {
-                m_limit_types[i] = detail::limit_classification::FINITE;
-                if (singular)
-                {
-                    if (bounds[i].first == 0)
-                    {
-                        m_lbs[i] = std::numeric_limits<Real>::epsilon();
-                    }
-                    else
-                    {
-                        m_lbs[i] = std::nextafter(bounds[i].first, (std::numeric_limits<Real>::max)());
-                    }
-
-                    m_dxs[i] = std::nextafter(bounds[i].second, std::numeric_limits<Real>::lowest()) - m_lbs[i];
-                }
-                else
-                {
-                    m_lbs[i] = bounds[i].first;
-                    m_dxs[i] = bounds[i].second - bounds[i].first;
-                }
-                m_volume *= m_dxs[i];
-            }
+            return;
         }
 
         m_integrand = [this, &integrand](std::vector<Real> & x)->Real
         {
-            Real coeff = m_volume;
-            for (uint64_t i = 0; i < x.size(); ++i)
-            {
-                // Variable transformation are listed at:
-                // https://en.wikipedia.org/wiki/Numerical_integration
-                // However, we've made some changes to these so that we can evaluate on a compact domain.
-                if (m_limit_types[i] == detail::limit_classification::FINITE)
-                {
-                    x[i] = m_lbs[i] + x[i]*m_dxs[i];
-                }
-                else if (m_limit_types[i] == detail::limit_classification::UPPER_BOUND_INFINITE)
-                {
-                    Real t = x[i];
-                    Real z = 1/(1 + numeric_limits<Real>::epsilon() - t);
-                    coeff *= (z*z)*(1 + numeric_limits<Real>::epsilon());
-                    x[i] = m_lbs[i] + t*z;
-                }
-                else if (m_limit_types[i] == detail::limit_classification::LOWER_BOUND_INFINITE)
-                {
-                    Real t = x[i];
-                    Real z = 1/(t+sqrt((numeric_limits<Real>::min)()));
-                    coeff *= (z*z);
-                    x[i] = m_lbs[i] + (t-1)*z;
-                }
-                else
-                {
-                    Real t1 = 1/(1+numeric_limits<Real>::epsilon() - x[i]);
-                    Real t2 = 1/(x[i]+numeric_limits<Real>::epsilon());
-                    x[i] = (2*x[i]-1)*t1*t2/4;
-                    coeff *= (t1*t1+t2*t2)/4;
-                }
-            }
+            Real coeff = m_bounds.transform(x);
             return coeff*integrand(x);
         };
 
         // If we don't do a single function call in the constructor,
         // we can't do a restart.
-        std::vector<Real> x(m_lbs.size());
+        std::vector<Real> x(m_bounds.dimension());
 
         // If the seed is zero, that tells us to choose a random seed for the user:
         if (seed == 0)
@@ -164,21 +110,27 @@ public:
         Real inv_denom = 1/static_cast<Real>(((gen.max)()-(gen.min)()));
 
         m_num_threads = (std::max)(m_num_threads, static_cast<uint64_t>(1));
-        m_thread_calls.reset(new std::atomic<uint64_t>[threads]);
-        m_thread_Ss.reset(new std::atomic<Real>[threads]);
-        m_thread_averages.reset(new std::atomic<Real>[threads]);
+        // Over-aligned new is only available from C++17, so align the thread states by hand:
+        using state_type = detail::monte_carlo_thread_state<Real>;
+        static_assert(std::is_trivially_destructible<state_type>::value, "The thread states are never destroyed.");
+        std::size_t space = (m_num_threads + 1)*sizeof(state_type);
+        m_thread_storage.reset(new char[space]);
+        void* storage = m_thread_storage.get();
+        m_thread_states = static_cast<state_type*>(std::align(alignof(state_type), m_num_threads*sizeof(state_type), storage, space));
+        for (uint64_t i = 0; i < m_num_threads; ++i)
+        {
+            ::new (static_cast<void*>(m_thread_states + i)) state_type();
+        }
 
         Real avg = 0;
         for (uint64_t i = 0; i < m_num_threads; ++i)
         {
-            for (uint64_t j = 0; j < m_lbs.size(); ++j)
+            for (uint64_t j = 0; j < m_bounds.dimension(); ++j)
             {
                 x[j] = (gen()-(gen.min)())*inv_denom;
             }
             Real y = m_integrand(x);
-            m_thread_averages[i] = y; // relaxed store
-            m_thread_calls[i] = 1;
-            m_thread_Ss[i] = 0;
+            m_thread_states[i].publish(y, 0, 1);
             avg += y;
         }
         avg /= m_num_threads;
@@ -291,11 +243,14 @@ private:
             std::cout << "  total calls = " << m_total_calls << std::endl;
 
             for (std::size_t i = 0; i < m_num_threads; ++i)
-               std::cout << "  thread_calls[" << i << "] = " << m_thread_calls[i] << std::endl;
-            for (std::size_t i = 0; i < m_num_threads; ++i)
-               std::cout << "  thread_averages[" << i << "] = " << m_thread_averages[i] << std::endl;
-            for (std::size_t i = 0; i < m_num_threads; ++i)
-               std::cout << "  thread_Ss[" << i << "] = " << m_thread_Ss[i] << std::endl;
+            {
+               Real t_average, t_S;
+               uint64_t t_calls;
+               m_thread_states[i].load(t_average, t_S, t_calls);
+               std::cout << "  thread_calls[" << i << "] = " << t_calls << std::endl;
+               std::cout << "  thread_averages[" << i << "] = " << t_average << std::endl;
+               std::cout << "  thread_Ss[" << i << "] = " << t_S << std::endl;
+            }
 #endif
          }
 
@@ -306,24 +261,7 @@ private:
          }
          do {
             std::this_thread::sleep_for(std::chrono::milliseconds(100));
-            uint64_t total_calls = 0;
-            for (uint64_t i = 0; i < m_num_threads; ++i)
-            {
-               uint64_t t_calls = m_thread_calls[i].load(std::memory_order_consume);
-               total_calls += t_calls;
-            }
-            Real variance = 0;
-            Real avg = 0;
-            for (uint64_t i = 0; i < m_num_threads; ++i)
-            {
-               uint64_t t_calls = m_thread_calls[i].load(std::memory_order_consume);
-               // Will this overflow? Not hard to remove . . .
-               avg += m_thread_averages[i].load(std::memory_order_relaxed)*(static_cast<Real>(t_calls) / static_cast<Real>(total_calls));
-               variance += m_thread_Ss[i].load(std::memory_order_relaxed);
-            }
-            m_avg.store(avg, std::memory_order_release);
-            m_variance.store(variance / (total_calls - 1), std::memory_order_release);
-            m_total_calls = total_calls; // relaxed store, it's just for user feedback
+            m_update_estimates();
             // Allow cancellation:
             if (m_done) // relaxed load
             {
@@ -339,25 +277,7 @@ private:
             std::rethrow_exception(m_exception);
          }
          // Incorporate their work into the final estimate:
-         uint64_t total_calls = 0;
-         for (uint64_t i = 0; i < m_num_threads; ++i)
-         {
-            uint64_t t_calls = m_thread_calls[i].load(std::memory_order_consume);
-            total_calls += t_calls;
-         }
-         Real variance = 0;
-         Real avg = 0;
-
-         for (uint64_t i = 0; i < m_num_threads; ++i)
-         {
-            uint64_t t_calls = m_thread_calls[i].load(std::memory_order_consume);
-            // Averages weighted by the number of calls the thread made:
-            avg += m_thread_averages[i].load(std::memory_order_relaxed)*(static_cast<Real>(t_calls) / static_cast<Real>(total_calls));
-            variance += m_thread_Ss[i].load(std::memory_order_relaxed);
-         }
-         m_avg.store(avg, std::memory_order_release);
-         m_variance.store(variance / (total_calls - 1), std::memory_order_release);
-         m_total_calls = total_calls; // relaxed store, this is just user feedback
+         m_update_estimates();
 
          // Sometimes, the master will observe the variance at a very "good" (or bad?) moment,
          // Then the threads proceed to find the variance is much greater by the time they hear the message to stop.
@@ -368,22 +288,48 @@ private:
       return m_avg.load(std::memory_order_consume);
     }
 
+    // Combines the statistics published by the threads:
+    void m_update_estimates()
+    {
+        std::vector<Real> averages(m_num_threads);
+        std::vector<Real> Ss(m_num_threads);
+        std::vector<uint64_t> calls(m_num_threads);
+        uint64_t total_calls = 0;
+        for (uint64_t i = 0; i < m_num_threads; ++i)
+        {
+            m_thread_states[i].load(averages[i], Ss[i], calls[i]);
+            total_calls += calls[i];
+        }
+        Real variance = 0;
+        Real avg = 0;
+        for (uint64_t i = 0; i < m_num_threads; ++i)
+        {
+            // Averages weighted by the number of calls the thread made:
+            avg += averages[i]*(static_cast<Real>(calls[i]) / static_cast<Real>(total_calls));
+            variance += Ss[i];
+        }
+        m_avg.store(avg, std::memory_order_release);
+        m_variance.store(variance / (total_calls - 1), std::memory_order_release);
+        m_total_calls = total_calls; // relaxed store, it's just for user feedback
+    }
+
     void m_thread_monte(uint64_t thread_index, uint64_t seed)
     {
         using std::numeric_limits;
         try
         {
-            std::vector<Real> x(m_lbs.size());
+            std::vector<Real> x(m_bounds.dimension());
             RandomNumberGenerator gen(seed);
             Real inv_denom = static_cast<Real>(1) / static_cast<Real>(( (gen.max)() - (gen.min)() ));
-            Real M1 = m_thread_averages[thread_index].load(std::memory_order_consume);
-            Real S = m_thread_Ss[thread_index].load(std::memory_order_consume);
+            Real M1;
+            Real S;
+            uint64_t k;
+            m_thread_states[thread_index].load(M1, S, k);
             // Kahan summation is required or the value of the integrand will go on a random walk during long computations.
             // See the implementation discussion.
             // The idea is that the unstabilized additions have error sigma(f)/sqrt(N) + epsilon*N, which diverges faster than it converges!
             // Kahan summation turns this to sigma(f)/sqrt(N) + epsilon^2*N, and the random walk occurs on a timescale of 10^14 years (on current hardware)
             Real compensator = 0;
-            uint64_t k = m_thread_calls[thread_index].load(std::memory_order_consume);
             while (!m_done) // relaxed load
             {
                 int j = 0;
@@ -394,7 +340,7 @@ private:
                 int magic_calls_before_update = 2048;
                 while (j++ < magic_calls_before_update)
                 {
-                    for (uint64_t i = 0; i < m_lbs.size(); ++i)
+                    for (uint64_t i = 0; i < m_bounds.dimension(); ++i)
                     {
                         x[i] = (gen() - (gen.min)())*inv_denom;
                     }
@@ -421,9 +367,8 @@ private:
                     S += (f - M1)*(f - M2);
                     M1 = M2;
                 }
-                m_thread_averages[thread_index].store(M1, std::memory_order_release);
-                m_thread_Ss[thread_index].store(S, std::memory_order_release);
-                m_thread_calls[thread_index].store(k, std::memory_order_release);
+                // Publish once per batch of calls, so the hot loop touches no shared state:
+                m_thread_states[thread_index].publish(M1, S, k);
             }
         }
         catch (...)
@@ -440,18 +385,13 @@ private:
     std::atomic<uint64_t> m_seed;
     std::atomic<Real> m_error_goal;
     std::atomic<bool> m_done{};
-    std::vector<Real> m_lbs;
-    std::vector<Real> m_dxs;
-    std::vector<detail::limit_classification> m_limit_types;
-    Real m_volume;
+    detail::monte_carlo_bounds<Real> m_bounds;
     std::atomic<uint64_t> m_total_calls{};
-    // I wanted these to be vectors rather than maps,
-    // but you can't resize a vector of atomics.
-    std::unique_ptr<std::atomic<uint64_t>[]> m_thread_calls;
+    // The state of each thread, in storage aligned to the cache lines:
+    std::unique_ptr<char[]> m_thread_storage;
+    detail::monte_carlo_thread_state<Real>* m_thread_states{};
     std::atomic<Real> m_variance;
-    std::unique_ptr<std::atomic<Real>[]> m_thread_Ss;
     std::atomic<Real> m_avg;
-    std::unique_ptr<std::atomic<Real>[]> m_thread_averages;
     std::chrono::time_point<std::chrono::system_clock> m_start;
     std::exception_ptr m_exception;
     std::mutex m_exception_mutex;
@@ -0,0 +1,376 @@
+/*
+ * Copyright Boost.Math contributors, 2026
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef BOOST_MATH_QUADRATURE_QUASI_MONTE_CARLO_HPP
+#define BOOST_MATH_QUADRATURE_QUASI_MONTE_CARLO_HPP
+#include <sstream>
+#include <algorithm>
+#include <vector>
+#include <atomic>
+#include <memory>
+#include <functional>
+#include <mutex>
+#include <future>
+#include <thread>
+#include <utility>
+#include <random>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <boost/math/policies/error_handling.hpp>
+#include <boost/math/special_functions/prime.hpp>
+#include <boost/math/tools/precision.hpp>
+#include <boost/math/quadrature/detail/monte_carlo_bounds.hpp>
+
+namespace boost { namespace math { namespace quadrature {
+
+namespace detail {
+
+//
+// Independent randomizations of the Halton sequence.  Coordinate j of point i is
+// the radical inverse of i in the j-th prime base b, with each digit d in position
+// k mapped to (h*d + g) mod b, where the multiplier h in [1, b) and the shift g in
+// [0, b) are drawn independently for every digit position, coordinate and
+// randomization.  Every point is then uniformly distributed on the unit cube,
+// while each randomization keeps the low discrepancy of the Halton sequence.
+// Digits beyond those of i are zero, and map to the shifts alone, so their
+// contribution is precomputed as a tail sum.
+//
+template<class Real>
+class scrambled_halton
+{
+public:
+    scrambled_halton(uint64_t dimension, uint64_t randomizations, uint64_t seed)
+        : m_dimension(dimension), m_bases(dimension), m_offsets(dimension + 1)
+    {
+        using std::ceil;
+        using std::log;
+        // Enough digits for both the precision of Real and any 64 bit index:
+        double bits = static_cast<double>((std::max)(boost::math::tools::digits<Real>(), 64));
+        m_offsets[0] = 0;
+        for (uint64_t j = 0; j < dimension; ++j)
+        {
+            m_bases[j] = boost::math::prime(static_cast<unsigned>(j));
+            uint64_t digits = static_cast<uint64_t>(ceil(bits*log(2.0)/log(static_cast<double>(m_bases[j])))) + 1;
+            m_offsets[j + 1] = m_offsets[j] + digits + 1;
+        }
+        m_stride = m_offsets[dimension];
+
+        m_scales.resize(m_stride);
+        for (uint64_t j = 0; j < dimension; ++j)
+        {
+            Real scale = 1;
+            for (uint64_t k = m_offsets[j]; k < m_offsets[j + 1]; ++k)
+            {
+                scale /= m_bases[j];
+                m_scales[k] = scale;
+            }
+        }
+
+        // gen() % b is used rather than a distribution so that the sequence
+        // is the same for a given seed on every platform:
+        std::mt19937_64 gen(seed);
+        m_multipliers.resize(randomizations*m_stride);
+        m_shifts.resize(randomizations*m_stride);
+        m_tails.resize(randomizations*m_stride);
+        for (uint64_t r = 0; r < randomizations; ++r)
+        {
+            for (uint64_t j = 0; j < dimension; ++j)
+            {
+                uint32_t b = m_bases[j];
+                for (uint64_t k = m_offsets[j]; k < m_offsets[j + 1]; ++k)
+                {
+                    m_multipliers[r*m_stride + k] = 1 + static_cast<uint32_t>(gen() % (b - 1));
+                    m_shifts[r*m_stride + k] = static_cast<uint32_t>(gen() % b);
+                }
+                Real tail = 0;
+                for (uint64_t k = m_offsets[j + 1]; k-- > m_offsets[j];)
+                {
+                    tail += m_shifts[r*m_stride + k]*m_scales[k];
+                    m_tails[r*m_stride + k] = tail;
+                }
+            }
+        }
+    }
+
+    // Writes point `index` of randomization r to x:
+    void operator()(uint64_t r, uint64_t index, std::vector<Real> & x) const
+    {
+        for (uint64_t j = 0; j < m_dimension; ++j)
+        {
+            uint64_t b = m_bases[j];
+            uint64_t k = m_offsets[j];
+            const uint32_t* h = m_multipliers.data() + r*m_stride;
+            const uint32_t* g = m_shifts.data() + r*m_stride;
+            Real v = 0;
+            for (uint64_t i = index; i > 0; i /= b, ++k)
+            {
+                v += static_cast<Real>((h[k]*(i % b) + g[k]) % b)*m_scales[k];
+            }
+            x[j] = v + m_tails[r*m_stride + k];
+        }
+    }
+
+private:
+    uint64_t m_dimension;
+    std::vector<uint32_t> m_bases;
+    // Each coordinate has digits + 1 entries in the arrays below, starting at m_offsets[j]:
+    std::vector<uint64_t> m_offsets;
+    uint64_t m_stride;
+    std::vector<Real> m_scales;
+    std::vector<uint32_t> m_multipliers;
+    std::vector<uint32_t> m_shifts;
+    std::vector<Real> m_tails;
+};
+
+}
+
+template<class Real, class F, class Policy = boost::math::policies::policy<>,
+         typename std::enable_if<std::is_trivially_copyable<Real>::value, bool>::type = true>
+class quasi_monte_carlo
+{
+public:
+    quasi_monte_carlo(const F& integrand,
+                      std::vector<std::pair<Real, Real>> const & bounds,
+                      Real error_goal,
+                      bool singular = true,
+                      uint64_t threads = std::thread::hardware_concurrency(),
+                      uint64_t seed = 0,
+                      uint64_t randomizations = 16)
+        : m_integrand{integrand}, m_num_threads{(std::max)(threads, static_cast<uint64_t>(1))},
+          m_randomizations{randomizations}, m_error_goal{error_goal}
+    {
+        static const char* function = "boost::math::quadrature::quasi_monte_carlo<%1%>";
+        m_bounds.set(bounds, singular, function, Policy());
+        if (bounds.size() > boost::math::max_prime + 1)
+        {
+            boost::math::policies::raise_domain_error(function, "The Halton sequence is limited to %1% dimensions.\n", static_cast<Real>(boost::math::max_prime + 1), Policy());
+        }
+        if (randomizations < 2)
+        {
+            boost::math::policies::raise_domain_error(function, "At least two randomizations are required to estimate the error, but got %1%.\n", static_cast<Real>(randomizations), Policy());
+        }
+        // If the seed is zero, that tells us to choose a random seed for the user:
+        if (seed == 0)
+        {
+            std::random_device rd;
+            seed = rd();
+        }
+        m_sequence.reset(new detail::scrambled_halton<Real>(bounds.size(), randomizations, seed));
+        m_sums.assign(randomizations, Real(0));
+        m_compensators.assign(randomizations, Real(0));
+        m_avg = std::numeric_limits<Real>::quiet_NaN();
+        m_error = (std::numeric_limits<Real>::max)();
+        m_start = std::chrono::system_clock::now();
+    }
+
+    std::future<Real> integrate()
+    {
+        // Set done to false in case we wish to restart:
+        m_done.store(false); // relaxed store, no worker threads yet
+        m_start = std::chrono::system_clock::now();
+        return std::async(std::launch::async,
+                          &quasi_monte_carlo::m_integrate, this);
+    }
+
+    void cancel()
+    {
+        m_done = true; // relaxed store, worker threads will get the message eventually
+    }
+
+    Real current_error_estimate() const
+    {
+        return m_error.load();
+    }
+
+    std::chrono::duration<Real> estimated_time_to_completion() const
+    {
+        auto now = std::chrono::system_clock::now();
+        std::chrono::duration<Real> elapsed_seconds = now - m_start;
+        // The error of a quasi-Monte Carlo estimate decreases as 1/N for smooth integrands:
+        Real r = this->current_error_estimate()/m_error_goal.load(); // relaxed load
+        if (r <= 1) {
+            return 0*elapsed_seconds;
+        }
+        return (r - 1)*elapsed_seconds;
+    }
+
+    void update_target_error(Real new_target_error)
+    {
+        m_error_goal = new_target_error;  // relaxed store
+    }
+
+    Real progress() const
+    {
+        Real r = m_error_goal.load()/this->current_error_estimate();  // relaxed load
+        if (r >= 1)
+        {
+            return 1;
+        }
+        return r;
+    }
+
+    Real current_estimate() const
+    {
+        return m_avg.load();
+    }
+
+    uint64_t calls() const
+    {
+        return m_total_calls.load();  // relaxed load
+    }
+
+private:
+
+    Real m_integrate()
+    {
+        using std::sqrt;
+        while (m_points == 0 || m_error.load() > m_error_goal.load())
+        {
+            // Each round doubles the number of points:
+            uint64_t blocks = m_points == 0 ? 1 : m_points/block_size;
+            std::vector<Real> block_sums(blocks*m_randomizations);
+            m_next_block = 0;
+            m_blocks_done = 0;
+            if (m_num_threads == 1)
+            {
+                m_evaluate_blocks(m_points, blocks, block_sums);
+            }
+            else
+            {
+                std::vector<std::thread> threads((std::min)(m_num_threads, blocks));
+                for (uint64_t i = 0; i < threads.size(); ++i)
+                {
+                    threads[i] = std::thread(&quasi_monte_carlo::m_evaluate_blocks, this, m_points, blocks, std::ref(block_sums));
+                }
+                std::for_each(threads.begin(), threads.end(),
+                    std::mem_fn(&std::thread::join));
+            }
+            if (m_exception)
+            {
+                std::exception_ptr e = m_exception;
+                m_exception = nullptr;
+                m_abort = false;
+                std::rethrow_exception(e);
+            }
+            // A cancelled round is incomplete, and is discarded:
+            if (m_blocks_done.load() < blocks)
+            {
+                break;
+            }
+
+            m_points += blocks*block_size;
+            Real avg = 0;
+            for (uint64_t r = 0; r < m_randomizations; ++r)
+            {
+                Real sum = 0;
+                for (uint64_t b = 0; b < blocks; ++b)
+                {
+                    sum += block_sums[b*m_randomizations + r];
+                }
+                // Kahan summation, so that the result doesn't wander over many rounds:
+                Real y = sum - m_compensators[r];
+                Real t = m_sums[r] + y;
+                m_compensators[r] = (t - m_sums[r]) - y;
+                m_sums[r] = t;
+                avg += m_sums[r]/m_points;
+            }
+            avg /= m_randomizations;
+            Real variance = 0;
+            for (uint64_t r = 0; r < m_randomizations; ++r)
+            {
+                Real d = m_sums[r]/m_points - avg;
+                variance += d*d;
+            }
+            variance /= m_randomizations - 1;
+            m_avg.store(avg, std::memory_order_release);
+            m_error.store(sqrt(variance/m_randomizations), std::memory_order_release);
+            m_total_calls = m_points*m_randomizations;
+        }
+        return m_avg.load(std::memory_order_consume);
+    }
+
+    void m_evaluate_blocks(uint64_t first_point, uint64_t blocks, std::vector<Real>& block_sums)
+    {
+        using std::isfinite;
+        try
+        {
+            std::vector<Real> x(m_bounds.dimension());
+            for (uint64_t b = m_next_block++; b < blocks; b = m_next_block++)
+            {
+                // The first round must complete, so that there's an estimate to return:
+                if (m_abort || (m_done && first_point > 0))
+                {
+                    return;
+                }
+                for (uint64_t r = 0; r < m_randomizations; ++r)
+                {
+                    Real sum = 0;
+                    for (uint64_t i = first_point + b*block_size; i < first_point + (b + 1)*block_size; ++i)
+                    {
+                        (*m_sequence)(r, i, x);
+                        Real coeff = m_bounds.transform(x);
+                        Real f = coeff*m_integrand(x);
+                        if (!isfinite(f))
+                        {
+                            // The call to transform changed x, so this error message states the correct node.
+                            std::stringstream os;
+                            os << "Your integrand was evaluated at {";
+                            for (uint64_t k = 0; k < x.size() -1; ++k)
+                            {
+                                 os << x[k] << ", ";
+                            }
+                            os << x[x.size() -1] << "}, and returned " << f << std::endl;
+                            static const char* function = "boost::math::quadrature::quasi_monte_carlo<%1%>";
+                            boost::math::policies::raise_domain_error(function, os.str().c_str(), /*this is a dummy arg to make it compile*/ 7.2, Policy());
+                        }
+                        sum += f;
+                    }
+                    block_sums[b*m_randomizations + r] = sum;
+                }
+                ++m_blocks_done;
+            }
+        }
+        catch (...)
+        {
+            // Signal the other threads that the computation is ruined:
+            m_abort = true;
+            std::lock_guard<std::mutex> lock(m_exception_mutex); // Scoped lock to prevent race writing to m_exception
+            m_exception = std::current_exception();
+        }
+    }
+
+    // Each randomization uses the same points of the sequence, which are
+    // evaluated in blocks.  The sums over each block are combined in order,
+    // so that the result does not depend on the number of threads:
+    static constexpr uint64_t block_size = 256;
+
+    F m_integrand;
+    uint64_t m_num_threads;
+    uint64_t m_randomizations;
+    detail::monte_carlo_bounds<Real> m_bounds;
+    std::unique_ptr<detail::scrambled_halton<Real>> m_sequence;
+    // The number of points of each randomization evaluated so far, and their sums:
+    uint64_t m_points{};
+    std::vector<Real> m_sums;
+    std::vector<Real> m_compensators;
+    std::atomic<uint64_t> m_next_block{};
+    std::atomic<uint64_t> m_blocks_done{};
+    std::atomic<Real> m_error_goal;
+    std::atomic<bool> m_done{};
+    std::atomic<bool> m_abort{};
+    std::atomic<uint64_t> m_total_calls{};
+    std::atomic<Real> m_avg;
+    std::atomic<Real> m_error;
+    std::chrono::time_point<std::chrono::system_clock> m_start;
+    std::exception_ptr m_exception;
+    std::mutex m_exception_mutex;
+};
+
+}}}
+#endif
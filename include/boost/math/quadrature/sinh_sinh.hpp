@@ -18,6 +18,8 @@
 #include <cmath>
 #include <limits>
 #include <memory>
+#include <type_traits>
+#include <utility>
 #include <boost/math/quadrature/detail/sinh_sinh_detail.hpp>
 
 namespace boost{ namespace math{ namespace quadrature {
@@ -35,6 +37,16 @@ public:
         return m_imp->integrate(f, tol, error, L1, levels);
     }
 
+    //
+    // Overload for batch integrands f(const Real* x, Real* y, std::size_t n), which set
+    // y[i] to the value of the integrand at x[i], and are passed a whole row of abscissas at a time:
+    //
+    template<class F>
+    auto integrate(const F f, Real tol = boost::math::tools::root_epsilon<Real>(), Real* error = nullptr, Real* L1 = nullptr, std::size_t* levels = nullptr) const ->typename std::enable_if<detail::is_batch_callable<Real, F>::value, Real>::type
+    {
+        return m_imp->integrate(detail::make_batch_integrand<Real>(f, detail::identity_transform<Real>()), tol, error, L1, levels);
+    }
+
 private:
     std::shared_ptr<detail::sinh_sinh_detail<Real, Policy>> m_imp;
 };
@@ -32,10 +32,102 @@
 #include <cmath>
 #include <limits>
 #include <memory>
+#include <type_traits>
+#include <utility>
 #include <boost/math/quadrature/detail/tanh_sinh_detail.hpp>
+#include <boost/math/statistics/detail/executor.hpp>
 
 namespace boost{ namespace math{ namespace quadrature {
 
+namespace detail {
+
+//
+// The changes of variables which map the range of integration onto (-1, 1).  Each
+// returns, for the abscissa t and its distance tc from the nearer end point, the
+// pair {x, s}: the transformed integrand is s*f(x).  They are applied to ordinary
+// and batch integrands alike by make_transformed_integrand.
+//
+template <class Real>
+struct tanh_sinh_infinite_transform
+{
+   std::pair<Real, Real> operator()(const Real& t, const Real& tc) const
+   {
+      Real t_sq = t*t;
+      Real inv;
+      if (t > 0.5f)
+         inv = 1 / ((2 - tc) * tc);
+      else if (t < -0.5)
+         inv = 1 / ((2 + tc) * -tc);
+      else
+         inv = 1 / (1 - t_sq);
+      return std::pair<Real, Real>(t*inv, (1 + t_sq)*inv*inv);
+   }
+};
+
+// [limit, infinity) when sign is 1, and (-infinity, limit] when it is -1:
+template <class Real>
+struct tanh_sinh_half_infinite_transform
+{
+   Real limit;
+   Real sign;
+   std::pair<Real, Real> operator()(const Real& t, const Real& tc) const
+   {
+      Real z, arg;
+      if (t > -0.5f)
+         z = 1 / (t + 1);
+      else
+         z = -1 / tc;
+      if (t < 0.5)
+         arg = 2 * z - 1;
+      else
+         arg = tc / (2 - tc);
+      return std::pair<Real, Real>(limit + sign * arg, z * z);
+   }
+};
+
+// [a, b] for finite a < b, measuring positions near a small end point from zero to keep their precision:
+template <class Real>
+struct tanh_sinh_finite_transform
+{
+   tanh_sinh_finite_transform(Real a_, Real b_) : a(a_), b(b_)
+   {
+      BOOST_MATH_STD_USING
+      avg = (a + b)*constants::half<Real>();
+      diff = (b - a)*constants::half<Real>();
+      avg_over_diff_m1 = a / diff;
+      avg_over_diff_p1 = b / diff;
+      have_small_left = fabs(a) < 0.5f;
+      have_small_right = fabs(b) < 0.5f;
+   }
+
+   std::pair<Real, Real> operator()(const Real& z, const Real& zc) const
+   {
+      Real position;
+      if (z < -0.5)
+      {
+         if (have_small_left)
+            return std::pair<Real, Real>(diff * (avg_over_diff_m1 - zc), 1);
+         position = a - diff * zc;
+      }
+      else if (z > 0.5)
+      {
+         if (have_small_right)
+            return std::pair<Real, Real>(diff * (avg_over_diff_p1 - zc), 1);
+         position = b - diff * zc;
+      }
+      else
+         position = avg + diff*z;
+      BOOST_MATH_ASSERT(position != a);
+      BOOST_MATH_ASSERT(position != b);
+      return std::pair<Real, Real>(position, 1);
+   }
+
+   Real a, b, avg, diff, avg_over_diff_m1, avg_over_diff_p1;
+   bool have_small_left, have_small_right;
+};
+
+}
+
 template<class Real, class Policy = policies::policy<> >
 class tanh_sinh
 {
@@ -53,7 +145,66 @@ public:
     template<class F>
     auto integrate(const F f, Real tolerance = tools::root_epsilon<Real>(), Real* error = nullptr, Real* L1 = nullptr, std::size_t* levels = nullptr) const ->decltype(std::declval<F>()(std::declval<Real>(), std::declval<Real>()));
 
+    //
+    // Overloads for batch integrands f(const Real* x, Real* y, std::size_t n), which set
+    // y[i] to the value of the integrand at x[i], and are passed a whole row of abscissas at a time:
+    //
+    template<class F>
+    auto integrate(const F f, Real a, Real b, Real tolerance = tools::root_epsilon<Real>(), Real* error = nullptr, Real* L1 = nullptr, std::size_t* levels = nullptr) const ->typename std::enable_if<detail::is_batch_callable<Real, F>::value, Real>::type;
+    template<class F>
+    auto integrate(const F f, Real tolerance = tools::root_epsilon<Real>(), Real* error = nullptr, Real* L1 = nullptr, std::size_t* levels = nullptr) const ->typename std::enable_if<detail::is_batch_callable<Real, F>::value, Real>::type;
+
+#ifdef BOOST_HAS_THREADS
+    //
+    // As above, but the integrand is evaluated concurrently at all the new points
+    // of each refinement level, using an executor such as boost::math::tools::thread_pool.
+    // The result is identical to that of the sequential versions:
+    //
+    template<class Executor, class F>
+    auto integrate(Executor&& exec, const F f, Real a, Real b, Real tolerance = tools::root_epsilon<Real>(), Real* error = nullptr, Real* L1 = nullptr, std::size_t* levels = nullptr) const ->typename std::enable_if<boost::math::statistics::detail::is_executor<Executor>::value, decltype(std::declval<F>()(std::declval<Real>()))>::type
+    {
+       return detail::vector_result(integrate_impl(exec, detail::make_vector_integrand<Real>(f), a, b, tolerance, error, L1, levels));
+    }
+    template<class Executor, class F>
+    auto integrate(Executor&& exec, const F f, Real a, Real b, Real tolerance = tools::root_epsilon<Real>(), Real* error = nullptr, Real* L1 = nullptr, std::size_t* levels = nullptr) const ->typename std::enable_if<boost::math::statistics::detail::is_executor<Executor>::value, decltype(std::declval<F>()(std::declval<Real>(), std::declval<Real>()))>::type
+    {
+       return detail::vector_result(integrate_impl(exec, detail::make_vector_integrand<Real>(f), a, b, tolerance, error, L1, levels));
+    }
+
+    template<class Executor, class F>
+    auto integrate(Executor&& exec, const F f, Real tolerance = tools::root_epsilon<Real>(), Real* error = nullptr, Real* L1 = nullptr, std::size_t* levels = nullptr) const ->typename std::enable_if<boost::math::statistics::detail::is_executor<Executor>::value, decltype(std::declval<F>()(std::declval<Real>()))>::type
+    {
+       return detail::vector_result(integrate_impl(exec, detail::make_vector_integrand<Real>(f), tolerance, error, L1, levels));
+    }
+    template<class Executor, class F>
+    auto integrate(Executor&& exec, const F f, Real tolerance = tools::root_epsilon<Real>(), Real* error = nullptr, Real* L1 = nullptr, std::size_t* levels = nullptr) const ->typename std::enable_if<boost::math::statistics::detail::is_executor<Executor>::value, decltype(std::declval<F>()(std::declval<Real>(), std::declval<Real>()))>::type
+    {
+       return detail::vector_result(integrate_impl(exec, detail::make_vector_integrand<Real>(f), tolerance, error, L1, levels));
+    }
+#endif
+
+    //
+    // Writes the abscissas and weights computed so far to a binary stream, and reads them back, so that
+    // the nodes for a high precision type need only be computed once.  load_nodes returns false, and
+    // changes nothing, unless the stream was written by save_nodes for the same type and min_complement:
+    //
+    void save_nodes(std::ostream& os) const { m_imp->save_nodes(os); }
+    bool load_nodes(std::istream& is) { return m_imp->load_nodes(is); }
+
 private:
+    // The changes of variables for the limits of integration, for ordinary and batch integrands, whose values are of type K:
+    template<class K, class Executor, class F>
+    K integrate_over_limits(Executor& exec, const F& f, Real a, Real b, Real tolerance, Real* error, Real* L1, std::size_t* levels) const;
+
+    template<class Executor, class F>
+    auto integrate_impl(Executor& exec, const F& f, Real a, Real b, Real tolerance, Real* error, Real* L1, std::size_t* levels) const ->decltype(std::declval<F>()(std::declval<Real>()));
+    template<class Executor, class F>
+    auto integrate_impl(Executor& exec, const F& f, Real a, Real b, Real tolerance, Real* error, Real* L1, std::size_t* levels) const ->decltype(std::declval<F>()(std::declval<Real>(), std::declval<Real>()));
+    template<class Executor, class F>
+    auto integrate_impl(Executor& exec, const F& f, Real tolerance, Real* error, Real* L1, std::size_t* levels) const ->decltype(std::declval<F>()(std::declval<Real>()));
+    template<class Executor, class F>
+    auto integrate_impl(Executor& exec, const F& f, Real tolerance, Real* error, Real* L1, std::size_t* levels) const ->decltype(std::declval<F>()(std::declval<Real>(), std::declval<Real>()));
+
     std::shared_ptr<detail::tanh_sinh_detail<Real, Policy>> m_imp;
 };
 
@@ -61,86 +212,49 @@ template<class Real, class Policy>
 template<class F>
 auto tanh_sinh<Real, Policy>::integrate(const F f, Real a, Real b, Real tolerance, Real* error, Real* L1, std::size_t* levels) const ->decltype(std::declval<F>()(std::declval<Real>()))
 {
-    BOOST_MATH_STD_USING
-    using boost::math::constants::half;
-    using boost::math::quadrature::detail::tanh_sinh_detail;
-
-    static const char* function = "tanh_sinh<%1%>::integrate";
+   detail::sequential_executor exec;
+   return detail::vector_result(integrate_impl(exec, detail::make_vector_integrand<Real>(f), a, b, tolerance, error, L1, levels));
+}
 
+template<class Real, class Policy>
+template<class Executor, class F>
+auto tanh_sinh<Real, Policy>::integrate_impl(Executor& exec, const F& f, Real a, Real b, Real tolerance, Real* error, Real* L1, std::size_t* levels) const ->decltype(std::declval<F>()(std::declval<Real>()))
+{
     typedef decltype(std::declval<F>()(std::declval<Real>())) result_type;
     static_assert(!std::is_integral<result_type>::value,
                   "The return type cannot be integral, it must be either a real or complex floating point type.");
+    return integrate_over_limits<result_type>(exec, f, a, b, tolerance, error, L1, levels);
+}
+
+template<class Real, class Policy>
+template<class K, class Executor, class F>
+K tanh_sinh<Real, Policy>::integrate_over_limits(Executor& exec, const F& f, Real a, Real b, Real tolerance, Real* error, Real* L1, std::size_t* levels) const
+{
+    BOOST_MATH_STD_USING
+    using boost::math::quadrature::detail::make_transformed_integrand;
+
+    static const char* function = "tanh_sinh<%1%>::integrate";
+
     if (!(boost::math::isnan)(a) && !(boost::math::isnan)(b))
     {
 
        // Infinite limits:
        if ((a <= -tools::max_value<Real>()) && (b >= tools::max_value<Real>()))
        {
-          auto u = [&](const Real& t, const Real& tc)->result_type
-          {
-             Real t_sq = t*t;
-             Real inv;
-             if (t > 0.5f)
-                inv = 1 / ((2 - tc) * tc);
-             else if(t < -0.5)
-                inv = 1 / ((2 + tc) * -tc);
-             else
-                inv = 1 / (1 - t_sq);
-             return f(t*inv)*(1 + t_sq)*inv*inv;
-          };
+          auto u = make_transformed_integrand<Real>(f, detail::tanh_sinh_infinite_transform<Real>());
           Real limit = sqrt(tools::min_value<Real>()) * 4;
-          return m_imp->integrate(u, error, L1, function, limit, limit, tolerance, levels);
+          return m_imp->integrate(u, error, L1, function, limit, limit, tolerance, levels, exec);
        }
 
-       // Right limit is infinite:
-       if ((boost::math::isfinite)(a) && (b >= tools::max_value<Real>()))
+       // One limit is infinite:
+       if (((boost::math::isfinite)(a) && (b >= tools::max_value<Real>())) || ((boost::math::isfinite)(b) && (a <= -tools::max_value<Real>())))
        {
-          auto u = [&](const Real& t, const Real& tc)->result_type
-          {
-             Real z, arg;
-             if (t > -0.5f)
-                z = 1 / (t + 1);
-             else
-                z = -1 / tc;
-             if (t < 0.5)
-                arg = 2 * z + a - 1;
-             else
-                arg = a + tc / (2 - tc);
-             return f(arg)*z*z;
-          };
-          Real left_limit = sqrt(tools::min_value<Real>()) * 4;
-          result_type Q = Real(2) * m_imp->integrate(u, error, L1, function, left_limit, tools::min_value<Real>(), tolerance, levels);
-          if (L1)
-          {
-             *L1 *= 2;
-          }
-          if (error)
-          {
-             *error *= 2;
-          }
-
-          return Q;
-       }
-
-       if ((boost::math::isfinite)(b) && (a <= -tools::max_value<Real>()))
-       {
-          auto v = [&](const Real& t, const Real& tc)->result_type
-          {
-             Real z;
-             if (t > -0.5)
-                z = 1 / (t + 1);
-             else
-                z = -1 / tc;
-             Real arg;
-             if (t < 0.5)
-                arg = 2 * z - 1;
-             else
-                arg = tc / (2 - tc);
-             return f(b - arg) * z * z;
-          };
-
+          // Types without an infinity represent one by max_value, so test which end is infinite:
+          const bool right_infinite = b >= tools::max_value<Real>();
+          detail::tanh_sinh_half_infinite_transform<Real> transform = { right_infinite ? a : b, Real(right_infinite ? 1 : -1) };
+          auto u = make_transformed_integrand<Real>(f, transform);
           Real left_limit = sqrt(tools::min_value<Real>()) * 4;
-          result_type Q = Real(2) * m_imp->integrate(v, error, L1, function, left_limit, tools::min_value<Real>(), tolerance, levels);
+          K Q = Real(2) * m_imp->integrate(u, error, L1, function, left_limit, tools::min_value<Real>(), tolerance, levels, exec);
           if (L1)
           {
              *L1 *= 2;
@@ -156,23 +270,19 @@ auto tanh_sinh<Real, Policy>::integrate(const F f, Real a, Real b, Real toleranc
        {
           if (a == b)
           {
-             return result_type(0);
+             return K(0);
           }
           if (b < a)
           {
-             return -this->integrate(f, b, a, tolerance, error, L1, levels);
+             return -this->integrate_over_limits<K>(exec, f, b, a, tolerance, error, L1, levels);
           }
-          Real avg = (a + b)*half<Real>();
-          Real diff = (b - a)*half<Real>();
-          Real avg_over_diff_m1 = a / diff;
-          Real avg_over_diff_p1 = b / diff;
-          bool have_small_left = fabs(a) < 0.5f;
-          bool have_small_right = fabs(b) < 0.5f;
-          Real left_min_complement = float_next(avg_over_diff_m1) - avg_over_diff_m1;
+          detail::tanh_sinh_finite_transform<Real> transform(a, b);
+          Real diff = transform.diff;
+          Real left_min_complement = float_next(transform.avg_over_diff_m1) - transform.avg_over_diff_m1;
           Real min_complement_limit = (std::max)(tools::min_value<Real>(), float_next(Real(tools::min_value<Real>() / diff)));
           if (left_min_complement < min_complement_limit)
              left_min_complement = min_complement_limit;
-          Real right_min_complement = avg_over_diff_p1 - float_prior(avg_over_diff_p1);
+          Real right_min_complement = transform.avg_over_diff_p1 - float_prior(transform.avg_over_diff_p1);
           if (right_min_complement < min_complement_limit)
              right_min_complement = min_complement_limit;
           //
@@ -185,28 +295,8 @@ auto tanh_sinh<Real, Policy>::integrate(const F f, Real a, Real b, Real toleranc
           //
           BOOST_MATH_ASSERT((left_min_complement * diff + a) > a);
           BOOST_MATH_ASSERT((b - right_min_complement * diff) < b);
-          auto u = [&](Real z, Real zc)->result_type
-          {
-             Real position;
-             if (z < -0.5)
-             {
-                if(have_small_left)
-                  return f(diff * (avg_over_diff_m1 - zc));
-                position = a - diff * zc;
-             }
-             else if (z > 0.5)
-             {
-                if(have_small_right)
-                  return f(diff * (avg_over_diff_p1 - zc));
-                position = b - diff * zc;
-             }
-             else
-                position = avg + diff*z;
-             BOOST_MATH_ASSERT(position != a);
-             BOOST_MATH_ASSERT(position != b);
-             return f(position);
-          };
-          result_type Q = diff*m_imp->integrate(u, error, L1, function, left_min_complement, right_min_complement, tolerance, levels);
+          auto u = make_transformed_integrand<Real>(f, transform);
+          K Q = diff*m_imp->integrate(u, error, L1, function, left_min_complement, right_min_complement, tolerance, levels, exec);
 
           if (L1)
           {
@@ -219,12 +309,20 @@ auto tanh_sinh<Real, Policy>::integrate(const F f, Real a, Real b, Real toleranc
           return Q;
        }
     }
-    return policies::raise_domain_error(function, "The domain of integration is not sensible; please check the bounds.", a, Policy());
+    return static_cast<K>(policies::raise_domain_error(function, "The domain of integration is not sensible; please check the bounds.", a, Policy()));
 }
 
 template<class Real, class Policy>
 template<class F>
 auto tanh_sinh<Real, Policy>::integrate(const F f, Real a, Real b, Real tolerance, Real* error, Real* L1, std::size_t* levels) const ->decltype(std::declval<F>()(std::declval<Real>(), std::declval<Real>()))
+{
+   detail::sequential_executor exec;
+   return detail::vector_result(integrate_impl(exec, detail::make_vector_integrand<Real>(f), a, b, tolerance, error, L1, levels));
+}
+
+template<class Real, class Policy>
+template<class Executor, class F>
+auto tanh_sinh<Real, Policy>::integrate_impl(Executor& exec, const F& f, Real a, Real b, Real tolerance, Real* error, Real* L1, std::size_t* levels) const ->decltype(std::declval<F>()(std::declval<Real>(), std::declval<Real>()))
 {
    BOOST_MATH_STD_USING
       using boost::math::constants::half;
@@ -248,7 +346,7 @@ auto tanh_sinh<Real, Policy>::integrate(const F f, Real a, Real b, Real toleranc
       Real diff = (b - a)*half<Real>();
       Real left_min_complement = tools::min_value<Real>() * 4;
       Real right_min_complement = tools::min_value<Real>() * 4;
-      Real Q = diff*m_imp->integrate(u, error, L1, function, left_min_complement, right_min_complement, tolerance, levels);
+      Real Q = diff*m_imp->integrate(u, error, L1, function, left_min_complement, right_min_complement, tolerance, levels, exec);
 
       if (L1)
       {
@@ -266,21 +364,55 @@ auto tanh_sinh<Real, Policy>::integrate(const F f, Real a, Real b, Real toleranc
 template<class Real, class Policy>
 template<class F>
 auto tanh_sinh<Real, Policy>::integrate(const F f, Real tolerance, Real* error, Real* L1, std::size_t* levels) const ->decltype(std::declval<F>()(std::declval<Real>()))
+{
+   detail::sequential_executor exec;
+   return detail::vector_result(integrate_impl(exec, detail::make_vector_integrand<Real>(f), tolerance, error, L1, levels));
+}
+
+template<class Real, class Policy>
+template<class Executor, class F>
+auto tanh_sinh<Real, Policy>::integrate_impl(Executor& exec, const F& f, Real tolerance, Real* error, Real* L1, std::size_t* levels) const ->decltype(std::declval<F>()(std::declval<Real>()))
 {
    using boost::math::quadrature::detail::tanh_sinh_detail;
    static const char* function = "tanh_sinh<%1%>::integrate";
    Real min_complement = tools::epsilon<Real>();
-   return m_imp->integrate([&](const Real& arg, const Real&) { return f(arg); }, error, L1, function, min_complement, min_complement, tolerance, levels);
+   return m_imp->integrate(detail::make_transformed_integrand<Real>(f, detail::identity_transform<Real>()), error, L1, function, min_complement, min_complement, tolerance, levels, exec);
 }
 
 template<class Real, class Policy>
 template<class F>
 auto tanh_sinh<Real, Policy>::integrate(const F f, Real tolerance, Real* error, Real* L1, std::size_t* levels) const ->decltype(std::declval<F>()(std::declval<Real>(), std::declval<Real>()))
+{
+   detail::sequential_executor exec;
+   return detail::vector_result(integrate_impl(exec, detail::make_vector_integrand<Real>(f), tolerance, error, L1, levels));
+}
+
+template<class Real, class Policy>
+template<class Executor, class F>
+auto tanh_sinh<Real, Policy>::integrate_impl(Executor& exec, const F& f, Real tolerance, Real* error, Real* L1, std::size_t* levels) const ->decltype(std::declval<F>()(std::declval<Real>(), std::declval<Real>()))
 {
    using boost::math::quadrature::detail::tanh_sinh_detail;
    static const char* function = "tanh_sinh<%1%>::integrate";
    Real min_complement = tools::min_value<Real>() * 4;
-   return m_imp->integrate(f, error, L1, function, min_complement, min_complement, tolerance, levels);
+   return m_imp->integrate(f, error, L1, function, min_complement, min_complement, tolerance, levels, exec);
+}
+
+template<class Real, class Policy>
+template<class F>
+auto tanh_sinh<Real, Policy>::integrate(const F f, Real a, Real b, Real tolerance, Real* error, Real* L1, std::size_t* levels) const ->typename std::enable_if<detail::is_batch_callable<Real, F>::value, Real>::type
+{
+   detail::sequential_executor exec;
+   return integrate_over_limits<Real>(exec, f, a, b, tolerance, error, L1, levels);
+}
+
+template<class Real, class Policy>
+template<class F>
+auto tanh_sinh<Real, Policy>::integrate(const F f, Real tolerance, Real* error, Real* L1, std::size_t* levels) const ->typename std::enable_if<detail::is_batch_callable<Real, F>::value, Real>::type
+{
+   static const char* function = "tanh_sinh<%1%>::integrate";
+   Real min_complement = tools::epsilon<Real>();
+   auto u = detail::make_transformed_integrand<Real>(f, detail::identity_transform<Real>());
+   return m_imp->integrate(u, error, L1, function, min_complement, min_complement, tolerance, levels);
 }
 
 }
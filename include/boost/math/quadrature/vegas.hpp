@@ -0,0 +1,466 @@
+/*
+ * Copyright Boost.Math contributors, 2026
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef BOOST_MATH_QUADRATURE_VEGAS_HPP
+#define BOOST_MATH_QUADRATURE_VEGAS_HPP
+#include <sstream>
+#include <algorithm>
+#include <vector>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <functional>
+#include <future>
+#include <thread>
+#include <utility>
+#include <random>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <boost/math/policies/error_handling.hpp>
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <boost/math/quadrature/detail/monte_carlo_bounds.hpp>
+
+namespace boost { namespace math { namespace quadrature {
+
+namespace detail {
+
+//
+// The statistics gathered from one chunk of samples: the running mean and sum of
+// squared deviations of the weighted integrand, and the sum of its squares and
+// the number of samples in each bin of each dimension of the grid.
+//
+template<class Real>
+struct vegas_chunk
+{
+    uint64_t calls;
+    Real mean;
+    Real M2;
+    std::vector<Real> bin_sums;
+    std::vector<uint64_t> bin_counts;
+};
+
+}
+
+template<class Real, class F, class RandomNumberGenerator = std::mt19937_64, class Policy = boost::math::policies::policy<>,
+         typename std::enable_if<std::is_trivially_copyable<Real>::value, bool>::type = true>
+class vegas
+{
+public:
+    vegas(const F& integrand,
+          std::vector<std::pair<Real, Real>> const & bounds,
+          Real error_goal,
+          bool singular = true,
+          uint64_t threads = std::thread::hardware_concurrency(),
+          uint64_t seed = 0,
+          uint64_t calls_per_iteration = 16384,
+          uint64_t bins = 128)
+        : m_integrand{integrand}, m_num_threads{(std::max)(threads, static_cast<uint64_t>(1))},
+          m_calls_per_iteration{calls_per_iteration}, m_bins{bins}, m_error_goal{error_goal}
+    {
+        static const char* function = "boost::math::quadrature::vegas<%1%>";
+        m_bounds.set(bounds, singular, function, Policy());
+        if (calls_per_iteration < 2)
+        {
+            boost::math::policies::raise_domain_error(function, "At least two calls per iteration are required to estimate the variance, but got %1%.\n", static_cast<Real>(calls_per_iteration), Policy());
+        }
+        if (bins < 2)
+        {
+            boost::math::policies::raise_domain_error(function, "The grid requires at least two bins, but got %1%.\n", static_cast<Real>(bins), Policy());
+        }
+        // If the seed is zero, that tells us to choose a random seed for the user:
+        if (seed == 0)
+        {
+            std::random_device rd;
+            seed = rd();
+        }
+        m_gen.seed(seed);
+
+        // The grid starts out uniform:
+        m_edges.resize(bounds.size()*(bins + 1));
+        for (uint64_t j = 0; j < bounds.size(); ++j)
+        {
+            for (uint64_t i = 0; i <= bins; ++i)
+            {
+                m_edges[j*(bins + 1) + i] = static_cast<Real>(i)/static_cast<Real>(bins);
+            }
+        }
+        m_avg = std::numeric_limits<Real>::quiet_NaN();
+        m_error = (std::numeric_limits<Real>::max)();
+        m_chi_squared = 0;
+        m_start = std::chrono::system_clock::now();
+    }
+
+    std::future<Real> integrate()
+    {
+        // Set done to false in case we wish to restart:
+        m_done.store(false); // relaxed store, no worker threads yet
+        m_start = std::chrono::system_clock::now();
+        return std::async(std::launch::async,
+                          &vegas::m_integrate, this);
+    }
+
+    void cancel()
+    {
+        m_done = true; // relaxed store, worker threads will get the message eventually
+    }
+
+    Real current_error_estimate() const
+    {
+        return m_error.load();
+    }
+
+    std::chrono::duration<Real> estimated_time_to_completion() const
+    {
+        auto now = std::chrono::system_clock::now();
+        std::chrono::duration<Real> elapsed_seconds = now - m_start;
+        Real r = this->current_error_estimate()/m_error_goal.load(); // relaxed load
+        if (r*r <= 1) {
+            return 0*elapsed_seconds;
+        }
+        return (r*r - 1)*elapsed_seconds;
+    }
+
+    void update_target_error(Real new_target_error)
+    {
+        m_error_goal = new_target_error;  // relaxed store
+    }
+
+    Real progress() const
+    {
+        Real r = m_error_goal.load()/this->current_error_estimate();  // relaxed load
+        if (r*r >= 1)
+        {
+            return 1;
+        }
+        return r*r;
+    }
+
+    Real current_estimate() const
+    {
+        return m_avg.load();
+    }
+
+    uint64_t calls() const
+    {
+        return m_total_calls.load();  // relaxed load
+    }
+
+    // The chi-squared per degree of freedom of the iterations combined into the estimate:
+    Real chi_squared() const
+    {
+        return m_chi_squared.load();
+    }
+
+    uint64_t iterations() const
+    {
+        return m_iterations.load();
+    }
+
+private:
+
+    Real m_integrate()
+    {
+        using std::sqrt;
+        while (!m_finished())
+        {
+            uint64_t chunks = (m_calls_per_iteration + chunk_size - 1)/chunk_size;
+            std::vector<detail::vegas_chunk<Real>> results(chunks);
+            std::vector<uint64_t> seeds(chunks);
+            for (auto& s : seeds)
+            {
+                s = m_gen();
+            }
+            m_next_chunk = 0;
+            m_chunks_done = 0;
+            bool first = m_iterations.load() == 0;
+            if (m_num_threads == 1)
+            {
+                m_sample_chunks(chunks, first, seeds, results);
+            }
+            else
+            {
+                std::vector<std::thread> threads((std::min)(m_num_threads, chunks));
+                for (uint64_t i = 0; i < threads.size(); ++i)
+                {
+                    threads[i] = std::thread(&vegas::m_sample_chunks, this, chunks, first, std::cref(seeds), std::ref(results));
+                }
+                std::for_each(threads.begin(), threads.end(),
+                    std::mem_fn(&std::thread::join));
+            }
+            if (m_exception)
+            {
+                std::exception_ptr e = m_exception;
+                m_exception = nullptr;
+                m_abort = false;
+                std::rethrow_exception(e);
+            }
+            // A cancelled iteration is incomplete, and is discarded:
+            if (m_chunks_done.load() < chunks)
+            {
+                break;
+            }
+
+            // Combine the chunks in order, so that the result doesn't depend on the number of threads:
+            uint64_t n = 0;
+            Real mean = 0;
+            Real M2 = 0;
+            std::vector<Real> bin_sums(m_edges.size() - m_bounds.dimension());
+            std::vector<uint64_t> bin_counts(bin_sums.size());
+            for (auto const & chunk : results)
+            {
+                uint64_t total = n + chunk.calls;
+                Real delta = chunk.mean - mean;
+                mean += delta*static_cast<Real>(chunk.calls)/static_cast<Real>(total);
+                M2 += chunk.M2 + delta*delta*static_cast<Real>(n)*static_cast<Real>(chunk.calls)/static_cast<Real>(total);
+                n = total;
+                for (std::size_t i = 0; i < bin_sums.size(); ++i)
+                {
+                    bin_sums[i] += chunk.bin_sums[i];
+                    bin_counts[i] += chunk.bin_counts[i];
+                }
+            }
+            Real variance = M2/(static_cast<Real>(n)*static_cast<Real>(n - 1));
+            m_total_calls += n;
+            m_add_iteration(mean, variance);
+            m_refine_grid(bin_sums, bin_counts);
+        }
+        return m_avg.load(std::memory_order_consume);
+    }
+
+    bool m_finished() const
+    {
+        if (m_done && m_iterations.load() > 0)
+        {
+            return true;
+        }
+        if (m_iterations.load() <= training_iterations)
+        {
+            return false;
+        }
+        // At least two iterations must be combined to check their consistency, unless the estimate is exact:
+        return m_error.load() == 0 || (m_estimates.size() >= 2 && m_error.load() <= m_error_goal.load());
+    }
+
+    // Combines the estimate from an iteration with those of the previous ones, weighted by the inverse of their variances:
+    void m_add_iteration(Real mean, Real variance)
+    {
+        using std::sqrt;
+        ++m_iterations;
+        if (m_iterations.load() <= training_iterations)
+        {
+            m_avg.store(mean, std::memory_order_release);
+            m_error.store(sqrt(variance), std::memory_order_release);
+            return;
+        }
+        if (!(variance > 0))
+        {
+            // The integrand is constant on the grid, so the estimate is exact:
+            m_avg.store(mean, std::memory_order_release);
+            m_error.store(0, std::memory_order_release);
+            m_chi_squared = 0;
+            return;
+        }
+        m_estimates.push_back(mean);
+        m_weights.push_back(1/variance);
+        Real weight = 0;
+        Real avg = 0;
+        for (std::size_t k = 0; k < m_estimates.size(); ++k)
+        {
+            weight += m_weights[k];
+            avg += m_weights[k]*m_estimates[k];
+        }
+        avg /= weight;
+        Real chi_squared = 0;
+        for (std::size_t k = 0; k < m_estimates.size(); ++k)
+        {
+            Real d = m_estimates[k] - avg;
+            chi_squared += m_weights[k]*d*d;
+        }
+        m_avg.store(avg, std::memory_order_release);
+        m_error.store(1/sqrt(weight), std::memory_order_release);
+        m_chi_squared = m_estimates.size() > 1 ? chi_squared/static_cast<Real>(m_estimates.size() - 1) : Real(0);
+    }
+
+    //
+    // Moves the edges of each dimension's bins so that each new bin holds an equal share
+    // of the smoothed and damped mean square of the weighted integrand, as in Lepage's
+    // algorithm.  The grid thereby concentrates the samples where the integrand is
+    // largest, and the integrand's variance is reduced.  Means rather than sums are
+    // used so that the random number of samples in each bin doesn't perturb the grid.
+    //
+    void m_refine_grid(std::vector<Real> const & bin_sums, std::vector<uint64_t> const & bin_counts)
+    {
+        using std::log;
+        using std::pow;
+        const Real alpha = 1.5;
+        std::vector<Real> means(m_bins);
+        std::vector<Real> d(m_bins);
+        std::vector<Real> r(m_bins);
+        std::vector<Real> new_edges(m_bins + 1);
+        for (uint64_t j = 0; j < m_bounds.dimension(); ++j)
+        {
+            Real* edges = m_edges.data() + j*(m_bins + 1);
+            for (uint64_t i = 0; i < m_bins; ++i)
+            {
+                uint64_t count = bin_counts[j*m_bins + i];
+                means[i] = count > 0 ? bin_sums[j*m_bins + i]/static_cast<Real>(count) : Real(0);
+            }
+            // Smooth the means with their neighbours:
+            d[0] = (3*means[0] + means[1])/4;
+            for (uint64_t i = 1; i + 1 < m_bins; ++i)
+            {
+                d[i] = (means[i - 1] + 2*means[i] + means[i + 1])/4;
+            }
+            d[m_bins - 1] = (means[m_bins - 2] + 3*means[m_bins - 1])/4;
+            Real total = 0;
+            for (uint64_t i = 0; i < m_bins; ++i)
+            {
+                total += d[i];
+            }
+            if (!(total > 0) || !(boost::math::isfinite)(total))
+            {
+                continue;
+            }
+            // Damp the change, so that the grid converges rather than oscillating:
+            Real r_total = 0;
+            for (uint64_t i = 0; i < m_bins; ++i)
+            {
+                Real x = d[i]/total;
+                r[i] = (x > 0) && (x < 1) ? pow((x - 1)/log(x), alpha) : (x >= 1 ? Real(1) : Real(0));
+                r_total += r[i];
+            }
+            Real delta = r_total/static_cast<Real>(m_bins);
+            new_edges[0] = 0;
+            new_edges[m_bins] = 1;
+            Real accumulated = 0;
+            uint64_t k = 0;
+            for (uint64_t i = 1; i < m_bins; ++i)
+            {
+                Real target = delta*static_cast<Real>(i);
+                while (k + 1 < m_bins && accumulated + r[k] < target)
+                {
+                    accumulated += r[k];
+                    ++k;
+                }
+                Real fraction = r[k] > 0 ? (std::min)((target - accumulated)/r[k], Real(1)) : Real(1);
+                new_edges[i] = (std::max)(edges[k] + fraction*(edges[k + 1] - edges[k]), new_edges[i - 1]);
+            }
+            std::copy(new_edges.begin(), new_edges.end(), edges);
+        }
+    }
+
+    void m_sample_chunks(uint64_t chunks, bool first, std::vector<uint64_t> const & seeds, std::vector<detail::vegas_chunk<Real>>& results)
+    {
+        using std::isfinite;
+        try
+        {
+            const uint64_t dimension = m_bounds.dimension();
+            std::vector<Real> x(dimension);
+            std::vector<uint64_t> bin(dimension);
+            for (uint64_t c = m_next_chunk++; c < chunks; c = m_next_chunk++)
+            {
+                // The first iteration must complete, so that there's an estimate to return:
+                if (m_abort || (m_done && !first))
+                {
+                    return;
+                }
+                RandomNumberGenerator gen(seeds[c]);
+                Real inv_denom = static_cast<Real>(1) / static_cast<Real>(( (gen.max)() - (gen.min)() ));
+                detail::vegas_chunk<Real>& chunk = results[c];
+                uint64_t remaining = m_calls_per_iteration - c*chunk_size;
+                chunk.calls = remaining < chunk_size ? remaining : chunk_size;
+                chunk.mean = 0;
+                chunk.M2 = 0;
+                chunk.bin_sums.assign(dimension*m_bins, Real(0));
+                chunk.bin_counts.assign(dimension*m_bins, 0);
+                for (uint64_t k = 1; k <= chunk.calls; ++k)
+                {
+                    // Choose a bin uniformly in each dimension, then a point uniformly within it:
+                    Real jacobian = 1;
+                    for (uint64_t j = 0; j < dimension; ++j)
+                    {
+                        Real y = static_cast<Real>((gen() - (gen.min)()))*inv_denom*static_cast<Real>(m_bins);
+                        uint64_t b = (std::min)(static_cast<uint64_t>(y), m_bins - 1);
+                        const Real* edges = m_edges.data() + j*(m_bins + 1);
+                        Real width = edges[b + 1] - edges[b];
+                        x[j] = edges[b] + (y - static_cast<Real>(b))*width;
+                        jacobian *= width*static_cast<Real>(m_bins);
+                        bin[j] = b;
+                    }
+                    Real coeff = m_bounds.transform(x);
+                    Real f = jacobian*coeff*m_integrand(x);
+                    if (!isfinite(f))
+                    {
+                        // The call to transform changed x, so this error message states the correct node.
+                        std::stringstream os;
+                        os << "Your integrand was evaluated at {";
+                        for (uint64_t i = 0; i < x.size() -1; ++i)
+                        {
+                             os << x[i] << ", ";
+                        }
+                        os << x[x.size() -1] << "}, and returned " << f << std::endl;
+                        static const char* function = "boost::math::quadrature::vegas<%1%>";
+                        boost::math::policies::raise_domain_error(function, os.str().c_str(), /*this is a dummy arg to make it compile*/ 7.2, Policy());
+                    }
+                    Real delta = f - chunk.mean;
+                    chunk.mean += delta/static_cast<Real>(k);
+                    chunk.M2 += delta*(f - chunk.mean);
+                    for (uint64_t j = 0; j < dimension; ++j)
+                    {
+                        chunk.bin_sums[j*m_bins + bin[j]] += f*f;
+                        ++chunk.bin_counts[j*m_bins + bin[j]];
+                    }
+                }
+                ++m_chunks_done;
+            }
+        }
+        catch (...)
+        {
+            // Signal the other threads that the computation is ruined:
+            m_abort = true;
+            std::lock_guard<std::mutex> lock(m_exception_mutex); // Scoped lock to prevent race writing to m_exception
+            m_exception = std::current_exception();
+        }
+    }
+
+    // The samples of each iteration are drawn in chunks, each from its own generator
+    // seeded in order by the master, so the result depends on the seed but not on the
+    // number of threads:
+    static constexpr uint64_t chunk_size = 1024;
+    // The number of iterations which only train the grid, and are not combined into the estimate:
+    static constexpr uint64_t training_iterations = 5;
+
+    F m_integrand;
+    uint64_t m_num_threads;
+    uint64_t m_calls_per_iteration;
+    uint64_t m_bins;
+    detail::monte_carlo_bounds<Real> m_bounds;
+    RandomNumberGenerator m_gen;
+    // The edges of the bins in each dimension of the unit cube, m_bins + 1 per dimension:
+    std::vector<Real> m_edges;
+    // The estimates and weights of the iterations combined so far:
+    std::vector<Real> m_estimates;
+    std::vector<Real> m_weights;
+    std::atomic<uint64_t> m_next_chunk{};
+    std::atomic<uint64_t> m_chunks_done{};
+    std::atomic<uint64_t> m_iterations{};
+    std::atomic<Real> m_error_goal;
+    std::atomic<bool> m_done{};
+    std::atomic<bool> m_abort{};
+    std::atomic<uint64_t> m_total_calls{};
+    std::atomic<Real> m_avg;
+    std::atomic<Real> m_error;
+    std::atomic<Real> m_chi_squared;
+    std::chrono::time_point<std::chrono::system_clock> m_start;
+    std::exception_ptr m_exception;
+    std::mutex m_exception_mutex;
+};
+
+}}}
+#endif
@@ -203,25 +203,47 @@ T beta_imp(T a, T b, const lanczos::undefined_lanczos& l, const Policy& pol)
 // powers are *hard* though, and using logarithms just leads to
 // horrendous cancellation errors.
 //
+// The terms which depend only upon a and b are split out into
+// ibeta_power_terms_constants so that callers evaluating at many x
+// for fixed a and b can compute them just once:
+//
+template <class T>
+struct ibeta_power_terms_constants
+{
+   T lanczos_ratio;  // lanczos_sum_expG_scaled(a+b) / (lanczos_sum_expG_scaled(a) * lanczos_sum_expG_scaled(b))
+   T sqrt_bgh_e;     // sqrt(bgh / e)
+   T sqrt_agh_cgh;   // sqrt(agh / cgh)
+};
+
+template <class T, class Lanczos>
+ibeta_power_terms_constants<T> make_ibeta_power_terms_constants(T a, T b, const Lanczos&)
+{
+   BOOST_MATH_STD_USING
+
+   T c = a + b;
+   T agh = static_cast<T>(a + Lanczos::g() - 0.5f);
+   T bgh = static_cast<T>(b + Lanczos::g() - 0.5f);
+   T cgh = static_cast<T>(c + Lanczos::g() - 0.5f);
+   ibeta_power_terms_constants<T> k;
+   k.lanczos_ratio = Lanczos::lanczos_sum_expG_scaled(c) / (Lanczos::lanczos_sum_expG_scaled(a) * Lanczos::lanczos_sum_expG_scaled(b));
+   k.sqrt_bgh_e = sqrt(bgh / boost::math::constants::e<T>());
+   k.sqrt_agh_cgh = sqrt(agh / cgh);
+   return k;
+}
+
 template <class T, class Lanczos, class Policy>
 T ibeta_power_terms(T a,
                         T b,
                         T x,
                         T y,
                         const Lanczos&,
-                        bool normalised,
                         const Policy& pol,
-                        T prefix = 1,
-                        const char* function = "boost::math::ibeta<%1%>(%1%, %1%, %1%)")
+                        T prefix,
+                        const char* function,
+                        const ibeta_power_terms_constants<T>& k)
 {
    BOOST_MATH_STD_USING
 
-   if(!normalised)
-   {
-      // can we do better here?
-      return pow(x, a) * pow(y, b);
-   }
-
    T result;
 
    T c = a + b;
@@ -230,11 +252,11 @@ T ibeta_power_terms(T a,
    T agh = static_cast<T>(a + Lanczos::g() - 0.5f);
    T bgh = static_cast<T>(b + Lanczos::g() - 0.5f);
    T cgh = static_cast<T>(c + Lanczos::g() - 0.5f);
-   result = Lanczos::lanczos_sum_expG_scaled(c) / (Lanczos::lanczos_sum_expG_scaled(a) * Lanczos::lanczos_sum_expG_scaled(b));
+   result = k.lanczos_ratio;
    result *= prefix;
    // combine with the leftover terms from the Lanczos approximation:
-   result *= sqrt(bgh / boost::math::constants::e<T>());
-   result *= sqrt(agh / cgh);
+   result *= k.sqrt_bgh_e;
+   result *= k.sqrt_agh_cgh;
 
    // l1 and l2 are the base of the exponents minus one:
    T l1 = (x * b - y * agh) / agh;
@@ -427,6 +449,27 @@ T ibeta_power_terms(T a,
 
    return result;
 }
+
+template <class T, class Lanczos, class Policy>
+inline T ibeta_power_terms(T a,
+                        T b,
+                        T x,
+                        T y,
+                        const Lanczos& l,
+                        bool normalised,
+                        const Policy& pol,
+                        T prefix = 1,
+                        const char* function = "boost::math::ibeta<%1%>(%1%, %1%, %1%)")
+{
+   BOOST_MATH_STD_USING
+
+   if(!normalised)
+   {
+      // can we do better here?
+      return pow(x, a) * pow(y, b);
+   }
+   return ibeta_power_terms(a, b, x, y, l, pol, prefix, function, make_ibeta_power_terms_constants(a, b, l));
+}
 //
 // Compute the leading power terms in the incomplete Beta:
 //
@@ -529,6 +572,28 @@ T ibeta_power_terms(T a,
    }
    return prefix * power1 * (power2 / bet);
 }
+
+template <class T>
+inline ibeta_power_terms_constants<T> make_ibeta_power_terms_constants(T, T, const boost::math::lanczos::undefined_lanczos&)
+{
+   // Nothing to cache without a Lanczos approximation:
+   ibeta_power_terms_constants<T> k = { 0, 0, 0 };
+   return k;
+}
+
+template <class T, class Policy>
+inline T ibeta_power_terms(T a,
+                        T b,
+                        T x,
+                        T y,
+                        const boost::math::lanczos::undefined_lanczos& l,
+                        const Policy& pol,
+                        T prefix,
+                        const char* function,
+                        const ibeta_power_terms_constants<T>&)
+{
+   return ibeta_power_terms(a, b, x, y, l, true, pol, prefix, function);
+}
 //
 // Series approximation to the incomplete beta:
 //
@@ -1456,6 +1521,19 @@ T ibeta_derivative_imp(T a, T b, T x, const Policy& pol)
    return f1;
 }
 //
+// The regular case of the above, for 0 < x < 1 and valid a and b, with
+// the terms which depend only on a and b already calculated:
+//
+template <class T, class Policy>
+T ibeta_derivative_imp(T a, T b, T x, const Policy& pol, const ibeta_power_terms_constants<T>& k)
+{
+   static const char* function = "ibeta_derivative<%1%>(%1%,%1%,%1%)";
+   typedef typename lanczos::lanczos<T, Policy>::type lanczos_type;
+   T y = (1 - x) * x;
+   T f1 = ibeta_power_terms<T>(a, b, x, 1 - x, lanczos_type(), pol, 1 / y, function, k);
+   return f1;
+}
+//
 // Some forwarding functions that disambiguate the third argument type:
 //
 template <class RT1, class RT2, class Policy>
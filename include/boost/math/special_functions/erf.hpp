@@ -16,6 +16,11 @@
 #include <boost/math/tools/roots.hpp>
 #include <boost/math/policies/error_handling.hpp>
 #include <boost/math/tools/big_constant.hpp>
+#include <boost/math/tools/assert.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
 
 #if defined(__GNUC__) && defined(BOOST_MATH_USE_FLOAT128)
 //
@@ -190,6 +195,175 @@ T erf_imp(T z, bool invert, const Policy& pol, const Tag& t)
    return result;
 }
 
+//
+// The rational approximations used by the 53-bit erf_imp are split out
+// below so that the same coefficients can be applied either to a single
+// argument, or (by erf_batch_imp) to a contiguous run of arguments which
+// all fall in the same interval.
+//
+// erf_53_small returns erf(z) for 1e-10 <= z < 0.5, the erfc_53_ratio_N
+// functions return erfc(z) * exp(z*z) * z over their respective intervals:
+//
+template <class T>
+inline T erf_53_small(const T& z)
+{
+   // Maximum Deviation Found:                     1.561e-17
+   // Expected Error Term:                         1.561e-17
+   // Maximum Relative Change in Control Points:   1.155e-04
+   // Max Error found at double precision =        2.961182e-17
+
+   static const T Y = 1.044948577880859375f;
+   static const T P[] = {
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.0834305892146531832907),
+      BOOST_MATH_BIG_CONSTANT(T, 53, -0.338165134459360935041),
+      BOOST_MATH_BIG_CONSTANT(T, 53, -0.0509990735146777432841),
+      BOOST_MATH_BIG_CONSTANT(T, 53, -0.00772758345802133288487),
+      BOOST_MATH_BIG_CONSTANT(T, 53, -0.000322780120964605683831),
+   };
+   static const T Q[] = {
+      BOOST_MATH_BIG_CONSTANT(T, 53, 1.0),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.455004033050794024546),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.0875222600142252549554),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.00858571925074406212772),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.000370900071787748000569),
+   };
+   T zz = z * z;
+   return z * (Y + tools::evaluate_polynomial(P, zz) / tools::evaluate_polynomial(Q, zz));
+}
+
+template <class T>
+inline T erfc_53_ratio_1(const T& z)
+{
+   // 0.5 <= z < 1.5:
+   // Maximum Deviation Found:                     3.702e-17
+   // Expected Error Term:                         3.702e-17
+   // Maximum Relative Change in Control Points:   2.845e-04
+   // Max Error found at double precision =        4.841816e-17
+   static const T Y = 0.405935764312744140625f;
+   static const T P[] = {
+      BOOST_MATH_BIG_CONSTANT(T, 53, -0.098090592216281240205),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.178114665841120341155),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.191003695796775433986),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.0888900368967884466578),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.0195049001251218801359),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.00180424538297014223957),
+   };
+   static const T Q[] = {
+      BOOST_MATH_BIG_CONSTANT(T, 53, 1.0),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 1.84759070983002217845),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 1.42628004845511324508),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.578052804889902404909),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.12385097467900864233),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.0113385233577001411017),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.337511472483094676155e-5),
+   };
+   return Y + tools::evaluate_polynomial(P, T(z - 0.5)) / tools::evaluate_polynomial(Q, T(z - 0.5));
+}
+
+template <class T>
+inline T erfc_53_ratio_2(const T& z)
+{
+   // 1.5 <= z < 2.5:
+   // Max Error found at double precision =        6.599585e-18
+   // Maximum Deviation Found:                     3.909e-18
+   // Expected Error Term:                         3.909e-18
+   // Maximum Relative Change in Control Points:   9.886e-05
+   static const T Y = 0.50672817230224609375f;
+   static const T P[] = {
+      BOOST_MATH_BIG_CONSTANT(T, 53, -0.0243500476207698441272),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.0386540375035707201728),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.04394818964209516296),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.0175679436311802092299),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.00323962406290842133584),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.000235839115596880717416),
+   };
+   static const T Q[] = {
+      BOOST_MATH_BIG_CONSTANT(T, 53, 1.0),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 1.53991494948552447182),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.982403709157920235114),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.325732924782444448493),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.0563921837420478160373),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.00410369723978904575884),
+   };
+   return Y + tools::evaluate_polynomial(P, T(z - 1.5)) / tools::evaluate_polynomial(Q, T(z - 1.5));
+}
+
+template <class T>
+inline T erfc_53_ratio_3(const T& z)
+{
+   // 2.5 <= z < 4.5:
+   // Maximum Deviation Found:                     1.512e-17
+   // Expected Error Term:                         1.512e-17
+   // Maximum Relative Change in Control Points:   2.222e-04
+   // Max Error found at double precision =        2.062515e-17
+   static const T Y = 0.5405750274658203125f;
+   static const T P[] = {
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.00295276716530971662634),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.0137384425896355332126),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.00840807615555585383007),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.00212825620914618649141),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.000250269961544794627958),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.113212406648847561139e-4),
+   };
+   static const T Q[] = {
+      BOOST_MATH_BIG_CONSTANT(T, 53, 1.0),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 1.04217814166938418171),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.442597659481563127003),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.0958492726301061423444),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.0105982906484876531489),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.000479411269521714493907),
+   };
+   return Y + tools::evaluate_polynomial(P, T(z - 3.5)) / tools::evaluate_polynomial(Q, T(z - 3.5));
+}
+
+template <class T>
+inline T erfc_53_ratio_4(const T& z)
+{
+   // z >= 4.5:
+   // Max Error found at double precision =        2.997958e-17
+   // Maximum Deviation Found:                     2.860e-17
+   // Expected Error Term:                         2.859e-17
+   // Maximum Relative Change in Control Points:   1.357e-05
+   static const T Y = 0.5579090118408203125f;
+   static const T P[] = {
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.00628057170626964891937),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 0.0175389834052493308818),
+      BOOST_MATH_BIG_CONSTANT(T, 53, -0.212652252872804219852),
+      BOOST_MATH_BIG_CONSTANT(T, 53, -0.687717681153649930619),
+      BOOST_MATH_BIG_CONSTANT(T, 53, -2.5518551727311523996),
+      BOOST_MATH_BIG_CONSTANT(T, 53, -3.22729451764143718517),
+      BOOST_MATH_BIG_CONSTANT(T, 53, -2.8175401114513378771),
+   };
+   static const T Q[] = {
+      BOOST_MATH_BIG_CONSTANT(T, 53, 1.0),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 2.79257750980575282228),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 11.0567237927800161565),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 15.930646027911794143),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 22.9367376522880577224),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 13.5064170191802889145),
+      BOOST_MATH_BIG_CONSTANT(T, 53, 5.48409182238641741584),
+   };
+   return Y + tools::evaluate_polynomial(P, T(1 / z)) / tools::evaluate_polynomial(Q, T(1 / z));
+}
+
+//
+// Returns exp(-z*z) / z, with z*z split into high and low parts so that
+// the error in the exponent does not swamp the result for z > 1.5:
+//
+template <class T>
+inline T erfc_53_exp_scale(const T& z)
+{
+   BOOST_MATH_STD_USING
+   T hi, lo;
+   int expon;
+   hi = floor(ldexp(frexp(z, &expon), 26));
+   hi = ldexp(hi, expon - 26);
+   lo = z - hi;
+   T sq = z * z;
+   T err_sqr = ((hi * hi - sq) + 2 * hi * lo) + lo * lo;
+   return exp(-sq) * exp(-err_sqr) / z;
+}
+
 template <class T, class Policy>
 T erf_imp(T z, bool invert, const Policy& pol, const std::integral_constant<int, 53>& t)
 {
@@ -236,28 +410,7 @@ T erf_imp(T z, bool invert, const Policy& pol, const std::integral_constant<int,
       }
       else
       {
-         // Maximum Deviation Found:                     1.561e-17
-         // Expected Error Term:                         1.561e-17
-         // Maximum Relative Change in Control Points:   1.155e-04
-         // Max Error found at double precision =        2.961182e-17
-
-         static const T Y = 1.044948577880859375f;
-         static const T P[] = {    
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.0834305892146531832907),
-            BOOST_MATH_BIG_CONSTANT(T, 53, -0.338165134459360935041),
-            BOOST_MATH_BIG_CONSTANT(T, 53, -0.0509990735146777432841),
-            BOOST_MATH_BIG_CONSTANT(T, 53, -0.00772758345802133288487),
-            BOOST_MATH_BIG_CONSTANT(T, 53, -0.000322780120964605683831),
-         };
-         static const T Q[] = {    
-            BOOST_MATH_BIG_CONSTANT(T, 53, 1.0),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.455004033050794024546),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.0875222600142252549554),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.00858571925074406212772),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.000370900071787748000569),
-         };
-         T zz = z * z;
-         result = z * (Y + tools::evaluate_polynomial(P, zz) / tools::evaluate_polynomial(Q, zz));
+         result = erf_53_small(z);
       }
    }
    else if(invert ? (z < 28) : (z < 5.93f))
@@ -268,137 +421,26 @@ T erf_imp(T z, bool invert, const Policy& pol, const std::integral_constant<int,
       invert = !invert;
       if(z < 1.5f)
       {
-         // Maximum Deviation Found:                     3.702e-17
-         // Expected Error Term:                         3.702e-17
-         // Maximum Relative Change in Control Points:   2.845e-04
-         // Max Error found at double precision =        4.841816e-17
-         static const T Y = 0.405935764312744140625f;
-         static const T P[] = {    
-            BOOST_MATH_BIG_CONSTANT(T, 53, -0.098090592216281240205),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.178114665841120341155),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.191003695796775433986),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.0888900368967884466578),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.0195049001251218801359),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.00180424538297014223957),
-         };
-         static const T Q[] = {    
-            BOOST_MATH_BIG_CONSTANT(T, 53, 1.0),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 1.84759070983002217845),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 1.42628004845511324508),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.578052804889902404909),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.12385097467900864233),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.0113385233577001411017),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.337511472483094676155e-5),
-         };
-         BOOST_MATH_INSTRUMENT_VARIABLE(Y);
-         BOOST_MATH_INSTRUMENT_VARIABLE(P[0]);
-         BOOST_MATH_INSTRUMENT_VARIABLE(Q[0]);
          BOOST_MATH_INSTRUMENT_VARIABLE(z);
-         result = Y + tools::evaluate_polynomial(P, T(z - 0.5)) / tools::evaluate_polynomial(Q, T(z - 0.5));
+         result = erfc_53_ratio_1(z);
          BOOST_MATH_INSTRUMENT_VARIABLE(result);
          result *= exp(-z * z) / z;
          BOOST_MATH_INSTRUMENT_VARIABLE(result);
       }
       else if(z < 2.5f)
       {
-         // Max Error found at double precision =        6.599585e-18
-         // Maximum Deviation Found:                     3.909e-18
-         // Expected Error Term:                         3.909e-18
-         // Maximum Relative Change in Control Points:   9.886e-05
-         static const T Y = 0.50672817230224609375f;
-         static const T P[] = {    
-            BOOST_MATH_BIG_CONSTANT(T, 53, -0.0243500476207698441272),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.0386540375035707201728),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.04394818964209516296),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.0175679436311802092299),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.00323962406290842133584),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.000235839115596880717416),
-         };
-         static const T Q[] = {    
-            BOOST_MATH_BIG_CONSTANT(T, 53, 1.0),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 1.53991494948552447182),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.982403709157920235114),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.325732924782444448493),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.0563921837420478160373),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.00410369723978904575884),
-         };
-         result = Y + tools::evaluate_polynomial(P, T(z - 1.5)) / tools::evaluate_polynomial(Q, T(z - 1.5));
-         T hi, lo;
-         int expon;
-         hi = floor(ldexp(frexp(z, &expon), 26));
-         hi = ldexp(hi, expon - 26);
-         lo = z - hi;
-         T sq = z * z;
-         T err_sqr = ((hi * hi - sq) + 2 * hi * lo) + lo * lo;
-         result *= exp(-sq) * exp(-err_sqr) / z;
+         result = erfc_53_ratio_2(z);
+         result *= erfc_53_exp_scale(z);
       }
       else if(z < 4.5f)
       {
-         // Maximum Deviation Found:                     1.512e-17
-         // Expected Error Term:                         1.512e-17
-         // Maximum Relative Change in Control Points:   2.222e-04
-         // Max Error found at double precision =        2.062515e-17
-         static const T Y = 0.5405750274658203125f;
-         static const T P[] = {    
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.00295276716530971662634),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.0137384425896355332126),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.00840807615555585383007),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.00212825620914618649141),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.000250269961544794627958),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.113212406648847561139e-4),
-         };
-         static const T Q[] = {    
-            BOOST_MATH_BIG_CONSTANT(T, 53, 1.0),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 1.04217814166938418171),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.442597659481563127003),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.0958492726301061423444),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.0105982906484876531489),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.000479411269521714493907),
-         };
-         result = Y + tools::evaluate_polynomial(P, T(z - 3.5)) / tools::evaluate_polynomial(Q, T(z - 3.5));
-         T hi, lo;
-         int expon;
-         hi = floor(ldexp(frexp(z, &expon), 26));
-         hi = ldexp(hi, expon - 26);
-         lo = z - hi;
-         T sq = z * z;
-         T err_sqr = ((hi * hi - sq) + 2 * hi * lo) + lo * lo;
-         result *= exp(-sq) * exp(-err_sqr) / z;
+         result = erfc_53_ratio_3(z);
+         result *= erfc_53_exp_scale(z);
       }
       else
       {
-         // Max Error found at double precision =        2.997958e-17
-         // Maximum Deviation Found:                     2.860e-17
-         // Expected Error Term:                         2.859e-17
-         // Maximum Relative Change in Control Points:   1.357e-05
-         static const T Y = 0.5579090118408203125f;
-         static const T P[] = {    
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.00628057170626964891937),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 0.0175389834052493308818),
-            BOOST_MATH_BIG_CONSTANT(T, 53, -0.212652252872804219852),
-            BOOST_MATH_BIG_CONSTANT(T, 53, -0.687717681153649930619),
-            BOOST_MATH_BIG_CONSTANT(T, 53, -2.5518551727311523996),
-            BOOST_MATH_BIG_CONSTANT(T, 53, -3.22729451764143718517),
-            BOOST_MATH_BIG_CONSTANT(T, 53, -2.8175401114513378771),
-         };
-         static const T Q[] = {    
-            BOOST_MATH_BIG_CONSTANT(T, 53, 1.0),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 2.79257750980575282228),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 11.0567237927800161565),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 15.930646027911794143),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 22.9367376522880577224),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 13.5064170191802889145),
-            BOOST_MATH_BIG_CONSTANT(T, 53, 5.48409182238641741584),
-         };
-         result = Y + tools::evaluate_polynomial(P, T(1 / z)) / tools::evaluate_polynomial(Q, T(1 / z));
-         T hi, lo;
-         int expon;
-         hi = floor(ldexp(frexp(z, &expon), 26));
-         hi = ldexp(hi, expon - 26);
-         lo = z - hi;
-         T sq = z * z;
-         T err_sqr = ((hi * hi - sq) + 2 * hi * lo) + lo * lo;
-         result *= exp(-sq) * exp(-err_sqr) / z;
+         result = erfc_53_ratio_4(z);
+         result *= erfc_53_exp_scale(z);
       }
    }
    else
@@ -1173,6 +1215,168 @@ struct erf_initializer
 template <class T, class Policy, class tag>
 const typename erf_initializer<T, Policy, tag>::init erf_initializer<T, Policy, tag>::initializer;
 
+//
+// Batched evaluation of erf and erfc.
+//
+// Arguments are processed in blocks of erf_batch_block_size, and the
+// generic version simply forwards each element of a block to erf_imp,
+// so the only saving is that policy normalisation and initialisation are
+// done once per batch rather than once per call:
+//
+constexpr std::size_t erf_batch_block_size = 64;
+
+template <class T, class Policy, class Tag>
+void erf_batch_imp(const T* z, T* result, std::size_t n, bool invert, const Policy& pol, const Tag& t, bool&, T&)
+{
+   for(std::size_t i = 0; i < n; ++i)
+      result[i] = erf_imp(z[i], invert, pol, t);
+}
+//
+// The 53-bit version partitions each block by approximation interval (a
+// counting sort on the interval index), so that each rational approximation
+// is applied to a contiguous run of arguments in a loop that is free of data
+// dependent branches and which the compiler can vectorise.  The results are
+// identical to those of erf_imp.  A NaN argument raises the same error as
+// erf_imp, but only the first time one is seen in a batch, the value returned
+// by the error handler is then used for every NaN in the batch:
+//
+template <class T, class Policy>
+void erf_batch_imp(const T* z, T* result, std::size_t n, bool invert, const Policy& pol, const std::integral_constant<int, 53>&, bool& nan_seen, T& nan_result)
+{
+   BOOST_MATH_STD_USING
+
+   BOOST_MATH_ASSERT(n <= erf_batch_block_size);
+
+   //
+   // Interval indexes, 0 and 1 calculate erf(|z|), 2 to 6 calculate erfc(|z|):
+   //
+   enum { tiny = 0, small = 1, erfc_1 = 2, erfc_2 = 3, erfc_3 = 4, erfc_4 = 5, underflow = 6, not_a_number = 7, interval_count = 8 };
+
+   const T limit = invert ? T(28) : T(5.93f);
+
+   unsigned char interval[erf_batch_block_size];
+   std::size_t order[erf_batch_block_size];
+   std::size_t offsets[interval_count + 1] = { 0 };
+   T x[erf_batch_block_size];
+   T v[erf_batch_block_size];
+
+   for(std::size_t i = 0; i < n; ++i)
+   {
+      T a = fabs(z[i]);
+      unsigned char k = (boost::math::isnan)(z[i]) ? not_a_number
+         : a < 1e-10 ? tiny : a < 0.5 ? small : a < 1.5f ? erfc_1 : a < 2.5f ? erfc_2
+         : a < 4.5f ? erfc_3 : a < limit ? erfc_4 : underflow;
+      interval[i] = k;
+      ++offsets[k + 1];
+   }
+   for(unsigned k = 1; k <= interval_count; ++k)
+      offsets[k] += offsets[k - 1];
+   {
+      std::size_t position[interval_count];
+      std::copy(offsets, offsets + interval_count, position);
+      for(std::size_t i = 0; i < n; ++i)
+      {
+         std::size_t p = position[interval[i]]++;
+         order[p] = i;
+         x[p] = fabs(z[i]);
+      }
+   }
+
+   static const T c = BOOST_MATH_BIG_CONSTANT(T, 53, 0.003379167095512573896158903121545171688);
+   for(std::size_t k = offsets[tiny]; k < offsets[tiny + 1]; ++k)
+      v[k] = x[k] == 0 ? T(0) : static_cast<T>(x[k] * 1.125f + x[k] * c);
+   for(std::size_t k = offsets[small]; k < offsets[small + 1]; ++k)
+      v[k] = erf_53_small(x[k]);
+   for(std::size_t k = offsets[erfc_1]; k < offsets[erfc_1 + 1]; ++k)
+      v[k] = erfc_53_ratio_1(x[k]);
+   for(std::size_t k = offsets[erfc_2]; k < offsets[erfc_2 + 1]; ++k)
+      v[k] = erfc_53_ratio_2(x[k]);
+   for(std::size_t k = offsets[erfc_3]; k < offsets[erfc_3 + 1]; ++k)
+      v[k] = erfc_53_ratio_3(x[k]);
+   for(std::size_t k = offsets[erfc_4]; k < offsets[erfc_4 + 1]; ++k)
+      v[k] = erfc_53_ratio_4(x[k]);
+   for(std::size_t k = offsets[underflow]; k < offsets[underflow + 1]; ++k)
+      v[k] = 0;
+   //
+   // Scale the erfc approximations, this is where the time goes:
+   //
+   for(std::size_t k = offsets[erfc_1]; k < offsets[erfc_1 + 1]; ++k)
+      v[k] *= exp(-x[k] * x[k]) / x[k];
+   for(std::size_t k = offsets[erfc_2]; k < offsets[underflow]; ++k)
+      v[k] *= erfc_53_exp_scale(x[k]);
+
+   if((offsets[not_a_number] != offsets[interval_count]) && !nan_seen)
+   {
+      nan_result = policies::raise_denorm_error("boost::math::erf<%1%>(%1%)", "Expected a finite argument but got %1%", z[order[offsets[not_a_number]]], pol);
+      nan_seen = true;
+   }
+   //
+   // Scatter back to the original order, applying the same reflection
+   // formulas as erf_imp:
+   //
+   for(std::size_t k = 0; k < n; ++k)
+   {
+      std::size_t i = order[k];
+      bool is_erf = k < offsets[erfc_1];
+      T r;
+      if(k >= offsets[not_a_number])
+         r = nan_result;
+      else if(!invert)
+      {
+         r = is_erf ? v[k] : T(1 - v[k]);
+         if(z[i] < 0)
+            r = -r;
+      }
+      else if(z[i] < -0.5)
+         r = 2 - v[k];
+      else if(z[i] < 0)
+         r = 1 + (is_erf ? v[k] : T(1 - v[k]));
+      else
+         r = is_erf ? T(1 - v[k]) : v[k];
+      result[i] = r;
+   }
+}
+
+template <class ForwardIterator, class OutputIterator, class Policy>
+OutputIterator erf_batch(ForwardIterator first, ForwardIterator last, OutputIterator out, bool invert, const Policy&, const char* function)
+{
+   typedef typename std::iterator_traits<ForwardIterator>::value_type argument_type;
+   typedef typename tools::promote_args<argument_type>::type result_type;
+   typedef typename policies::evaluation<result_type, Policy>::type value_type;
+   typedef typename policies::precision<result_type, Policy>::type precision_type;
+   typedef typename policies::normalise<
+      Policy,
+      policies::promote_float<false>,
+      policies::promote_double<false>,
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+
+   typedef std::integral_constant<int,
+      precision_type::value <= 0 ? 0 :
+      precision_type::value <= 53 ? 53 :
+      precision_type::value <= 64 ? 64 :
+      precision_type::value <= 113 ? 113 : 0
+   > tag_type;
+
+   detail::erf_initializer<value_type, forwarding_policy, tag_type>::force_instantiate(); // Force constants to be initialized before main
+
+   value_type z[erf_batch_block_size];
+   value_type result[erf_batch_block_size];
+   bool nan_seen = false;
+   value_type nan_result = 0;
+
+   while(first != last)
+   {
+      std::size_t n = 0;
+      for(; (n < erf_batch_block_size) && (first != last); ++n, ++first)
+         z[n] = static_cast<value_type>(*first);
+      erf_batch_imp(z, result, n, invert, forwarding_policy(), tag_type(), nan_seen, nan_result);
+      for(std::size_t i = 0; i < n; ++i, ++out)
+         *out = policies::checked_narrowing_cast<result_type, forwarding_policy>(result[i], function);
+   }
+   return out;
+}
+
 } // namespace detail
 
 template <class T, class Policy>
@@ -1257,6 +1461,39 @@ inline typename tools::promote_args<T>::type erfc(T z)
    return boost::math::erfc(z, policies::policy<>());
 }
 
+//
+// Batched versions, these evaluate erf or erfc for every element in [first, last)
+// and write the results to out, returning the end of the output range.  They are
+// constrained to iterator arguments so as not to hijack unrelated calls:
+//
+template <class ForwardIterator, class OutputIterator, class Policy>
+inline typename std::enable_if<detail::is_batch_iterator<ForwardIterator>::value, OutputIterator>::type
+   erf(ForwardIterator first, ForwardIterator last, OutputIterator out, const Policy& pol)
+{
+   return detail::erf_batch(first, last, out, false, pol, "boost::math::erf<%1%>(%1%, %1%)");
+}
+
+template <class ForwardIterator, class OutputIterator>
+inline typename std::enable_if<detail::is_batch_iterator<ForwardIterator>::value, OutputIterator>::type
+   erf(ForwardIterator first, ForwardIterator last, OutputIterator out)
+{
+   return boost::math::erf(first, last, out, policies::policy<>());
+}
+
+template <class ForwardIterator, class OutputIterator, class Policy>
+inline typename std::enable_if<detail::is_batch_iterator<ForwardIterator>::value, OutputIterator>::type
+   erfc(ForwardIterator first, ForwardIterator last, OutputIterator out, const Policy& pol)
+{
+   return detail::erf_batch(first, last, out, true, pol, "boost::math::erfc<%1%>(%1%, %1%)");
+}
+
+template <class ForwardIterator, class OutputIterator>
+inline typename std::enable_if<detail::is_batch_iterator<ForwardIterator>::value, OutputIterator>::type
+   erfc(ForwardIterator first, ForwardIterator last, OutputIterator out)
+{
+   return boost::math::erfc(first, last, out, policies::policy<>());
+}
+
 } // namespace math
 } // namespace boost
 
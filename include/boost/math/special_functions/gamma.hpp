@@ -37,6 +37,9 @@
 
 #include <cmath>
 #include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
 #include <type_traits>
 
 #ifdef _MSC_VER
@@ -858,11 +861,29 @@ T full_igamma_prefix(T a, T z, const Policy& pol)
    return prefix;
 }
 //
+// The part of regularised_gamma_prefix below which depends only on a:
+// tgamma(a) when a < 1, otherwise the left over terms of the Lanczos
+// approximation.  Callers which evaluate the prefix for many z and a
+// fixed a can compute this once and pass it to the overload below:
+//
+template <class T, class Policy, class Lanczos>
+T regularised_gamma_prefix_a_term(T a, const Policy& pol, const Lanczos& l)
+{
+   BOOST_MATH_STD_USING
+   if(a < 1)
+   {
+      // Only used when the direct calculation is taken below:
+      return a < 1 / tools::max_value<T>() ? T(0) : T(gamma_imp(a, pol, l));
+   }
+   T agh = a + static_cast<T>(Lanczos::g()) - T(0.5);
+   return sqrt(agh / boost::math::constants::e<T>()) / Lanczos::lanczos_sum_expG_scaled(a);
+}
+//
 // Compute (z^a)(e^-z)/tgamma(a)
 // most if the error occurs in this function:
 //
 template <class T, class Policy, class Lanczos>
-T regularised_gamma_prefix(T a, T z, const Policy& pol, const Lanczos& l)
+T regularised_gamma_prefix(T a, T z, const Policy& pol, const Lanczos& l, const T& a_term)
 {
    BOOST_MATH_STD_USING
    if (z >= tools::max_value<T>())
@@ -891,7 +912,7 @@ T regularised_gamma_prefix(T a, T z, const Policy& pol, const Lanczos& l)
       {
          // direct calculation, no danger of overflow as gamma(a) < 1/a
          // for small a.
-         return pow(z, a) * exp(-z) / gamma_imp(a, pol, l);
+         return pow(z, a) * exp(-z) / a_term;
       }
    }
    else if((fabs(d*d*a) <= 100) && (a > 150))
@@ -939,9 +960,16 @@ T regularised_gamma_prefix(T a, T z, const Policy& pol, const Lanczos& l)
          prefix = pow(z / agh, a) * exp(amz);
       }
    }
-   prefix *= sqrt(agh / boost::math::constants::e<T>()) / Lanczos::lanczos_sum_expG_scaled(a);
+   prefix *= a_term;
    return prefix;
 }
+template <class T, class Policy, class Lanczos>
+inline T regularised_gamma_prefix(T a, T z, const Policy& pol, const Lanczos& l)
+{
+   if (z >= tools::max_value<T>())
+      return 0;
+   return regularised_gamma_prefix(a, z, pol, l, regularised_gamma_prefix_a_term(a, pol, l));
+}
 //
 // And again, without Lanczos support:
 //
@@ -1011,6 +1039,17 @@ T regularised_gamma_prefix(T a, T z, const Policy& pol, const lanczos::undefined
       }
    }
 }
+template <class T, class Policy>
+inline T regularised_gamma_prefix_a_term(T, const Policy&, const lanczos::undefined_lanczos&)
+{
+   // Nothing to cache without a Lanczos approximation:
+   return 0;
+}
+template <class T, class Policy>
+inline T regularised_gamma_prefix(T a, T z, const Policy& pol, const lanczos::undefined_lanczos& l, const T&)
+{
+   return regularised_gamma_prefix(a, z, pol, l);
+}
 //
 // Upper gamma fraction for very small a:
 //
@@ -1771,6 +1810,32 @@ T tgamma_ratio_imp(T x, T y, const Policy& pol)
    return boost::math::tgamma_delta_ratio(x, y - x, pol);
 }
 
+//
+// The normal case of gamma_p_derivative_imp below, a > 0, x > 0, with
+// the value of regularised_gamma_prefix(a, x) already calculated by the
+// caller:
+//
+template <class T, class Policy>
+T gamma_p_derivative_imp(T a, T x, const Policy& pol, T f1)
+{
+   BOOST_MATH_STD_USING
+   if((x < 1) && (tools::max_value<T>() * x < f1))
+   {
+      // overflow:
+      return policies::raise_overflow_error<T>("boost::math::gamma_p_derivative<%1%>(%1%, %1%)", nullptr, pol);
+   }
+   if(f1 == 0)
+   {
+      // Underflow in calculation, use logs instead:
+      f1 = a * log(x) - x - lgamma(a, pol) - log(x);
+      f1 = exp(f1);
+   }
+   else
+      f1 /= x;
+
+   return f1;
+}
+
 template <class T, class Policy>
 T gamma_p_derivative_imp(T a, T x, const Policy& pol)
 {
@@ -1794,22 +1859,7 @@ T gamma_p_derivative_imp(T a, T x, const Policy& pol)
    // Normal case:
    //
    typedef typename lanczos::lanczos<T, Policy>::type lanczos_type;
-   T f1 = detail::regularised_gamma_prefix(a, x, pol, lanczos_type());
-   if((x < 1) && (tools::max_value<T>() * x < f1))
-   {
-      // overflow:
-      return policies::raise_overflow_error<T>("boost::math::gamma_p_derivative<%1%>(%1%, %1%)", nullptr, pol);
-   }
-   if(f1 == 0)
-   {
-      // Underflow in calculation, use logs instead:
-      f1 = a * log(x) - x - lgamma(a, pol) - log(x);
-      f1 = exp(f1);
-   }
-   else
-      f1 /= x;
-
-   return f1;
+   return gamma_p_derivative_imp(a, x, pol, detail::regularised_gamma_prefix(a, x, pol, lanczos_type()));
 }
 
 template <class T, class Policy>
@@ -1946,6 +1996,230 @@ inline typename tools::promote_args<T1, T2>::type
    return tgamma(a, z, policies::policy<>(), tag);
 }
 
+//
+// Batched tgamma and lgamma.
+//
+// Arguments are processed in blocks of gamma_batch_block_size, the generic
+// versions just call gamma_imp / lgamma_imp for each element of a block:
+//
+constexpr std::size_t gamma_batch_block_size = 64;
+
+template <class T, class Policy, class Lanczos>
+void gamma_batch_imp(const T* z, T* result, std::size_t n, const Policy& pol, const Lanczos& l)
+{
+   for(std::size_t i = 0; i < n; ++i)
+      result[i] = gamma_imp(z[i], pol, l);
+}
+
+template <class T, class Policy, class Lanczos>
+void lgamma_batch_imp(const T* z, T* result, std::size_t n, const Policy& pol, const Lanczos& l)
+{
+   for(std::size_t i = 0; i < n; ++i)
+      result[i] = lgamma_imp(z[i], pol, l);
+}
+//
+// Calculates tgamma(w[k]) for m non-integer arguments w[k] >= root_epsilon via the
+// Lanczos approximation, with the Lanczos sum evaluated over the whole block at
+// once.  Sets ok[k] to false when the result requires the overflow handling in
+// gamma_imp:
+//
+template <class T>
+void gamma_batch_lanczos13m53(const T* w, T* g, bool* ok, std::size_t m)
+{
+   BOOST_MATH_STD_USING
+   typedef lanczos::lanczos13m53 lanczos_type;
+
+   std::array<T, gamma_batch_block_size> x;
+   for(std::size_t k = 0; k < m; ++k)
+      x[k] = w[k];
+   for(std::size_t k = m; k < gamma_batch_block_size; ++k)
+      x[k] = 2;
+   std::array<T, gamma_batch_block_size> sum = lanczos_type::lanczos_sum(x);
+   for(std::size_t k = 0; k < m; ++k)
+   {
+      T zgh = (w[k] + static_cast<T>(lanczos_type::g()) - boost::math::constants::half<T>());
+      ok[k] = !(w[k] * log(zgh) > tools::log_max_value<T>());
+      g[k] = sum[k] * (pow(zgh, w[k] - boost::math::constants::half<T>()) / exp(zgh));
+   }
+}
+//
+// With lanczos13m53 all the arguments in a block which reach the main Lanczos
+// approximation in gamma_imp, either directly or via the reflection formula for
+// z <= -20, are gathered together and evaluated at once.  Everything else
+// (integers, tiny arguments, non-finite values and anything which may raise an
+// error) is passed to gamma_imp:
+//
+template <class T, class Policy>
+void gamma_batch_imp(const T* z, T* result, std::size_t n, const Policy& pol, const lanczos::lanczos13m53& l)
+{
+   BOOST_MATH_STD_USING
+
+   BOOST_MATH_ASSERT(n <= gamma_batch_block_size);
+
+   T w[gamma_batch_block_size];
+   T g[gamma_batch_block_size];
+   bool ok[gamma_batch_block_size];
+   std::size_t index[gamma_batch_block_size];
+   std::size_t m = 0;
+
+   for(std::size_t i = 0; i < n; ++i)
+   {
+      if((z[i] >= tools::root_epsilon<T>()) && (floor(z[i]) != z[i]))
+      {
+         w[m] = z[i];
+         index[m++] = i;
+      }
+      else if((z[i] <= -20) && (floor(z[i]) != z[i]))
+      {
+         w[m] = -z[i];
+         index[m++] = i;
+      }
+      else
+         result[i] = gamma_imp(z[i], pol, l);
+   }
+   gamma_batch_lanczos13m53(w, g, ok, m);
+   for(std::size_t k = 0; k < m; ++k)
+   {
+      std::size_t i = index[k];
+      if(ok[k] && (z[i] > 0))
+      {
+         result[i] = g[k];
+         continue;
+      }
+      if(ok[k])
+      {
+         // Reflection, we only handle results that need no error checking here:
+         T r = g[k] * sinpx(z[i]);
+         if(!((fabs(r) < 1) && (tools::max_value<T>() * fabs(r) < boost::math::constants::pi<T>())))
+         {
+            r = -boost::math::constants::pi<T>() / r;
+            if((r != 0) && ((boost::math::fpclassify)(r) != (int)FP_SUBNORMAL))
+            {
+               result[i] = r;
+               continue;
+            }
+         }
+      }
+      result[i] = gamma_imp(z[i], pol, l);
+   }
+}
+//
+// For lgamma the arguments |z| >= 15 are handled here, those below 100 are
+// non-integers and are calculated as log(tgamma(z)) as in lgamma_imp, the
+// remainder use the Lanczos approximation directly.  Negative arguments use
+// the reflection formula:
+//
+template <class T, class Policy>
+void lgamma_batch_imp(const T* z, T* result, std::size_t n, const Policy& pol, const lanczos::lanczos13m53& l)
+{
+   BOOST_MATH_STD_USING
+   typedef lanczos::lanczos13m53 lanczos_type;
+
+   BOOST_MATH_ASSERT(n <= gamma_batch_block_size);
+
+   T w1[gamma_batch_block_size];
+   T g[gamma_batch_block_size];
+   bool ok[gamma_batch_block_size];
+   std::size_t index1[gamma_batch_block_size];
+   std::size_t m1 = 0;
+   std::array<T, gamma_batch_block_size> w2;
+   std::size_t index2[gamma_batch_block_size];
+   std::size_t m2 = 0;
+
+   for(std::size_t i = 0; i < n; ++i)
+   {
+      T a = fabs(z[i]);
+      if((a >= 15) && (boost::math::isfinite)(a) && ((z[i] > 0) || (floor(z[i]) != z[i])))
+      {
+         if((a < 100) && (std::numeric_limits<T>::max_exponent >= 1024))
+         {
+            if(floor(a) != a)
+            {
+               w1[m1] = a;
+               index1[m1++] = i;
+               continue;
+            }
+         }
+         else
+         {
+            w2[m2] = a;
+            index2[m2++] = i;
+            continue;
+         }
+      }
+      result[i] = lgamma_imp(z[i], pol, l);
+   }
+
+   gamma_batch_lanczos13m53(w1, g, ok, m1);
+   for(std::size_t k = 0; k < m1; ++k)
+      result[index1[k]] = log(g[k]);
+
+   for(std::size_t k = m2; k < gamma_batch_block_size; ++k)
+      w2[k] = 100;
+   std::array<T, gamma_batch_block_size> sum = lanczos_type::lanczos_sum_expG_scaled(w2);
+   for(std::size_t k = 0; k < m2; ++k)
+   {
+      T zgh = static_cast<T>(w2[k] + lanczos_type::g() - boost::math::constants::half<T>());
+      T r = log(zgh) - 1;
+      r *= w2[k] - 0.5f;
+      if(r * tools::epsilon<T>() < 20)
+         r += log(sum[k]);
+      result[index2[k]] = r;
+   }
+   //
+   // Apply the reflection formula to the negative arguments, as in lgamma_imp:
+   //
+   for(std::size_t k = 0; k < m1; ++k)
+   {
+      std::size_t i = index1[k];
+      if(z[i] < 0)
+         result[i] = log(boost::math::constants::pi<T>()) - result[i] - log(fabs(sinpx(z[i])));
+   }
+   for(std::size_t k = 0; k < m2; ++k)
+   {
+      std::size_t i = index2[k];
+      if(z[i] < 0)
+         result[i] = log(boost::math::constants::pi<T>()) - result[i] - log(fabs(sinpx(z[i])));
+   }
+}
+
+template <class ForwardIterator, class OutputIterator, class Policy>
+OutputIterator gamma_batch(ForwardIterator first, ForwardIterator last, OutputIterator out, bool logarithm, const Policy&)
+{
+   BOOST_FPU_EXCEPTION_GUARD
+   typedef typename std::iterator_traits<ForwardIterator>::value_type argument_type;
+   typedef typename tools::promote_args<argument_type>::type result_type;
+   typedef typename policies::evaluation<result_type, Policy>::type value_type;
+   typedef typename lanczos::lanczos<value_type, Policy>::type evaluation_type;
+   typedef typename policies::normalise<
+      Policy,
+      policies::promote_float<false>,
+      policies::promote_double<false>,
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+
+   if(logarithm)
+      lgamma_initializer<value_type, forwarding_policy>::force_instantiate();
+
+   value_type z[gamma_batch_block_size];
+   value_type result[gamma_batch_block_size];
+   const char* function = logarithm ? "boost::math::lgamma<%1%>(%1%)" : "boost::math::tgamma<%1%>(%1%)";
+
+   while(first != last)
+   {
+      std::size_t n = 0;
+      for(; (n < gamma_batch_block_size) && (first != last); ++n, ++first)
+         z[n] = static_cast<value_type>(*first);
+      if(logarithm)
+         lgamma_batch_imp(z, result, n, forwarding_policy(), evaluation_type());
+      else
+         gamma_batch_imp(z, result, n, forwarding_policy(), evaluation_type());
+      for(std::size_t i = 0; i < n; ++i, ++out)
+         *out = policies::checked_narrowing_cast<result_type, forwarding_policy>(result[i], function);
+   }
+   return out;
+}
+
 
 } // namespace detail
 
@@ -1997,6 +2271,39 @@ inline typename tools::promote_args<T>::type
    return ::boost::math::lgamma(x, nullptr, policies::policy<>());
 }
 
+//
+// Batched versions, these evaluate tgamma or lgamma for every element in
+// [first, last) and write the results to out, returning the end of the output range.
+// They are constrained to iterator arguments so as not to hijack tgamma(a, z, pol):
+//
+template <class ForwardIterator, class OutputIterator, class Policy>
+inline typename std::enable_if<detail::is_batch_iterator<ForwardIterator>::value, OutputIterator>::type
+   tgamma(ForwardIterator first, ForwardIterator last, OutputIterator out, const Policy& pol)
+{
+   return detail::gamma_batch(first, last, out, false, pol);
+}
+
+template <class ForwardIterator, class OutputIterator>
+inline typename std::enable_if<detail::is_batch_iterator<ForwardIterator>::value, OutputIterator>::type
+   tgamma(ForwardIterator first, ForwardIterator last, OutputIterator out)
+{
+   return detail::gamma_batch(first, last, out, false, policies::policy<>());
+}
+
+template <class ForwardIterator, class OutputIterator, class Policy>
+inline typename std::enable_if<detail::is_batch_iterator<ForwardIterator>::value, OutputIterator>::type
+   lgamma(ForwardIterator first, ForwardIterator last, OutputIterator out, const Policy& pol)
+{
+   return detail::gamma_batch(first, last, out, true, pol);
+}
+
+template <class ForwardIterator, class OutputIterator>
+inline typename std::enable_if<detail::is_batch_iterator<ForwardIterator>::value, OutputIterator>::type
+   lgamma(ForwardIterator first, ForwardIterator last, OutputIterator out)
+{
+   return detail::gamma_batch(first, last, out, true, policies::policy<>());
+}
+
 template <class T, class Policy>
 inline typename tools::promote_args<T>::type
    tgamma1pm1(T z, const Policy& /* pol */)
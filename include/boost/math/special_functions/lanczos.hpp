@@ -17,6 +17,8 @@
 #include <limits>
 #include <type_traits>
 #include <cstdint>
+#include <cstddef>
+#include <array>
 
 #if defined(__GNUC__) && defined(BOOST_MATH_USE_FLOAT128)
 //
@@ -562,6 +564,32 @@ struct lanczos13m53 : public std::integral_constant<int, 53>
    //
    template <class T>
    static T lanczos_sum(const T& z)
+   {
+      return lanczos_sum_imp<T>(z);
+   }
+   //
+   // Lanczos sum at M points at once, see tools::evaluate_rational:
+   //
+   template <class T, std::size_t M>
+   static std::array<T, M> lanczos_sum(const std::array<T, M>& z)
+   {
+      return lanczos_sum_imp<T>(z);
+   }
+
+   template <class T>
+   static T lanczos_sum_expG_scaled(const T& z)
+   {
+      return lanczos_sum_expG_scaled_imp<T>(z);
+   }
+
+   template <class T, std::size_t M>
+   static std::array<T, M> lanczos_sum_expG_scaled(const std::array<T, M>& z)
+   {
+      return lanczos_sum_expG_scaled_imp<T>(z);
+   }
+
+   template <class T, class V>
+   static V lanczos_sum_imp(const V& z)
    {
       static const T num[13] = {
          static_cast<T>(23531376880.41075968857200767445163675473L),
@@ -596,8 +624,8 @@ struct lanczos13m53 : public std::integral_constant<int, 53>
       return boost::math::tools::evaluate_rational(num, denom, z);
    }
 
-   template <class T>
-   static T lanczos_sum_expG_scaled(const T& z)
+   template <class T, class V>
+   static V lanczos_sum_expG_scaled_imp(const V& z)
    {
       static const T num[13] = {
          static_cast<T>(56906521.91347156388090791033559122686859L),
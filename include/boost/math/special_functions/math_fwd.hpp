@@ -26,8 +26,10 @@
 #include <vector>
 #include <complex>
 #include <type_traits>
+#include <iterator>
 #include <boost/math/special_functions/detail/round_fwd.hpp>
 #include <boost/math/tools/promotion.hpp> // for argument promotion.
+#include <boost/math/tools/is_detected.hpp>
 #include <boost/math/policies/policy.hpp>
 
 #define BOOST_NO_MACRO_EXPAND /**/
@@ -152,6 +154,17 @@ namespace boost
    template <class T>
    T binomial_coefficient(unsigned n, unsigned k);
 
+   namespace detail{
+
+   // Used to constrain the batched overloads to iterator arguments:
+   template <class T>
+   using batch_iterator_category_t = typename std::iterator_traits<T>::iterator_category;
+
+   template <class T>
+   using is_batch_iterator = tools::is_detected<batch_iterator_category_t, T>;
+
+   } // namespace detail
+
    // erf & erfc error functions.
    template <class RT> // Error function.
    typename tools::promote_args<RT>::type erf(RT z);
@@ -163,6 +176,20 @@ namespace boost
    template <class RT, class Policy>// Error function complement.
    typename tools::promote_args<RT>::type erfc(RT z, const Policy&);
 
+   template <class ForwardIterator, class OutputIterator> // Error function over a range.
+   typename std::enable_if<detail::is_batch_iterator<ForwardIterator>::value, OutputIterator>::type
+      erf(ForwardIterator first, ForwardIterator last, OutputIterator out);
+   template <class ForwardIterator, class OutputIterator, class Policy> // Error function over a range.
+   typename std::enable_if<detail::is_batch_iterator<ForwardIterator>::value, OutputIterator>::type
+      erf(ForwardIterator first, ForwardIterator last, OutputIterator out, const Policy&);
+
+   template <class ForwardIterator, class OutputIterator> // Error function complement over a range.
+   typename std::enable_if<detail::is_batch_iterator<ForwardIterator>::value, OutputIterator>::type
+      erfc(ForwardIterator first, ForwardIterator last, OutputIterator out);
+   template <class ForwardIterator, class OutputIterator, class Policy> // Error function complement over a range.
+   typename std::enable_if<detail::is_batch_iterator<ForwardIterator>::value, OutputIterator>::type
+      erfc(ForwardIterator first, ForwardIterator last, OutputIterator out, const Policy&);
+
    template <class RT>// Error function inverse.
    typename tools::promote_args<RT>::type erf_inv(RT z);
    template <class RT, class Policy>// Error function inverse.
@@ -468,6 +495,22 @@ namespace boost
    template <class RT, class Policy>
    typename tools::promote_args<RT>::type lgamma(RT x, const Policy& pol);
 
+   template <class ForwardIterator, class OutputIterator>
+   typename std::enable_if<detail::is_batch_iterator<ForwardIterator>::value, OutputIterator>::type
+      tgamma(ForwardIterator first, ForwardIterator last, OutputIterator out);
+
+   template <class ForwardIterator, class OutputIterator, class Policy>
+   typename std::enable_if<detail::is_batch_iterator<ForwardIterator>::value, OutputIterator>::type
+      tgamma(ForwardIterator first, ForwardIterator last, OutputIterator out, const Policy& pol);
+
+   template <class ForwardIterator, class OutputIterator>
+   typename std::enable_if<detail::is_batch_iterator<ForwardIterator>::value, OutputIterator>::type
+      lgamma(ForwardIterator first, ForwardIterator last, OutputIterator out);
+
+   template <class ForwardIterator, class OutputIterator, class Policy>
+   typename std::enable_if<detail::is_batch_iterator<ForwardIterator>::value, OutputIterator>::type
+      lgamma(ForwardIterator first, ForwardIterator last, OutputIterator out, const Policy& pol);
+
    template <class RT1, class RT2>
    typename tools::promote_args<RT1, RT2>::type tgamma_lower(RT1 a, RT2 z);
 
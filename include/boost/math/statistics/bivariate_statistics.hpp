@@ -20,8 +20,7 @@
 
 #ifdef BOOST_MATH_EXEC_COMPATIBLE
 #include <execution>
-#include <future>
-#include <thread>
+#include <boost/math/statistics/detail/executor.hpp>
 #endif
 
 namespace boost{ namespace math{ namespace statistics { namespace detail {
@@ -61,8 +60,8 @@ ReturnType means_and_covariance_seq_impl(ForwardIterator u_begin, ForwardIterato
 
 // Numerically stable parallel computation of (co-)variance
 // https://dl.acm.org/doi/10.1145/3221269.3223036
-template<typename ReturnType, typename ForwardIterator>
-ReturnType means_and_covariance_parallel_impl(ForwardIterator u_begin, ForwardIterator u_end, ForwardIterator v_begin, ForwardIterator v_end)
+template<typename ReturnType, typename Executor, typename ForwardIterator>
+ReturnType means_and_covariance_parallel_impl(Executor&& ex, ForwardIterator u_begin, ForwardIterator u_end, ForwardIterator v_begin, ForwardIterator v_end)
 {
     using Real = typename std::tuple_element<0, ReturnType>::type;
 
@@ -74,65 +73,36 @@ ReturnType means_and_covariance_parallel_impl(ForwardIterator u_begin, ForwardIt
         throw std::domain_error("The size of each sample set must be the same to compute covariance");
     }
 
-    const unsigned max_concurrency = std::thread::hardware_concurrency() == 0 ? 2u : std::thread::hardware_concurrency();
-    unsigned num_threads = 2u;
-    
     // 5.16 comes from benchmarking. See boost/math/reporting/performance/bivariate_statistics_performance.cpp
-    // Threading is faster for: 10 + 5.16e-3 N/j <= 5.16e-3N => N >= 10^4j/5.16(j-1).
-    const auto parallel_lower_bound = 10e4*max_concurrency/(5.16*(max_concurrency-1));
-    const auto parallel_upper_bound = 10e4*2/5.16; // j = 2
-
-    // https://lemire.me/blog/2020/01/30/cost-of-a-thread-in-c-under-linux/
-    if(u_elements < parallel_lower_bound)
+    const unsigned num_threads = parallel_chunk_count(u_elements, ex.concurrency(), 5.16, task_launch_cost(ex));
+    if(num_threads < 2)
     {
         return means_and_covariance_seq_impl<ReturnType>(u_begin, u_end, v_begin, v_end);
     }
-    else if(u_elements >= parallel_upper_bound)
-    {
-        num_threads = max_concurrency;
-    }
-    else
-    {
-        for(unsigned i = 3; i < max_concurrency; ++i)
-        {
-            if(parallel_lower_bound < 10e4*i/(5.16*(i-1)))
-            {
-                num_threads = i;
-                break;
-            }
-        }
-    }
-
-    std::vector<std::future<ReturnType>> future_manager;
-    const auto elements_per_thread = std::ceil(static_cast<double>(u_elements)/num_threads);
 
-    ForwardIterator u_it = u_begin;
-    ForwardIterator v_it = v_begin;
-
-    for(std::size_t i = 0; i < num_threads - 1; ++i)
+    // The v chunks have the same sizes as the u chunks:
+    const auto u_bounds = chunk_bounds(u_begin, u_end, num_threads);
+    std::vector<ForwardIterator> v_bounds {v_begin};
+    for(std::size_t i = 1; i < u_bounds.size(); ++i)
     {
-        future_manager.emplace_back(std::async(std::launch::async | std::launch::deferred, [u_it, v_it, elements_per_thread]() -> ReturnType
-        {
-            return means_and_covariance_seq_impl<ReturnType>(u_it, std::next(u_it, elements_per_thread), v_it, std::next(v_it, elements_per_thread));
-        }));
-        u_it = std::next(u_it, elements_per_thread);
-        v_it = std::next(v_it, elements_per_thread);
+        v_bounds.push_back(std::next(v_bounds.back(), std::distance(u_bounds[i - 1], u_bounds[i])));
     }
 
-    future_manager.emplace_back(std::async(std::launch::async | std::launch::deferred, [u_it, u_end, v_it, v_end]() -> ReturnType
+    std::vector<ReturnType> results(num_threads);
+    ex.bulk_execute(num_threads, [&u_bounds, &v_bounds, &results](std::size_t i)
     {
-        return means_and_covariance_seq_impl<ReturnType>(u_it, u_end, v_it, v_end);
-    }));
+        results[i] = means_and_covariance_seq_impl<ReturnType>(u_bounds[i], u_bounds[i + 1], v_bounds[i], v_bounds[i + 1]);
+    });
 
-    ReturnType temp = future_manager[0].get();
+    ReturnType temp = results[0];
     Real mu_u_a = std::get<0>(temp);
     Real mu_v_a = std::get<1>(temp);
     Real cov_a = std::get<2>(temp);
     Real n_a = std::get<3>(temp);
 
-    for(std::size_t i = 1; i < future_manager.size(); ++i)
+    for(std::size_t i = 1; i < results.size(); ++i)
     {
-        temp = future_manager[i].get();
+        temp = results[i];
         Real mu_u_b = std::get<0>(temp);
         Real mu_v_b = std::get<1>(temp);
         Real cov_b = std::get<2>(temp);
@@ -142,7 +112,8 @@ ReturnType means_and_covariance_parallel_impl(ForwardIterator u_begin, ForwardIt
         const Real delta_u = mu_u_b - mu_u_a;
         const Real delta_v = mu_v_b - mu_v_a;
 
-        cov_a = cov_a + cov_b + (-delta_u)*(-delta_v)*((n_a*n_b)/n_ab);
+        // Each chunk's covariance is normalized by its size, so the co-moments are merged:
+        cov_a = (n_a*cov_a + n_b*cov_b + delta_u*delta_v*((n_a*n_b)/n_ab))/n_ab;
         mu_u_a = mu_u_a + delta_u*(n_b/n_ab);
         mu_v_a = mu_v_a + delta_v*(n_b/n_ab);
         n_a = n_ab;
@@ -208,8 +179,8 @@ ReturnType correlation_coefficient_seq_impl(ForwardIterator u_begin, ForwardIter
 //
 // Parallel computation of variance:
 // http://i.stanford.edu/pub/cstr/reports/cs/tr/79/773/CS-TR-79-773.pdf
-template<typename ReturnType, typename ForwardIterator>
-ReturnType correlation_coefficient_parallel_impl(ForwardIterator u_begin, ForwardIterator u_end, ForwardIterator v_begin, ForwardIterator v_end)
+template<typename ReturnType, typename Executor, typename ForwardIterator>
+ReturnType correlation_coefficient_parallel_impl(Executor&& ex, ForwardIterator u_begin, ForwardIterator u_end, ForwardIterator v_begin, ForwardIterator v_end)
 {
     using Real = typename std::tuple_element<0, ReturnType>::type;
 
@@ -221,57 +192,28 @@ ReturnType correlation_coefficient_parallel_impl(ForwardIterator u_begin, Forwar
         throw std::domain_error("The size of each sample set must be the same to compute covariance");
     }
 
-    const unsigned max_concurrency = std::thread::hardware_concurrency() == 0 ? 2u : std::thread::hardware_concurrency();
-    unsigned num_threads = 2u;
-    
     // 3.25 comes from benchmarking. See boost/math/reporting/performance/bivariate_statistics_performance.cpp
-    // Threading is faster for: 10 + 3.25e-3 N/j <= 3.25e-3N => N >= 10^4j/3.25(j-1).
-    const auto parallel_lower_bound = 10e4*max_concurrency/(3.25*(max_concurrency-1));
-    const auto parallel_upper_bound = 10e4*2/3.25; // j = 2
-
-    // https://lemire.me/blog/2020/01/30/cost-of-a-thread-in-c-under-linux/
-    if(u_elements < parallel_lower_bound)
+    const unsigned num_threads = parallel_chunk_count(u_elements, ex.concurrency(), 3.25, task_launch_cost(ex));
+    if(num_threads < 2)
     {
         return correlation_coefficient_seq_impl<ReturnType>(u_begin, u_end, v_begin, v_end);
     }
-    else if(u_elements >= parallel_upper_bound)
-    {
-        num_threads = max_concurrency;
-    }
-    else
-    {
-        for(unsigned i = 3; i < max_concurrency; ++i)
-        {
-            if(parallel_lower_bound < 10e4*i/(3.25*(i-1)))
-            {
-                num_threads = i;
-                break;
-            }
-        }
-    }
 
-    std::vector<std::future<ReturnType>> future_manager;
-    const auto elements_per_thread = std::ceil(static_cast<double>(u_elements)/num_threads);
-
-    ForwardIterator u_it = u_begin;
-    ForwardIterator v_it = v_begin;
-
-    for(std::size_t i = 0; i < num_threads - 1; ++i)
+    // The v chunks have the same sizes as the u chunks:
+    const auto u_bounds = chunk_bounds(u_begin, u_end, num_threads);
+    std::vector<ForwardIterator> v_bounds {v_begin};
+    for(std::size_t i = 1; i < u_bounds.size(); ++i)
     {
-        future_manager.emplace_back(std::async(std::launch::async | std::launch::deferred, [u_it, v_it, elements_per_thread]() -> ReturnType
-        {
-            return correlation_coefficient_seq_impl<ReturnType>(u_it, std::next(u_it, elements_per_thread), v_it, std::next(v_it, elements_per_thread));
-        }));
-        u_it = std::next(u_it, elements_per_thread);
-        v_it = std::next(v_it, elements_per_thread);
+        v_bounds.push_back(std::next(v_bounds.back(), std::distance(u_bounds[i - 1], u_bounds[i])));
     }
 
-    future_manager.emplace_back(std::async(std::launch::async | std::launch::deferred, [u_it, u_end, v_it, v_end]() -> ReturnType
+    std::vector<ReturnType> results(num_threads);
+    ex.bulk_execute(num_threads, [&u_bounds, &v_bounds, &results](std::size_t i)
     {
-        return correlation_coefficient_seq_impl<ReturnType>(u_it, u_end, v_it, v_end);
-    }));
+        results[i] = correlation_coefficient_seq_impl<ReturnType>(u_bounds[i], u_bounds[i + 1], v_bounds[i], v_bounds[i + 1]);
+    });
 
-    ReturnType temp = future_manager[0].get();
+    ReturnType temp = results[0];
     Real mu_u_a = std::get<0>(temp);
     Real Qu_a = std::get<1>(temp);
     Real mu_v_a = std::get<2>(temp);
@@ -279,9 +221,9 @@ ReturnType correlation_coefficient_parallel_impl(ForwardIterator u_begin, Forwar
     Real cov_a = std::get<4>(temp);
     Real n_a = std::get<6>(temp);
 
-    for(std::size_t i = 1; i < future_manager.size(); ++i)
+    for(std::size_t i = 1; i < results.size(); ++i)
     {
-        temp = future_manager[i].get();
+        temp = results[i];
         Real mu_u_b = std::get<0>(temp);
         Real Qu_b = std::get<1>(temp);
         Real mu_v_b = std::get<2>(temp);
@@ -297,7 +239,7 @@ ReturnType correlation_coefficient_parallel_impl(ForwardIterator u_begin, Forwar
         mu_u_a = mu_u_a + delta_u*(n_b/n_ab);
         mu_v_a = mu_v_a + delta_v*(n_b/n_ab);
         Qu_a = Qu_a + Qu_b + delta_u*delta_u*((n_a*n_b)/n_ab);
-        Qv_b = Qv_a + Qv_b + delta_v*delta_v*((n_a*n_b)/n_ab);
+        Qv_a = Qv_a + Qv_b + delta_v*delta_v*((n_a*n_b)/n_ab);
         n_a = n_ab;
     }
 
@@ -350,13 +292,13 @@ inline auto means_and_covariance(ExecutionPolicy&& exec, Container const & u, Co
         if constexpr (std::is_integral_v<Real>)
         {
             using ReturnType = std::tuple<double, double, double, double>;
-            ReturnType temp = detail::means_and_covariance_parallel_impl<ReturnType>(std::begin(u), std::end(u), std::begin(v), std::end(v));
+            ReturnType temp = detail::means_and_covariance_parallel_impl<ReturnType>(detail::executor_for(exec), std::begin(u), std::end(u), std::begin(v), std::end(v));
             return std::make_tuple(std::get<0>(temp), std::get<1>(temp), std::get<2>(temp));
         }
         else
         {
             using ReturnType = std::tuple<Real, Real, Real, Real>;
-            ReturnType temp = detail::means_and_covariance_parallel_impl<ReturnType>(std::begin(u), std::end(u), std::begin(v), std::end(v));
+            ReturnType temp = detail::means_and_covariance_parallel_impl<ReturnType>(detail::executor_for(exec), std::begin(u), std::end(u), std::begin(v), std::end(v));
             return std::make_tuple(std::get<0>(temp), std::get<1>(temp), std::get<2>(temp));
         }
     }
@@ -401,12 +343,12 @@ inline auto correlation_coefficient(ExecutionPolicy&& exec, Container const & u,
         if constexpr (std::is_integral_v<Real>)
         {
             using ReturnType = std::tuple<double, double, double, double, double, double, double>;
-            return std::get<5>(detail::correlation_coefficient_parallel_impl<ReturnType>(std::begin(u), std::end(u), std::begin(v), std::end(v)));
+            return std::get<5>(detail::correlation_coefficient_parallel_impl<ReturnType>(detail::executor_for(exec), std::begin(u), std::end(u), std::begin(v), std::end(v)));
         }
         else
         {
             using ReturnType = std::tuple<Real, Real, Real, Real, Real, Real, Real>;
-            return std::get<5>(detail::correlation_coefficient_parallel_impl<ReturnType>(std::begin(u), std::end(u), std::begin(v), std::end(v)));
+            return std::get<5>(detail::correlation_coefficient_parallel_impl<ReturnType>(detail::executor_for(exec), std::begin(u), std::end(u), std::begin(v), std::end(v)));
         }
     }
 }
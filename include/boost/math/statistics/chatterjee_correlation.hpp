@@ -20,8 +20,7 @@
 
 #ifdef BOOST_MATH_EXEC_COMPATIBLE
 #include <execution>
-#include <future>
-#include <thread>
+#include <boost/math/statistics/detail/executor.hpp>
 #endif
 
 namespace boost { namespace math { namespace statistics {
@@ -92,34 +91,25 @@ ReturnType chatterjee_correlation_par_impl(ExecutionPolicy&& exec, ForwardIterat
                                                                    ForwardIterator v_begin, ForwardIterator v_end)
 {
     using std::abs;
-    BOOST_MATH_ASSERT_MSG(std::is_sorted(std::forward<ExecutionPolicy>(exec), u_begin, u_end), "The x values must be sorted in order to use this functionality");
+    BOOST_MATH_ASSERT_MSG(detail::parallel_is_sorted(exec, u_begin, u_end), "The x values must be sorted in order to use this functionality");
 
-    auto rank_vector = rank(std::forward<ExecutionPolicy>(exec), v_begin, v_end);
+    auto rank_vector = rank(exec, v_begin, v_end);
 
-    const auto num_threads = std::thread::hardware_concurrency() == 0 ? 2u : std::thread::hardware_concurrency();
-    std::vector<std::future<std::size_t>> future_manager {};
-    const auto elements_per_thread = std::ceil(static_cast<double>(rank_vector.size()) / num_threads);
+    auto&& ex = detail::executor_for(exec);
+    const std::size_t num_threads = (std::max)(std::size_t(1), (std::min)(static_cast<std::size_t>(ex.concurrency()), rank_vector.size()));
+    const auto bounds = chunk_bounds(rank_vector.cbegin(), rank_vector.cend(), num_threads);
 
-    auto it = rank_vector.begin();
-    auto end = rank_vector.end();
-    for(std::size_t i {}; i < num_threads - 1; ++i)
+    // Each chunk also takes the first element of the next, so that every difference is counted exactly once:
+    std::vector<std::size_t> sums(num_threads);
+    ex.bulk_execute(num_threads, [&bounds, &sums, &rank_vector](std::size_t i)
     {
-        future_manager.emplace_back(std::async(std::launch::async | std::launch::deferred, [it, elements_per_thread]() -> std::size_t
-        {
-            return chatterjee_transform(it, std::next(it, elements_per_thread));
-        }));
-        it = std::next(it, elements_per_thread - 1);
-    }
-
-    future_manager.emplace_back(std::async(std::launch::async | std::launch::deferred, [it, end]() -> std::size_t
-    {
-        return chatterjee_transform(it, end);
-    }));
+        sums[i] = chatterjee_transform(bounds[i], bounds[i + 1] == rank_vector.cend() ? rank_vector.cend() : std::next(bounds[i + 1]));
+    });
 
     std::size_t sum {};
-    for(std::size_t i {}; i < future_manager.size(); ++i)
+    for(std::size_t i {}; i < sums.size(); ++i)
     {
-        sum += future_manager[i].get();
+        sum += sums[i];
     }
     
     ReturnType result = static_cast<ReturnType>(1) - (static_cast<ReturnType>(3 * sum) / static_cast<ReturnType>(rank_vector.size() * rank_vector.size() - 1));
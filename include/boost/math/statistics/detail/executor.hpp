@@ -0,0 +1,417 @@
+//  Copyright Boost.Math contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_STATISTICS_DETAIL_EXECUTOR_HPP
+#define BOOST_MATH_STATISTICS_DETAIL_EXECUTOR_HPP
+
+#include <boost/math/tools/config.hpp>
+
+#ifdef BOOST_HAS_THREADS
+
+#include <boost/math/tools/is_detected.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <iterator>
+#include <numeric>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifdef BOOST_MATH_EXEC_COMPATIBLE
+#include <execution>
+#endif
+
+namespace boost { namespace math { namespace tools {
+
+class thread_pool;
+
+}}} // namespace boost::math::tools
+
+namespace boost { namespace math { namespace statistics { namespace detail {
+
+// The parallel algorithms split their input into chunks and hand them to an
+// executor, which is any object providing:
+//
+// unsigned concurrency() const;                     the number of chunks worth making
+// void bulk_execute(std::size_t n, F&& f);          calls f(i) for i in [0, n), and returns when all have completed
+//
+// Users may pass an executor such as boost::math::tools::thread_pool in place
+// of an execution policy; otherwise a new std::async task is launched for
+// each chunk.
+struct async_executor
+{
+    unsigned concurrency() const
+    {
+        return std::thread::hardware_concurrency() == 0 ? 2u : std::thread::hardware_concurrency();
+    }
+
+    template <typename F>
+    void bulk_execute(std::size_t n, F&& f) const
+    {
+        std::vector<std::future<void>> future_manager;
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            future_manager.emplace_back(std::async(std::launch::async | std::launch::deferred, [&f, i]() { f(i); }));
+        }
+        for(auto& future : future_manager)
+        {
+            future.get();
+        }
+    }
+};
+
+template <typename T>
+using bulk_execute_t = decltype(std::declval<T&>().bulk_execute(std::size_t(0), std::declval<void(*)(std::size_t)>()));
+
+template <typename T>
+using concurrency_t = decltype(std::declval<const T&>().concurrency());
+
+// A const executor is detected only if its bulk_execute is const:
+template <typename T>
+struct is_executor
+{
+    using type = typename std::remove_reference<T>::type;
+    static constexpr bool value = boost::math::tools::is_detected<bulk_execute_t, type>::value &&
+                                  boost::math::tools::is_detected<concurrency_t, type>::value;
+};
+
+template <typename ExecutionPolicy, typename std::enable_if<is_executor<ExecutionPolicy>::value, bool>::type = true>
+inline ExecutionPolicy& executor_for(ExecutionPolicy& exec)
+{
+    return exec;
+}
+
+template <typename ExecutionPolicy, typename std::enable_if<!is_executor<ExecutionPolicy>::value, bool>::type = true>
+inline async_executor executor_for(ExecutionPolicy&)
+{
+    return async_executor();
+}
+
+// Relative cost of starting a task, compared to launching a new thread:
+template <typename Executor>
+inline double task_launch_cost(const Executor&)
+{
+    return 1;
+}
+
+inline double task_launch_cost(const boost::math::tools::thread_pool&)
+{
+    return 0.1;
+}
+
+// The number of chunks to split elements into, given the time taken to
+// process each element in nanoseconds.  Threading is faster for:
+// 10 + c e-3 N/j <= c e-3 N => N >= 10^4 j/c(j-1),
+// with the 10us cost of launching a thread scaled by task_launch_cost.
+// See https://lemire.me/blog/2020/01/30/cost-of-a-thread-in-c-under-linux/
+inline unsigned parallel_chunk_count(std::size_t elements, unsigned max_concurrency, double ns_per_element, double launch_cost)
+{
+    const double launch = 10e4 * launch_cost;
+    const auto parallel_lower_bound = launch*max_concurrency/(ns_per_element*(max_concurrency-1));
+    const auto parallel_upper_bound = launch*2/ns_per_element; // j = 2
+
+    if(max_concurrency < 2 || elements < parallel_lower_bound)
+    {
+        return 1;
+    }
+    else if(elements >= parallel_upper_bound)
+    {
+        return max_concurrency;
+    }
+    for(unsigned i = 3; i < max_concurrency; ++i)
+    {
+        if(parallel_lower_bound < launch*i/(ns_per_element*(i-1)))
+        {
+            return i;
+        }
+    }
+    return 2;
+}
+
+// Splits [first, last) into chunks whose sizes differ by at most one, returning chunks + 1 bounds:
+template <typename ForwardIterator>
+std::vector<ForwardIterator> chunk_bounds(ForwardIterator first, ForwardIterator last, std::size_t chunks)
+{
+    const auto elements = static_cast<std::size_t>(std::distance(first, last));
+    std::vector<ForwardIterator> bounds {first};
+    for(std::size_t i = 1; i < chunks; ++i)
+    {
+        bounds.push_back(std::next(bounds.back(), elements*i/chunks - elements*(i-1)/chunks));
+    }
+    bounds.push_back(last);
+    return bounds;
+}
+
+//
+// The standard algorithms used by the statistics, run on the tasks of an executor rather
+// than on whatever scheduler the standard library uses for std::execution::par.  Below the
+// size at which the tasks pay for themselves they run sequentially on the calling thread.
+//
+template <typename Executor, typename ForwardIterator, typename T, typename std::enable_if<is_executor<Executor>::value, bool>::type = true>
+T parallel_reduce(Executor& ex, ForwardIterator first, ForwardIterator last, T init)
+{
+    const auto elements = static_cast<std::size_t>(std::distance(first, last));
+    const unsigned chunks = parallel_chunk_count(elements, ex.concurrency(), 1, task_launch_cost(ex));
+    if(chunks < 2)
+    {
+        return std::accumulate(first, last, init);
+    }
+    const auto bounds = chunk_bounds(first, last, chunks);
+    std::vector<T> sums(chunks, T(0));
+    ex.bulk_execute(chunks, [&bounds, &sums](std::size_t i)
+    {
+        sums[i] = std::accumulate(bounds[i], bounds[i + 1], T(0));
+    });
+    for(const T& sum : sums)
+    {
+        init = init + sum;
+    }
+    return init;
+}
+
+template <typename Executor, typename ForwardIterator, typename Compare, typename std::enable_if<is_executor<Executor>::value, bool>::type = true>
+bool parallel_is_sorted(Executor& ex, ForwardIterator first, ForwardIterator last, Compare comp)
+{
+    const auto elements = static_cast<std::size_t>(std::distance(first, last));
+    const unsigned chunks = parallel_chunk_count(elements, ex.concurrency(), 1, task_launch_cost(ex));
+    if(chunks < 2)
+    {
+        return std::is_sorted(first, last, comp);
+    }
+    // Each chunk also compares its last element with the first of the next:
+    const auto bounds = chunk_bounds(first, last, chunks);
+    std::vector<char> sorted(chunks);
+    ex.bulk_execute(chunks, [&bounds, &sorted, last, comp](std::size_t i)
+    {
+        auto end = bounds[i + 1];
+        if(end != last)
+        {
+            ++end;
+        }
+        sorted[i] = std::is_sorted(bounds[i], end, comp);
+    });
+    return std::all_of(sorted.begin(), sorted.end(), [](char c) { return c != 0; });
+}
+
+template <typename Executor, typename ForwardIterator, typename std::enable_if<is_executor<Executor>::value, bool>::type = true>
+bool parallel_is_sorted(Executor& ex, ForwardIterator first, ForwardIterator last)
+{
+    return parallel_is_sorted(ex, first, last, std::less<typename std::iterator_traits<ForwardIterator>::value_type>());
+}
+
+// Sorts the chunks concurrently, then merges pairs of neighbouring runs, concurrently, until one is left:
+template <typename Executor, typename RandomAccessIterator, typename Compare, typename std::enable_if<is_executor<Executor>::value, bool>::type = true>
+void parallel_sort(Executor& ex, RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+{
+    const auto elements = static_cast<std::size_t>(last - first);
+    const double ns_per_element = 3*std::log2(static_cast<double>(elements) + 2);
+    const unsigned chunks = parallel_chunk_count(elements, ex.concurrency(), ns_per_element, task_launch_cost(ex));
+    if(chunks < 2)
+    {
+        std::sort(first, last, comp);
+        return;
+    }
+    const auto bounds = chunk_bounds(first, last, chunks);
+    ex.bulk_execute(chunks, [&bounds, comp](std::size_t i)
+    {
+        std::sort(bounds[i], bounds[i + 1], comp);
+    });
+    for(std::size_t width = 1; width < chunks; width *= 2)
+    {
+        const std::size_t merges = (chunks + 2*width - 1)/(2*width);
+        ex.bulk_execute(merges, [&bounds, comp, width, chunks](std::size_t i)
+        {
+            const std::size_t lower = 2*width*i;
+            const std::size_t middle = (std::min)(lower + width, static_cast<std::size_t>(chunks));
+            const std::size_t upper = (std::min)(lower + 2*width, static_cast<std::size_t>(chunks));
+            if(middle < upper)
+            {
+                std::inplace_merge(bounds[lower], bounds[middle], bounds[upper], comp);
+            }
+        });
+    }
+}
+
+template <typename Executor, typename RandomAccessIterator, typename std::enable_if<is_executor<Executor>::value, bool>::type = true>
+void parallel_sort(Executor& ex, RandomAccessIterator first, RandomAccessIterator last)
+{
+    parallel_sort(ex, first, last, std::less<typename std::iterator_traits<RandomAccessIterator>::value_type>());
+}
+
+//
+// Each round takes two pivots from a sorted regular sample, either side of the rank of nth,
+// and the chunks concurrently count, then scatter through a buffer, the elements below,
+// between and above the pivots.  The range is narrowed to the group which contains nth,
+// which is usually the middle one and a small fraction of the range, and once it is too small
+// for the tasks to pay for themselves, or a round makes no progress, std::nth_element finishes.
+//
+template <typename Executor, typename RandomAccessIterator, typename Compare, typename std::enable_if<is_executor<Executor>::value, bool>::type = true>
+void parallel_nth_element(Executor& ex, RandomAccessIterator first, RandomAccessIterator nth, RandomAccessIterator last, Compare comp)
+{
+    using std::sqrt;
+    using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    if(nth == last)
+    {
+        return;
+    }
+    std::vector<value_type> buffer;
+    for(;;)
+    {
+        const auto elements = static_cast<std::size_t>(last - first);
+        const unsigned chunks = parallel_chunk_count(elements, ex.concurrency(), 2, task_launch_cost(ex));
+        if(chunks < 2)
+        {
+            break;
+        }
+        const std::size_t samples = (std::min)(elements, std::size_t(1024));
+        std::vector<value_type> sample(samples);
+        for(std::size_t k = 0; k < samples; ++k)
+        {
+            sample[k] = first[k*elements/samples + elements/(2*samples)];
+        }
+        std::sort(sample.begin(), sample.end(), comp);
+        const double rank = static_cast<double>(nth - first)*samples/elements;
+        const double margin = 2*sqrt(static_cast<double>(samples));
+        const auto lower_index = static_cast<std::size_t>((std::max)(rank - margin, 0.0));
+        const auto upper_index = (std::min)(static_cast<std::size_t>(rank + margin), samples - 1);
+        const value_type lower = sample[lower_index];
+        const value_type upper = sample[upper_index];
+        auto group = [&lower, &upper, comp](const value_type& x) -> std::size_t
+        {
+            return comp(x, lower) ? 0 : comp(upper, x) ? 2 : 1;
+        };
+
+        const auto bounds = chunk_bounds(first, last, chunks);
+        std::vector<std::array<std::size_t, 3>> counts(chunks);
+        ex.bulk_execute(chunks, [&bounds, &counts, &group](std::size_t i)
+        {
+            std::array<std::size_t, 3> c {{0, 0, 0}};
+            for(auto it = bounds[i]; it != bounds[i + 1]; ++it)
+            {
+                ++c[group(*it)];
+            }
+            counts[i] = c;
+        });
+        // Where each chunk writes each group in the buffer:
+        std::vector<std::array<std::size_t, 3>> offsets(chunks);
+        std::size_t offset = 0;
+        for(std::size_t g = 0; g < 3; ++g)
+        {
+            for(std::size_t i = 0; i < chunks; ++i)
+            {
+                offsets[i][g] = offset;
+                offset += counts[i][g];
+            }
+        }
+        const std::size_t below = offsets[0][1];
+        const std::size_t above = offsets[0][2];
+
+        buffer.resize(elements);
+        ex.bulk_execute(chunks, [&bounds, &offsets, &buffer, &group](std::size_t i)
+        {
+            std::array<std::size_t, 3> o = offsets[i];
+            for(auto it = bounds[i]; it != bounds[i + 1]; ++it)
+            {
+                buffer[o[group(*it)]++] = std::move(*it);
+            }
+        });
+        ex.bulk_execute(chunks, [&bounds, &buffer, first](std::size_t i)
+        {
+            std::move(buffer.begin() + (bounds[i] - first), buffer.begin() + (bounds[i + 1] - first), bounds[i]);
+        });
+
+        const RandomAccessIterator middle_first = first + below;
+        const RandomAccessIterator middle_last = first + above;
+        if(nth < middle_first)
+        {
+            last = middle_first;
+        }
+        else if(nth >= middle_last)
+        {
+            first = middle_last;
+        }
+        else
+        {
+            // Equivalent pivots leave only elements equivalent to them in the middle:
+            if(!comp(lower, upper))
+            {
+                return;
+            }
+            first = middle_first;
+            last = middle_last;
+        }
+        if(static_cast<std::size_t>(last - first) == elements)
+        {
+            break;
+        }
+    }
+    std::nth_element(first, nth, last, comp);
+}
+
+template <typename Executor, typename RandomAccessIterator, typename std::enable_if<is_executor<Executor>::value, bool>::type = true>
+void parallel_nth_element(Executor& ex, RandomAccessIterator first, RandomAccessIterator nth, RandomAccessIterator last)
+{
+    parallel_nth_element(ex, first, nth, last, std::less<typename std::iterator_traits<RandomAccessIterator>::value_type>());
+}
+
+// Sequential, since the input is usually sorted already and one pass is memory bound:
+template <typename Executor, typename ForwardIterator, typename BinaryPredicate, typename std::enable_if<is_executor<Executor>::value, bool>::type = true>
+ForwardIterator parallel_unique(Executor&, ForwardIterator first, ForwardIterator last, BinaryPredicate pred)
+{
+    return std::unique(first, last, pred);
+}
+
+// <execution> is empty before C++17, even where the header exists:
+#if defined(BOOST_MATH_EXEC_COMPATIBLE) && defined(__cpp_lib_execution)
+
+// Execution policies go to the standard library algorithms:
+template <typename ExecutionPolicy, typename ForwardIterator, typename T, typename std::enable_if<!is_executor<ExecutionPolicy>::value, bool>::type = true>
+inline T parallel_reduce(ExecutionPolicy& exec, ForwardIterator first, ForwardIterator last, T init)
+{
+    return std::reduce(exec, first, last, init);
+}
+
+template <typename ExecutionPolicy, typename ForwardIterator, typename std::enable_if<!is_executor<ExecutionPolicy>::value, bool>::type = true>
+inline bool parallel_is_sorted(ExecutionPolicy& exec, ForwardIterator first, ForwardIterator last)
+{
+    return std::is_sorted(exec, first, last);
+}
+
+template <typename ExecutionPolicy, typename RandomAccessIterator, typename std::enable_if<!is_executor<ExecutionPolicy>::value, bool>::type = true>
+inline void parallel_sort(ExecutionPolicy& exec, RandomAccessIterator first, RandomAccessIterator last)
+{
+    std::sort(exec, first, last);
+}
+
+template <typename ExecutionPolicy, typename RandomAccessIterator, typename std::enable_if<!is_executor<ExecutionPolicy>::value, bool>::type = true>
+inline void parallel_nth_element(ExecutionPolicy& exec, RandomAccessIterator first, RandomAccessIterator nth, RandomAccessIterator last)
+{
+    std::nth_element(exec, first, nth, last);
+}
+
+template <typename ExecutionPolicy, typename RandomAccessIterator, typename Compare, typename std::enable_if<!is_executor<ExecutionPolicy>::value, bool>::type = true>
+inline void parallel_nth_element(ExecutionPolicy& exec, RandomAccessIterator first, RandomAccessIterator nth, RandomAccessIterator last, Compare comp)
+{
+    std::nth_element(exec, first, nth, last, comp);
+}
+
+template <typename ExecutionPolicy, typename ForwardIterator, typename BinaryPredicate, typename std::enable_if<!is_executor<ExecutionPolicy>::value, bool>::type = true>
+inline ForwardIterator parallel_unique(ExecutionPolicy& exec, ForwardIterator first, ForwardIterator last, BinaryPredicate pred)
+{
+    return std::unique(exec, first, last, pred);
+}
+
+#endif // BOOST_MATH_EXEC_COMPATIBLE && __cpp_lib_execution
+
+}}}} // namespace boost::math::statistics::detail
+
+#endif // BOOST_HAS_THREADS
+
+#endif // BOOST_MATH_STATISTICS_DETAIL_EXECUTOR_HPP
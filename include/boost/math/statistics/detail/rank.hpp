@@ -16,6 +16,7 @@
 
 #ifdef BOOST_MATH_EXEC_COMPATIBLE
 #include <execution>
+#include <boost/math/statistics/detail/executor.hpp>
 #endif
 
 namespace boost { namespace math { namespace statistics { namespace detail {
@@ -95,10 +96,11 @@ auto rank(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last)
         ++first;
     }
 
-    std::sort(exec, rank_vector.begin(), rank_vector.end());
+    // exec may be an execution policy, or an executor such as boost::math::tools::thread_pool:
+    parallel_sort(exec, rank_vector.begin(), rank_vector.end());
 
     // Remove duplicates
-    rank_vector.erase(std::unique(exec, rank_vector.begin(), rank_vector.end(), pair_equal()), rank_vector.end());
+    rank_vector.erase(parallel_unique(exec, rank_vector.begin(), rank_vector.end(), pair_equal()), rank_vector.end());
     elements = rank_vector.size();
 
     std::pair<T, std::size_t> rank;
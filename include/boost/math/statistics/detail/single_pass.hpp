@@ -20,8 +20,7 @@
 #include <vector>
 
 #ifdef BOOST_HAS_THREADS
-#include <future>
-#include <thread>
+#include <boost/math/statistics/detail/executor.hpp>
 #endif
 
 namespace boost { namespace math { namespace statistics { namespace detail {
@@ -112,94 +111,75 @@ ReturnType first_four_moments_sequential_impl(ForwardIterator first, ForwardIter
     return std::make_tuple(M1, M2, M3, M4, n-1);
 }
 
+// Merges the mean and central moment sums (M2, M3, M4) of the n_b values in set b into those
+// of the n_a values in set a, leaving the moments of the combined set in a.
+// EQN 3.1: https://www.osti.gov/servlets/purl/1426900
+template<typename Real>
+void combine_first_four_moments(Real& M1_a, Real& M2_a, Real& M3_a, Real& M4_a, Real& n_a,
+                                const Real& M1_b, const Real& M2_b, const Real& M3_b, const Real& M4_b, const Real& n_b)
+{
+    const Real n_ab = n_a + n_b;
+    const Real delta = M1_b - M1_a;
+
+    M1_a = (n_a * M1_a + n_b * M1_b) / n_ab;
+    M4_a = M4_a + M4_b + (delta * delta * delta * delta) * n_a * n_b * (n_a * n_a - n_a * n_b + n_b * n_b) / (n_ab * n_ab * n_ab)
+           + Real(6) * delta * delta * (n_a * n_a * M2_b + n_b * n_b * M2_a) / (n_ab * n_ab)
+           + Real(4) * delta * (n_a * M3_b - n_b * M3_a) / n_ab;
+    M3_a = M3_a + M3_b + (delta * delta * delta) * n_a * n_b * (n_a - n_b) / (n_ab * n_ab)
+           + Real(3) * delta * (n_a * M2_b - n_b * M2_a) / n_ab;
+    M2_a = M2_a + M2_b + delta * delta * (n_a * n_b / n_ab);
+    n_a = n_ab;
+}
+
 #ifdef BOOST_HAS_THREADS
 
 // https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance#Higher-order_statistics
 // EQN 3.1: https://www.osti.gov/servlets/purl/1426900
-template<typename ReturnType, typename ForwardIterator>
-ReturnType first_four_moments_parallel_impl(ForwardIterator first, ForwardIterator last)
+template<typename ReturnType, typename Executor, typename ForwardIterator>
+ReturnType first_four_moments_parallel_impl(Executor&& ex, ForwardIterator first, ForwardIterator last)
 {
     using Real = typename std::tuple_element<0, ReturnType>::type;
 
     const auto elements = std::distance(first, last);
-    const unsigned max_concurrency = std::thread::hardware_concurrency() == 0 ? 2u : std::thread::hardware_concurrency();
-    unsigned num_threads = 2u;
-    
-    // Threading is faster for: 10 + 5.13e-3 N/j <= 5.13e-3N => N >= 10^4j/5.13(j-1).
-    const auto parallel_lower_bound = 10e4*max_concurrency/(5.13*(max_concurrency-1));
-    const auto parallel_upper_bound = 10e4*2/5.13; // j = 2
 
-    // https://lemire.me/blog/2020/01/30/cost-of-a-thread-in-c-under-linux/
-    if(elements < parallel_lower_bound)
+    // 5.13 comes from benchmarking, see parallel_chunk_count:
+    const unsigned num_threads = parallel_chunk_count(elements, ex.concurrency(), 5.13, task_launch_cost(ex));
+    if(num_threads < 2)
     {
         return detail::first_four_moments_sequential_impl<ReturnType>(first, last);
     }
-    else if(elements >= parallel_upper_bound)
-    {
-        num_threads = max_concurrency;
-    }
-    else
-    {
-        for(unsigned i = 3; i < max_concurrency; ++i)
-        {
-            if(parallel_lower_bound < 10e4*i/(5.13*(i-1)))
-            {
-                num_threads = i;
-                break;
-            }
-        }
-    }
 
-    std::vector<std::future<ReturnType>> future_manager;
-    const auto elements_per_thread = std::ceil(static_cast<double>(elements) / num_threads);
-
-    auto it = first;
-    for(std::size_t i {}; i < num_threads - 1; ++i)
-    {
-        future_manager.emplace_back(std::async(std::launch::async | std::launch::deferred, [it, elements_per_thread]() -> ReturnType
-        {
-            return first_four_moments_sequential_impl<ReturnType>(it, std::next(it, elements_per_thread));
-        }));
-        it = std::next(it, elements_per_thread);
-    }
+    const auto bounds = chunk_bounds(first, last, num_threads);
 
-    future_manager.emplace_back(std::async(std::launch::async | std::launch::deferred, [it, last]() -> ReturnType
+    std::vector<ReturnType> results(num_threads);
+    ex.bulk_execute(num_threads, [&bounds, &results](std::size_t i)
     {
-        return first_four_moments_sequential_impl<ReturnType>(it, last);
-    }));
+        results[i] = first_four_moments_sequential_impl<ReturnType>(bounds[i], bounds[i + 1]);
+    });
 
-    auto temp = future_manager[0].get();
+    auto temp = results[0];
     Real M1_a = std::get<0>(temp);
     Real M2_a = std::get<1>(temp);
     Real M3_a = std::get<2>(temp);
     Real M4_a = std::get<3>(temp);
     Real range_a = std::get<4>(temp);
 
-    for(std::size_t i = 1; i < future_manager.size(); ++i)
+    for(std::size_t i = 1; i < results.size(); ++i)
     {
-        temp = future_manager[i].get();
-        Real M1_b = std::get<0>(temp);
-        Real M2_b = std::get<1>(temp);
-        Real M3_b = std::get<2>(temp);
-        Real M4_b = std::get<3>(temp);
-        Real range_b = std::get<4>(temp);
-
-        const Real n_ab = range_a + range_b;
-        const Real delta = M1_b - M1_a;
-        
-        M1_a = (range_a * M1_a + range_b * M1_b) / n_ab;
-        M2_a = M2_a + M2_b + delta * delta * (range_a * range_b / n_ab);
-        M3_a = M3_a + M3_b + (delta * delta * delta) * range_a * range_b * (range_a - range_b) / (n_ab * n_ab)    
-               + Real(3) * delta * (range_a * M2_b - range_b * M2_a) / n_ab;
-        M4_a = M4_a + M4_b + (delta * delta * delta * delta) * range_a * range_b * (range_a * range_a - range_a * range_b + range_b * range_b) / (n_ab * n_ab * n_ab)
-               + Real(6) * delta * delta * (range_a * range_a * M2_b + range_b * range_b * M2_a) / (n_ab * n_ab) 
-               + Real(4) * delta * (range_a * M3_b - range_b * M3_a) / n_ab;
-        range_a = n_ab;
+        temp = results[i];
+        combine_first_four_moments(M1_a, M2_a, M3_a, M4_a, range_a,
+                                   Real(std::get<0>(temp)), Real(std::get<1>(temp)), Real(std::get<2>(temp)), Real(std::get<3>(temp)), Real(std::get<4>(temp)));
     }
 
     return std::make_tuple(M1_a, M2_a, M3_a, M4_a, elements);
 }
 
+template<typename ReturnType, typename ForwardIterator>
+ReturnType first_four_moments_parallel_impl(ForwardIterator first, ForwardIterator last)
+{
+    return first_four_moments_parallel_impl<ReturnType>(async_executor(), first, last);
+}
+
 #endif // BOOST_HAS_THREADS
 
 // Follows equation 1.5 of:
@@ -285,65 +265,35 @@ ReturnType gini_range_fraction(ForwardIterator first, ForwardIterator last, std:
 #ifdef BOOST_HAS_THREADS
 
 template<typename ReturnType, typename ExecutionPolicy, typename ForwardIterator>
-ReturnType gini_coefficient_parallel_impl(ExecutionPolicy&&, ForwardIterator first, ForwardIterator last)
+ReturnType gini_coefficient_parallel_impl(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last)
 {
     using range_tuple = std::tuple<ReturnType, ReturnType, std::size_t>;
     
     const auto elements = std::distance(first, last);
-    const unsigned max_concurrency = std::thread::hardware_concurrency() == 0 ? 2u : std::thread::hardware_concurrency();
-    unsigned num_threads = 2u;
-    
-    // Threading is faster for: 10 + 10.12e-3 N/j <= 10.12e-3N => N >= 10^4j/10.12(j-1).
-    const auto parallel_lower_bound = 10e4*max_concurrency/(10.12*(max_concurrency-1));
-    const auto parallel_upper_bound = 10e4*2/10.12; // j = 2
+    auto&& ex = executor_for(exec);
 
-    // https://lemire.me/blog/2020/01/30/cost-of-a-thread-in-c-under-linux/
-    if(elements < parallel_lower_bound)
+    // 10.12 comes from benchmarking, see parallel_chunk_count:
+    const unsigned num_threads = parallel_chunk_count(elements, ex.concurrency(), 10.12, task_launch_cost(ex));
+    if(num_threads < 2)
     {
         return gini_coefficient_sequential_impl<ReturnType>(first, last);
     }
-    else if(elements >= parallel_upper_bound)
-    {
-        num_threads = max_concurrency;
-    }
-    else
-    {
-        for(unsigned i = 3; i < max_concurrency; ++i)
-        {
-            if(parallel_lower_bound < 10e4*i/(10.12*(i-1)))
-            {
-                num_threads = i;
-                break;
-            }
-        }
-    }
 
-    std::vector<std::future<range_tuple>> future_manager;
-    const auto elements_per_thread = std::ceil(static_cast<double>(elements) / num_threads);
-
-    auto it = first;
-    for(std::size_t i {}; i < num_threads - 1; ++i)
-    {
-        future_manager.emplace_back(std::async(std::launch::async | std::launch::deferred, [it, elements_per_thread, i]() -> range_tuple
-        {
-            return gini_range_fraction<range_tuple>(it, std::next(it, elements_per_thread), i*elements_per_thread);
-        }));
-        it = std::next(it, elements_per_thread);
-    }
+    const auto bounds = chunk_bounds(first, last, num_threads);
 
-    future_manager.emplace_back(std::async(std::launch::async | std::launch::deferred, [it, last, num_threads, elements_per_thread]() -> range_tuple
+    std::vector<range_tuple> results(num_threads);
+    ex.bulk_execute(num_threads, [&bounds, &results, first](std::size_t i)
     {
-        return gini_range_fraction<range_tuple>(it, last, (num_threads - 1)*elements_per_thread);
-    }));
+        results[i] = gini_range_fraction<range_tuple>(bounds[i], bounds[i + 1], static_cast<std::size_t>(std::distance(first, bounds[i])));
+    });
 
     ReturnType num = 0;
     ReturnType denom = 0;
 
-    for(std::size_t i = 0; i < future_manager.size(); ++i)
+    for(std::size_t i = 0; i < results.size(); ++i)
     {
-        auto temp = future_manager[i].get();
-        num += std::get<0>(temp);
-        denom += std::get<1>(temp);
+        num += std::get<0>(results[i]);
+        denom += std::get<1>(results[i]);
     }
 
     // If the l1 norm is zero, all elements are zero, so every element is the same.
@@ -0,0 +1,354 @@
+//  Copyright Boost.Math contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_STATISTICS_QUANTILE_SKETCH_HPP
+#define BOOST_MATH_STATISTICS_QUANTILE_SKETCH_HPP
+
+#include <boost/math/statistics/univariate_statistics.hpp>
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <boost/math/tools/config.hpp>
+#include <boost/math/tools/assert.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace boost { namespace math { namespace statistics {
+
+// A bounded memory estimator of the quantiles of a stream of values, following:
+//
+// Z. Karnin, K. Lang and E. Liberty, "Optimal Quantile Approximation in Streams",
+// IEEE 57th Annual Symposium on Foundations of Computer Science (FOCS), 2016.
+//
+// Values are retained in a stack of compactors, where each value at level h
+// stands for 2^h values of the stream.  When the sketch is full the lowest full
+// compactor is sorted, and either its odd or its even elements, chosen at
+// random, are promoted to the level above while the rest are discarded.  The
+// capacity of each level shrinks geometrically, by a factor 2/3, from the top,
+// so that about 3k values are retained however long the stream is.
+//
+// Until the first compaction every value is retained and the results are exact.
+template<typename Real>
+class quantile_sketch
+{
+public:
+    using value_type = Real;
+
+    // Larger k gives smaller errors, see normalized_rank_error:
+    explicit quantile_sketch(std::size_t k = 200, std::uint_fast32_t seed = 1)
+        : k_(k), n_(0), retained_(0), capacity_(0), gen_(seed)
+    {
+        if (k_ < 8)
+        {
+            throw std::domain_error("The sketch parameter k must be at least 8.");
+        }
+        grow();
+    }
+
+    void push(const Real& x)
+    {
+        if ((boost::math::isnan)(x))
+        {
+            throw std::domain_error("NaN values can not be ranked.");
+        }
+        if (n_ == 0)
+        {
+            min_ = x;
+            max_ = x;
+        }
+        else
+        {
+            min_ = (std::min)(min_, x);
+            max_ = (std::max)(max_, x);
+        }
+        levels_[0].push_back(x);
+        ++n_;
+        if (++retained_ >= capacity_)
+        {
+            compress();
+        }
+    }
+
+    template<typename ForwardIterator>
+    void push(ForwardIterator first, ForwardIterator last)
+    {
+        for (; first != last; ++first)
+        {
+            push(*first);
+        }
+    }
+
+    void operator()(const Real& x)
+    {
+        push(x);
+    }
+
+    // Merges the values summarised by other into this sketch, the error bound
+    // of the result is that of a single sketch with this sketch's k:
+    quantile_sketch& operator+=(const quantile_sketch& other)
+    {
+        if (other.n_ == 0)
+        {
+            return *this;
+        }
+        if (n_ == 0)
+        {
+            min_ = other.min_;
+            max_ = other.max_;
+        }
+        else
+        {
+            min_ = (std::min)(min_, other.min_);
+            max_ = (std::max)(max_, other.max_);
+        }
+        while (levels_.size() < other.levels_.size())
+        {
+            grow();
+        }
+        for (std::size_t h = 0; h < other.levels_.size(); ++h)
+        {
+            levels_[h].insert(levels_[h].end(), other.levels_[h].begin(), other.levels_[h].end());
+        }
+        n_ += other.n_;
+        retained_ += other.retained_;
+        while (retained_ >= capacity_)
+        {
+            compress();
+        }
+        return *this;
+    }
+
+    std::uintmax_t count() const
+    {
+        return n_;
+    }
+
+    // The number of values currently held:
+    std::size_t retained() const
+    {
+        return retained_;
+    }
+
+    bool is_exact() const
+    {
+        return levels_.size() == 1;
+    }
+
+    Real (min)() const
+    {
+        BOOST_MATH_ASSERT_MSG(n_ > 0, "At least one sample is required.");
+        return min_;
+    }
+
+    Real (max)() const
+    {
+        BOOST_MATH_ASSERT_MSG(n_ > 0, "At least one sample is required.");
+        return max_;
+    }
+
+    // An empirical bound on the error in the rank of a returned quantile, as a
+    // fraction of the count, which holds with 99% confidence.  This is the fit
+    // to the measured errors of the same construction given by the Apache
+    // DataSketches project, for example 1.3% for k = 200 and 0.14% for k = 2000.
+    double normalized_rank_error() const
+    {
+        if (is_exact())
+        {
+            return 0;
+        }
+        using std::pow;
+        return 2.296 / pow(static_cast<double>(k_), 0.9723);
+    }
+
+    // The fraction of the values which are less than or equal to x:
+    double rank(const Real& x) const
+    {
+        BOOST_MATH_ASSERT_MSG(n_ > 0, "At least one sample is required to compute the rank.");
+        std::uintmax_t weight = 0;
+        for (std::size_t h = 0; h < levels_.size(); ++h)
+        {
+            for (const Real& y : levels_[h])
+            {
+                if (y <= x)
+                {
+                    weight += std::uintmax_t(1) << h;
+                }
+            }
+        }
+        return static_cast<double>(weight) / static_cast<double>(n_);
+    }
+
+    // The smallest retained value whose estimated rank is at least q.
+    // q = 0 and q = 1 give the exact minimum and maximum:
+    Real quantile(double q) const
+    {
+        BOOST_MATH_ASSERT_MSG(n_ > 0, "At least one sample is required to compute a quantile.");
+        if (!(q >= 0 && q <= 1))
+        {
+            throw std::domain_error("The quantile must be in [0, 1].");
+        }
+        if (q == 0)
+        {
+            return min_;
+        }
+        if (q == 1)
+        {
+            return max_;
+        }
+        return weighted_quantile(sorted_items(), q);
+    }
+
+    Real median() const
+    {
+        BOOST_MATH_ASSERT_MSG(n_ > 0, "At least one sample is required to compute the median.");
+        if (is_exact())
+        {
+            std::vector<Real> v(levels_[0]);
+            return boost::math::statistics::median(v);
+        }
+        return weighted_quantile(sorted_items(), 0.5);
+    }
+
+    Real interquartile_range() const
+    {
+        BOOST_MATH_ASSERT_MSG(n_ > 0, "At least one sample is required to compute the interquartile range.");
+        if (is_exact())
+        {
+            std::vector<Real> v(levels_[0]);
+            return boost::math::statistics::interquartile_range(v);
+        }
+        const auto items = sorted_items();
+        return weighted_quantile(items, 0.75) - weighted_quantile(items, 0.25);
+    }
+
+    // The median of |x - median|, estimated from the same retained values.
+    // Its rank error, measured among the absolute deviations, is within about
+    // twice normalized_rank_error:
+    Real median_absolute_deviation() const
+    {
+        using std::abs;
+        BOOST_MATH_ASSERT_MSG(n_ > 0, "At least one sample is required to compute the median absolute deviation.");
+        if (is_exact())
+        {
+            std::vector<Real> v(levels_[0]);
+            return boost::math::statistics::median_absolute_deviation(v);
+        }
+        auto items = sorted_items();
+        const Real center = weighted_quantile(items, 0.5);
+        for (auto& item : items)
+        {
+            item.first = abs(item.first - center);
+        }
+        std::sort(items.begin(), items.end());
+        return weighted_quantile(items, 0.5);
+    }
+
+private:
+    using item_type = std::pair<Real, std::uintmax_t>;
+
+    std::size_t level_capacity(std::size_t h) const
+    {
+        using std::ceil;
+        using std::pow;
+        const double depth = static_cast<double>(levels_.size() - h - 1);
+        return (std::max)(std::size_t(8), static_cast<std::size_t>(ceil(static_cast<double>(k_) * pow(2.0 / 3, depth))));
+    }
+
+    void grow()
+    {
+        levels_.emplace_back();
+        capacity_ = 0;
+        for (std::size_t h = 0; h < levels_.size(); ++h)
+        {
+            capacity_ += level_capacity(h);
+        }
+    }
+
+    // Compacts full levels, lowest first, until the sketch is below capacity:
+    void compress()
+    {
+        for (std::size_t h = 0; h < levels_.size(); ++h)
+        {
+            if (levels_[h].size() < level_capacity(h))
+            {
+                continue;
+            }
+            if (h + 1 == levels_.size())
+            {
+                grow();
+            }
+            std::vector<Real>& level = levels_[h];
+            std::sort(level.begin(), level.end());
+            // An odd element out stays at this level:
+            const std::size_t leftover = level.size() % 2;
+            const std::size_t offset = leftover + static_cast<std::size_t>(gen_() & 1u);
+            std::vector<Real>& above = levels_[h + 1];
+            for (std::size_t i = offset; i < level.size(); i += 2)
+            {
+                above.push_back(level[i]);
+            }
+            retained_ -= (level.size() - leftover) / 2;
+            level.resize(leftover);
+            if (retained_ < capacity_)
+            {
+                return;
+            }
+        }
+    }
+
+    std::vector<item_type> sorted_items() const
+    {
+        std::vector<item_type> items;
+        items.reserve(retained_);
+        for (std::size_t h = 0; h < levels_.size(); ++h)
+        {
+            for (const Real& y : levels_[h])
+            {
+                items.emplace_back(y, std::uintmax_t(1) << h);
+            }
+        }
+        std::sort(items.begin(), items.end());
+        return items;
+    }
+
+    Real weighted_quantile(const std::vector<item_type>& items, double q) const
+    {
+        const double target = q * static_cast<double>(n_);
+        std::uintmax_t weight = 0;
+        for (const auto& item : items)
+        {
+            weight += item.second;
+            if (static_cast<double>(weight) >= target)
+            {
+                return item.first;
+            }
+        }
+        return items.back().first;
+    }
+
+    std::size_t k_;
+    std::uintmax_t n_;
+    std::size_t retained_;
+    std::size_t capacity_;
+    std::vector<std::vector<Real>> levels_;
+    Real min_ {};
+    Real max_ {};
+    std::minstd_rand gen_;
+};
+
+template<typename Real>
+inline quantile_sketch<Real> operator+(quantile_sketch<Real> a, const quantile_sketch<Real>& b)
+{
+    a += b;
+    return a;
+}
+
+}}} // namespace boost::math::statistics
+
+#endif // BOOST_MATH_STATISTICS_QUANTILE_SKETCH_HPP
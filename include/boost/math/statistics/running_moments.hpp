@@ -0,0 +1,178 @@
+//  Copyright Boost.Math contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_STATISTICS_RUNNING_MOMENTS_HPP
+#define BOOST_MATH_STATISTICS_RUNNING_MOMENTS_HPP
+
+#include <boost/math/statistics/detail/single_pass.hpp>
+#include <boost/math/tools/config.hpp>
+#include <boost/math/tools/assert.hpp>
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <tuple>
+
+namespace boost { namespace math { namespace statistics {
+
+// Maintains the mean and the second, third and fourth central moments of a
+// stream of values in constant memory.  Values may be added one at a time or
+// in blocks, and accumulators filled on different threads may be merged.
+//
+// The updates follow the same single pass and pairwise combination formulas
+// as first_four_moments, see:
+// https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance#Higher-order_statistics
+// EQN 3.1: https://www.osti.gov/servlets/purl/1426900
+template<typename Real>
+class running_moments
+{
+public:
+    using value_type = Real;
+
+    running_moments() : M1_(0), M2_(0), M3_(0), M4_(0), n_(0) {}
+
+    template<typename ForwardIterator>
+    running_moments(ForwardIterator first, ForwardIterator last) : running_moments()
+    {
+        push(first, last);
+    }
+
+    void push(const Real& x)
+    {
+        n_ += 1;
+        const Real n = n_;
+        const Real delta21 = x - M1_;
+        const Real tmp = delta21/n;
+        M4_ = M4_ + tmp*(tmp*tmp*delta21*((n-1)*(n*n-3*n+3)) + 6*tmp*M2_ - 4*M3_);
+        M3_ = M3_ + tmp*((n-1)*(n-2)*delta21*tmp - 3*M2_);
+        M2_ = M2_ + tmp*(n-1)*delta21;
+        M1_ = M1_ + tmp;
+    }
+
+    // Accumulates a block of values with the sequential kernel, then merges it in:
+    template<typename ForwardIterator>
+    void push(ForwardIterator first, ForwardIterator last)
+    {
+        if (first == last)
+        {
+            return;
+        }
+        const auto block = detail::first_four_moments_sequential_impl<std::tuple<Real, Real, Real, Real, Real>>(first, last);
+        merge(std::get<0>(block), std::get<1>(block), std::get<2>(block), std::get<3>(block), std::get<4>(block));
+    }
+
+    void operator()(const Real& x)
+    {
+        push(x);
+    }
+
+    running_moments& operator+=(const running_moments& other)
+    {
+        merge(other.M1_, other.M2_, other.M3_, other.M4_, Real(other.n_));
+        return *this;
+    }
+
+    void clear()
+    {
+        *this = running_moments();
+    }
+
+    std::uintmax_t count() const
+    {
+        return n_;
+    }
+
+    Real mean() const
+    {
+        BOOST_MATH_ASSERT_MSG(n_ > 0, "At least one sample is required to compute the mean.");
+        return M1_;
+    }
+
+    Real variance() const
+    {
+        BOOST_MATH_ASSERT_MSG(n_ > 0, "At least one sample is required to compute the variance.");
+        return M2_/Real(n_);
+    }
+
+    Real sample_variance() const
+    {
+        BOOST_MATH_ASSERT_MSG(n_ > 1, "At least two samples are required to compute the sample variance.");
+        return M2_/Real(n_ - 1);
+    }
+
+    Real skewness() const
+    {
+        using std::sqrt;
+        BOOST_MATH_ASSERT_MSG(n_ > 0, "At least one sample is required to compute skewness.");
+        if (M2_ == 0)
+        {
+            // A constant dataset has no skewness:
+            return Real(0);
+        }
+        return sqrt(Real(n_))*M3_/(M2_*sqrt(M2_));
+    }
+
+    Real kurtosis() const
+    {
+        BOOST_MATH_ASSERT_MSG(n_ > 0, "At least one sample is required to compute kurtosis.");
+        if (M2_ == 0)
+        {
+            return Real(0);
+        }
+        return Real(n_)*M4_/(M2_*M2_);
+    }
+
+    Real excess_kurtosis() const
+    {
+        return kurtosis() - 3;
+    }
+
+    // The mean and the second, third and fourth central moments,
+    // as returned by first_four_moments:
+    std::tuple<Real, Real, Real, Real> first_four_moments() const
+    {
+        BOOST_MATH_ASSERT_MSG(n_ > 0, "At least one sample is required to compute the moments.");
+        const Real n = n_;
+        return std::make_tuple(M1_, M2_/n, M3_/n, M4_/n);
+    }
+
+private:
+    void merge(const Real& M1, const Real& M2, const Real& M3, const Real& M4, const Real& n)
+    {
+        if (n == 0)
+        {
+            return;
+        }
+        if (n_ == 0)
+        {
+            M1_ = M1;
+            M2_ = M2;
+            M3_ = M3;
+            M4_ = M4;
+        }
+        else
+        {
+            Real n_a = n_;
+            detail::combine_first_four_moments(M1_, M2_, M3_, M4_, n_a, M1, M2, M3, M4, n);
+        }
+        n_ += static_cast<std::uintmax_t>(n);
+    }
+
+    Real M1_;
+    Real M2_;
+    Real M3_;
+    Real M4_;
+    std::uintmax_t n_;
+};
+
+template<typename Real>
+inline running_moments<Real> operator+(running_moments<Real> a, const running_moments<Real>& b)
+{
+    a += b;
+    return a;
+}
+
+}}} // namespace boost::math::statistics
+
+#endif // BOOST_MATH_STATISTICS_RUNNING_MOMENTS_HPP
@@ -39,7 +39,7 @@ inline auto mean(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator
         }
         else
         {
-            return std::reduce(exec, first, last, 0.0) / std::distance(first, last);
+            return detail::parallel_reduce(exec, first, last, 0.0) / std::distance(first, last);
         }
     }
     else
@@ -50,7 +50,7 @@ inline auto mean(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator
         }
         else
         {
-            return std::reduce(exec, first, last, Real(0.0)) / Real(std::distance(first, last));
+            return detail::parallel_reduce(exec, first, last, Real(0.0)) / Real(std::distance(first, last));
         }
     }
 }
@@ -86,7 +86,7 @@ inline auto variance(ExecutionPolicy&& exec, ForwardIterator first, ForwardItera
         }
         else
         {
-            const auto results = detail::first_four_moments_parallel_impl<std::tuple<double, double, double, double, double>>(first, last);
+            const auto results = detail::first_four_moments_parallel_impl<std::tuple<double, double, double, double, double>>(detail::executor_for(exec), first, last);
             return std::get<1>(results) / std::get<4>(results);
         }
     }
@@ -98,7 +98,7 @@ inline auto variance(ExecutionPolicy&& exec, ForwardIterator first, ForwardItera
         }
         else
         {
-            const auto results = detail::first_four_moments_parallel_impl<std::tuple<Real, Real, Real, Real, Real>>(first, last);
+            const auto results = detail::first_four_moments_parallel_impl<std::tuple<Real, Real, Real, Real, Real>>(detail::executor_for(exec), first, last);
             return std::get<1>(results) / std::get<4>(results);
         }
     }
@@ -162,7 +162,7 @@ inline auto mean_and_sample_variance(ExecutionPolicy&& exec, ForwardIterator fir
         }
         else
         {
-            const auto results = detail::first_four_moments_parallel_impl<std::tuple<double, double, double, double, double>>(first, last);
+            const auto results = detail::first_four_moments_parallel_impl<std::tuple<double, double, double, double, double>>(detail::executor_for(exec), first, last);
             return std::make_pair(std::get<0>(results), std::get<1>(results) / (std::get<4>(results)-1.0));
         }
     }
@@ -175,7 +175,7 @@ inline auto mean_and_sample_variance(ExecutionPolicy&& exec, ForwardIterator fir
         }
         else
         {
-            const auto results = detail::first_four_moments_parallel_impl<std::tuple<Real, Real, Real, Real, Real>>(first, last);
+            const auto results = detail::first_four_moments_parallel_impl<std::tuple<Real, Real, Real, Real, Real>>(detail::executor_for(exec), first, last);
             return std::make_pair(std::get<0>(results), std::get<1>(results) / (std::get<4>(results)-Real(1)));
         }
     }
@@ -214,7 +214,7 @@ inline auto first_four_moments(ExecutionPolicy&& exec, ForwardIterator first, Fo
         }
         else
         {
-            const auto results = detail::first_four_moments_parallel_impl<std::tuple<double, double, double, double, double>>(first, last);
+            const auto results = detail::first_four_moments_parallel_impl<std::tuple<double, double, double, double, double>>(detail::executor_for(exec), first, last);
             return std::make_tuple(std::get<0>(results), std::get<1>(results) / std::get<4>(results), std::get<2>(results) / std::get<4>(results),
                                    std::get<3>(results) / std::get<4>(results));
         }
@@ -229,7 +229,7 @@ inline auto first_four_moments(ExecutionPolicy&& exec, ForwardIterator first, Fo
         }
         else
         {
-            const auto results = detail::first_four_moments_parallel_impl<std::tuple<Real, Real, Real, Real, Real>>(first, last);
+            const auto results = detail::first_four_moments_parallel_impl<std::tuple<Real, Real, Real, Real, Real>>(detail::executor_for(exec), first, last);
             return std::make_tuple(std::get<0>(results), std::get<1>(results) / std::get<4>(results), std::get<2>(results) / std::get<4>(results),
                                    std::get<3>(results) / std::get<4>(results));
         }
@@ -380,14 +380,14 @@ auto median(ExecutionPolicy&& exec, RandomAccessIterator first, RandomAccessIter
     if (num_elems & 1)
     {
         auto middle = first + (num_elems - 1)/2;
-        std::nth_element(exec, first, middle, last);
+        detail::parallel_nth_element(exec, first, middle, last);
         return *middle;
     }
     else
     {
         auto middle = first + num_elems/2 - 1;
-        std::nth_element(exec, first, middle, last);
-        std::nth_element(exec, middle, middle+1, last);
+        detail::parallel_nth_element(exec, first, middle, last);
+        detail::parallel_nth_element(exec, middle, middle+1, last);
         return (*middle + *(middle+1))/2;
     }
 }
@@ -416,9 +416,9 @@ inline auto gini_coefficient(ExecutionPolicy&& exec, RandomAccessIterator first,
 {
     using Real = typename std::iterator_traits<RandomAccessIterator>::value_type;
 
-    if(!std::is_sorted(exec, first, last))
+    if(!detail::parallel_is_sorted(exec, first, last))
     {
-        std::sort(exec, first, last);
+        detail::parallel_sort(exec, first, last);
     }
 
     if constexpr (std::is_same_v<std::remove_reference_t<decltype(exec)>, decltype(std::execution::seq)>)
@@ -504,14 +504,14 @@ auto median_absolute_deviation(ExecutionPolicy&& exec, RandomAccessIterator firs
     if (num_elems & 1)
     {
         auto middle = first + (num_elems - 1)/2;
-        std::nth_element(exec, first, middle, last, comparator);
+        detail::parallel_nth_element(exec, first, middle, last, comparator);
         return abs(*middle);
     }
     else
     {
         auto middle = first + num_elems/2 - 1;
-        std::nth_element(exec, first, middle, last, comparator);
-        std::nth_element(exec, middle, middle+1, last, comparator);
+        detail::parallel_nth_element(exec, first, middle, last, comparator);
+        detail::parallel_nth_element(exec, middle, middle+1, last, comparator);
         return (abs(*middle) + abs(*(middle+1)))/abs(static_cast<Real>(2));
     }
 }
@@ -555,23 +555,23 @@ auto interquartile_range(ExecutionPolicy&& exec, ForwardIterator first, ForwardI
     {
         auto q1 = first + k;
         auto q3 = first + 3*k + j - 1;
-        std::nth_element(exec, first, q1, last);
+        detail::parallel_nth_element(exec, first, q1, last);
         Real Q1 = *q1;
-        std::nth_element(exec, q1, q3, last);
+        detail::parallel_nth_element(exec, q1, q3, last);
         Real Q3 = *q3;
         return Q3 - Q1;
     } else {
         // j == 0 or j==1:
         auto q1 = first + k - 1;
         auto q3 = first + 3*k - 1 + j;
-        std::nth_element(exec, first, q1, last);
+        detail::parallel_nth_element(exec, first, q1, last);
         Real a = *q1;
-        std::nth_element(exec, q1, q1 + 1, last);
+        detail::parallel_nth_element(exec, q1, q1 + 1, last);
         Real b = *(q1 + 1);
         Real Q1 = (a+b)/2;
-        std::nth_element(exec, q1, q3, last);
+        detail::parallel_nth_element(exec, q1, q3, last);
         a = *q3;
-        std::nth_element(exec, q3, q3 + 1, last);
+        detail::parallel_nth_element(exec, q3, q3 + 1, last);
         b = *(q3 + 1);
         Real Q3 = (a+b)/2;
         return Q3 - Q1;
@@ -599,11 +599,11 @@ inline auto interquartile_range(RandomAccessContainer & v)
 template<class ExecutionPolicy, class ForwardIterator, class OutputIterator>
 inline OutputIterator mode(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last, OutputIterator output)
 {
-    if(!std::is_sorted(exec, first, last))
+    if(!detail::parallel_is_sorted(exec, first, last))
     {
         if constexpr (std::is_same_v<typename std::iterator_traits<ForwardIterator>::iterator_category(), std::random_access_iterator_tag>)
         {
-            std::sort(exec, first, last);
+            detail::parallel_sort(exec, first, last);
         }
         else
         {
@@ -6,9 +6,14 @@
 #ifndef BOOST_MATH_TOOLS_NORMS_HPP
 #define BOOST_MATH_TOOLS_NORMS_HPP
 #include <algorithm>
+#include <cstddef>
 #include <iterator>
 #include <complex>
 #include <cmath>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <vector>
 #include <boost/math/tools/assert.hpp>
 #include <boost/math/tools/complex.hpp>
 
@@ -23,6 +28,367 @@
 
 namespace boost::math::tools {
 
+namespace detail {
+
+// Ranges of float, double or long double held in contiguous memory are
+// handed to the kernels below.  Each kernel keeps norm_lanes<T> independent
+// partial results, enough to fill a 64 byte vector register, so that the
+// compiler can vectorize the loops without having to reassociate a single
+// sum, and then combines them pairwise.
+template<class ForwardIterator>
+struct is_contiguous_real_iterator
+{
+    using value_type = typename std::iterator_traits<ForwardIterator>::value_type;
+    static constexpr bool value = std::is_floating_point<value_type>::value &&
+                                  (std::is_pointer<ForwardIterator>::value ||
+                                   std::is_same<ForwardIterator, typename std::vector<value_type>::iterator>::value ||
+                                   std::is_same<ForwardIterator, typename std::vector<value_type>::const_iterator>::value);
+};
+
+template<class T>
+constexpr std::size_t norm_lanes = sizeof(T) >= 16 ? 4 : 64/sizeof(T);
+
+// Values at a time in the blocked, scaled sum of squares:
+constexpr std::size_t norm_block = 256;
+
+template<class T>
+inline T sum_lanes(T (&acc)[norm_lanes<T>])
+{
+    for (std::size_t w = norm_lanes<T>/2; w > 0; w /= 2)
+    {
+        for (std::size_t j = 0; j < w; ++j)
+        {
+            acc[j] += acc[j + w];
+        }
+    }
+    return acc[0];
+}
+
+// The larger of a and b, or a NaN if either is one:
+template<class T>
+inline T nan_propagating_max(const T& a, const T& b)
+{
+    return (a > b || a != a) ? a : b;
+}
+
+// The comparisons in the sup kernels drop NaNs, so they also sum the absolute
+// values, which is NaN only if an element is.  The sum vectorizes where a NaN
+// test in the comparison does not.
+template<class T>
+inline T max_lanes(T (&acc)[norm_lanes<T>], T (&sum)[norm_lanes<T>])
+{
+    T m = acc[0];
+    for (std::size_t j = 1; j < norm_lanes<T>; ++j)
+    {
+        m = acc[j] > m ? acc[j] : m;
+    }
+    const T s = sum_lanes(sum);
+    return s != s ? s : m;
+}
+
+template<class T>
+T l1_norm_contiguous(const T* p, std::size_t n)
+{
+    using std::abs;
+    T acc[norm_lanes<T>] = {};
+    std::size_t i = 0;
+    for (; i + norm_lanes<T> <= n; i += norm_lanes<T>)
+    {
+        for (std::size_t j = 0; j < norm_lanes<T>; ++j)
+        {
+            acc[j] += abs(p[i + j]);
+        }
+    }
+    for (std::size_t j = 0; i < n; ++i, ++j)
+    {
+        acc[j] += abs(p[i]);
+    }
+    return sum_lanes(acc);
+}
+
+template<class T>
+T sup_norm_contiguous(const T* p, std::size_t n)
+{
+    using std::abs;
+    T acc[norm_lanes<T>] = {};
+    T sum[norm_lanes<T>] = {};
+    std::size_t i = 0;
+    for (; i + norm_lanes<T> <= n; i += norm_lanes<T>)
+    {
+        for (std::size_t j = 0; j < norm_lanes<T>; ++j)
+        {
+            const T a = abs(p[i + j]);
+            acc[j] = a > acc[j] ? a : acc[j];
+            sum[j] += a;
+        }
+    }
+    for (std::size_t j = 0; i < n; ++i, ++j)
+    {
+        const T a = abs(p[i]);
+        acc[j] = a > acc[j] ? a : acc[j];
+        sum[j] += a;
+    }
+    return max_lanes(acc, sum);
+}
+
+template<class T>
+T sum_of_squares_contiguous(const T* p, std::size_t n)
+{
+    T acc[norm_lanes<T>] = {};
+    std::size_t i = 0;
+    for (; i + norm_lanes<T> <= n; i += norm_lanes<T>)
+    {
+        for (std::size_t j = 0; j < norm_lanes<T>; ++j)
+        {
+            acc[j] += p[i + j]*p[i + j];
+        }
+    }
+    for (std::size_t j = 0; i < n; ++i, ++j)
+    {
+        acc[j] += p[i]*p[i];
+    }
+    return sum_lanes(acc);
+}
+
+// Sum of (p[i]/scale)^2:
+template<class T>
+T scaled_sum_of_squares_contiguous(const T* p, std::size_t n, T scale)
+{
+    T acc[norm_lanes<T>] = {};
+    std::size_t i = 0;
+    for (; i + norm_lanes<T> <= n; i += norm_lanes<T>)
+    {
+        for (std::size_t j = 0; j < norm_lanes<T>; ++j)
+        {
+            const T x = p[i + j]/scale;
+            acc[j] += x*x;
+        }
+    }
+    for (std::size_t j = 0; i < n; ++i, ++j)
+    {
+        const T x = p[i]/scale;
+        acc[j] += x*x;
+    }
+    return sum_lanes(acc);
+}
+
+// One pass, overflow and underflow free, l2 norm.  Each block is scaled by its
+// own largest element, and the running sum of squares is rescaled whenever a
+// larger element is found, as in the LAPACK routine xLASSQ.
+template<class T>
+T scaled_l2_norm_contiguous(const T* p, std::size_t n)
+{
+    using std::sqrt;
+    using std::isfinite;
+    T scale = 0;
+    T ssq = 0;
+    for (std::size_t i = 0; i < n; i += norm_block)
+    {
+        const std::size_t m = (std::min)(norm_block, n - i);
+        const T a = sup_norm_contiguous(p + i, m);
+        if (a == 0)
+        {
+            continue;
+        }
+        if (!isfinite(a))
+        {
+            return a;
+        }
+        const T block = scaled_sum_of_squares_contiguous(p + i, m, a);
+        if (a > scale)
+        {
+            const T r = scale/a;
+            ssq = ssq*r*r + block;
+            scale = a;
+        }
+        else
+        {
+            const T r = a/scale;
+            ssq += block*r*r;
+        }
+    }
+    return scale*sqrt(ssq);
+}
+
+template<class T>
+T l2_norm_contiguous(const T* p, std::size_t n)
+{
+    using std::sqrt;
+    using std::isfinite;
+    using std::isnan;
+    const T ssq = sum_of_squares_contiguous(p, n);
+    // Below this the squares of the smaller elements may have lost precision or underflowed:
+    const T tiny = (std::numeric_limits<T>::min)()/std::numeric_limits<T>::epsilon();
+    if ((isfinite(ssq) && ssq >= tiny) || isnan(ssq))
+    {
+        return sqrt(ssq);
+    }
+    return scaled_l2_norm_contiguous(p, n);
+}
+
+// Sum of load(i)^k for i in [0, n), where the powers are taken by repeated
+// squaring in step across all the lanes:
+template<class T, class Load>
+T lp_sum_contiguous(std::size_t n, unsigned k, Load load)
+{
+    T acc[norm_lanes<T>] = {};
+    T y[norm_lanes<T>];
+    T r[norm_lanes<T>];
+    std::size_t i = 0;
+    while (i < n)
+    {
+        const std::size_t m = (std::min)(norm_lanes<T>, n - i);
+        if (m == norm_lanes<T>)
+        {
+            for (std::size_t j = 0; j < norm_lanes<T>; ++j)
+            {
+                y[j] = load(i + j);
+            }
+        }
+        else
+        {
+            for (std::size_t j = 0; j < norm_lanes<T>; ++j)
+            {
+                y[j] = j < m ? load(i + j) : T(0);
+            }
+        }
+        for (std::size_t j = 0; j < norm_lanes<T>; ++j)
+        {
+            r[j] = 1;
+        }
+        for (unsigned e = k; e != 0; e >>= 1)
+        {
+            if (e & 1u)
+            {
+                for (std::size_t j = 0; j < norm_lanes<T>; ++j)
+                {
+                    r[j] *= y[j];
+                }
+            }
+            if (e > 1)
+            {
+                for (std::size_t j = 0; j < norm_lanes<T>; ++j)
+                {
+                    y[j] *= y[j];
+                }
+            }
+        }
+        for (std::size_t j = 0; j < m; ++j)
+        {
+            acc[j] += r[j];
+        }
+        i += m;
+    }
+    return sum_lanes(acc);
+}
+
+// Rescaled by the largest element when the sum of powers overflows, or is so
+// small that the powers of the smaller elements may have underflowed:
+template<class T>
+T lp_norm_contiguous(const T* p, std::size_t n, unsigned k)
+{
+    using std::pow;
+    using std::isfinite;
+    using std::isnan;
+    using std::abs;
+    const T sum = lp_sum_contiguous<T>(n, k, [p](std::size_t i) { return abs(p[i]); });
+    const T tiny = (std::numeric_limits<T>::min)()/std::numeric_limits<T>::epsilon();
+    if ((isfinite(sum) && sum >= tiny) || isnan(sum))
+    {
+        return pow(sum, T(1)/T(k));
+    }
+    const T a = sup_norm_contiguous(p, n);
+    if (a == 0 || !isfinite(a))
+    {
+        return a;
+    }
+    return a*pow(lp_sum_contiguous<T>(n, k, [p, a](std::size_t i) { return abs(p[i])/a; }), T(1)/T(k));
+}
+
+template<class T>
+T l1_distance_contiguous(const T* p, const T* q, std::size_t n)
+{
+    using std::abs;
+    T acc[norm_lanes<T>] = {};
+    std::size_t i = 0;
+    for (; i + norm_lanes<T> <= n; i += norm_lanes<T>)
+    {
+        for (std::size_t j = 0; j < norm_lanes<T>; ++j)
+        {
+            acc[j] += abs(p[i + j] - q[i + j]);
+        }
+    }
+    for (std::size_t j = 0; i < n; ++i, ++j)
+    {
+        acc[j] += abs(p[i] - q[i]);
+    }
+    return sum_lanes(acc);
+}
+
+// The differences of neighbours are the distance between the data and itself shifted by one:
+template<class T>
+T total_variation_contiguous(const T* p, std::size_t n)
+{
+    return l1_distance_contiguous(p + 1, p, n - 1);
+}
+
+template<class T>
+T l2_distance_contiguous(const T* p, const T* q, std::size_t n)
+{
+    using std::sqrt;
+    T acc[norm_lanes<T>] = {};
+    std::size_t i = 0;
+    for (; i + norm_lanes<T> <= n; i += norm_lanes<T>)
+    {
+        for (std::size_t j = 0; j < norm_lanes<T>; ++j)
+        {
+            const T d = p[i + j] - q[i + j];
+            acc[j] += d*d;
+        }
+    }
+    for (std::size_t j = 0; i < n; ++i, ++j)
+    {
+        const T d = p[i] - q[i];
+        acc[j] += d*d;
+    }
+    return sqrt(sum_lanes(acc));
+}
+
+template<class T>
+T sup_distance_contiguous(const T* p, const T* q, std::size_t n)
+{
+    using std::abs;
+    T acc[norm_lanes<T>] = {};
+    T sum[norm_lanes<T>] = {};
+    std::size_t i = 0;
+    for (; i + norm_lanes<T> <= n; i += norm_lanes<T>)
+    {
+        for (std::size_t j = 0; j < norm_lanes<T>; ++j)
+        {
+            const T a = abs(p[i + j] - q[i + j]);
+            acc[j] = a > acc[j] ? a : acc[j];
+            sum[j] += a;
+        }
+    }
+    for (std::size_t j = 0; i < n; ++i, ++j)
+    {
+        const T a = abs(p[i] - q[i]);
+        acc[j] = a > acc[j] ? a : acc[j];
+        sum[j] += a;
+    }
+    return max_lanes(acc, sum);
+}
+
+template<class T>
+T lp_distance_contiguous(const T* p, const T* q, std::size_t n, unsigned k)
+{
+    using std::abs;
+    using std::pow;
+    return pow(lp_sum_contiguous<T>(n, k, [p, q](std::size_t i) { return abs(p[i] - q[i]); }), T(1)/T(k));
+}
+
+} // namespace detail
+
 // Mallat, "A Wavelet Tour of Signal Processing", equation 2.60:
 template<class ForwardIterator>
 auto total_variation(ForwardIterator first, ForwardIterator last)
@@ -63,6 +429,10 @@ auto total_variation(ForwardIterator first, ForwardIterator last)
     }
     else
     {
+        if constexpr (detail::is_contiguous_real_iterator<ForwardIterator>::value)
+        {
+            return detail::total_variation_contiguous(std::addressof(*first), static_cast<std::size_t>(std::distance(first, last)));
+        }
         T tmp = *it;
         T tv = 0;
         while (++it != last)
@@ -98,15 +468,17 @@ auto sup_norm(ForwardIterator first, ForwardIterator last)
     }
     else
     {
-        auto pair = std::minmax_element(first, last);
-        if (abs(*pair.first) > abs(*pair.second))
+        if constexpr (detail::is_contiguous_real_iterator<ForwardIterator>::value)
         {
-            return abs(*pair.first);
+            return detail::sup_norm_contiguous(std::addressof(*first), static_cast<std::size_t>(std::distance(first, last)));
         }
-        else
+        auto it = first;
+        T sup = abs(*it);
+        while (++it != last)
         {
-            return abs(*pair.second);
+            sup = detail::nan_propagating_max(T(abs(*it)), sup);
         }
+        return sup;
     }
 }
 
@@ -142,6 +514,13 @@ auto l1_norm(ForwardIterator first, ForwardIterator last)
     }
     else
     {
+        if constexpr (detail::is_contiguous_real_iterator<ForwardIterator>::value)
+        {
+            if (first != last)
+            {
+                return detail::l1_norm_contiguous(std::addressof(*first), static_cast<std::size_t>(std::distance(first, last)));
+            }
+        }
         decltype(abs(*first)) l1 = 0;
         for (auto it = first; it != last; ++it)
         {
@@ -192,6 +571,13 @@ auto l2_norm(ForwardIterator first, ForwardIterator last)
     else if constexpr (is_floating_point<T>::value ||
                        std::numeric_limits<T>::max_exponent)
     {
+        if constexpr (detail::is_contiguous_real_iterator<ForwardIterator>::value)
+        {
+            if (first != last)
+            {
+                return detail::l2_norm_contiguous(std::addressof(*first), static_cast<std::size_t>(std::distance(first, last)));
+            }
+        }
         T l2 = 0;
         for (auto it = first; it != last; ++it)
         {
@@ -311,6 +697,13 @@ auto lp_norm(ForwardIterator first, ForwardIterator last, unsigned p)
     else if constexpr (is_floating_point<RealOrComplex>::value || std::numeric_limits<RealOrComplex>::max_exponent)
     {
         BOOST_MATH_ASSERT_MSG(p >= 0, "For p < 0, the lp norm is not a norm");
+        if constexpr (detail::is_contiguous_real_iterator<ForwardIterator>::value)
+        {
+            if (first != last)
+            {
+                return detail::lp_norm_contiguous(std::addressof(*first), static_cast<std::size_t>(std::distance(first, last)), p);
+            }
+        }
         RealOrComplex lp = 0;
 
         for (auto it = first; it != last; ++it)
@@ -319,9 +712,15 @@ auto lp_norm(ForwardIterator first, ForwardIterator last, unsigned p)
         }
 
         RealOrComplex result = pow(lp, RealOrComplex(1)/RealOrComplex(p));
-        if (!isfinite(result))
+        // Rescale if the sum of powers overflowed, or may have lost the powers of the smaller elements to underflow:
+        const RealOrComplex tiny = (std::numeric_limits<RealOrComplex>::min)()/std::numeric_limits<RealOrComplex>::epsilon();
+        if (!isfinite(result) || lp < tiny)
         {
             RealOrComplex a = boost::math::tools::sup_norm(first, last);
+            if (a == 0 || !isfinite(a))
+            {
+                return a;
+            }
             lp = 0;
             for (auto it = first; it != last; ++it)
             {
@@ -388,6 +787,13 @@ auto lp_distance(ForwardIterator first1, ForwardIterator last1, ForwardIterator
     }
     else if constexpr (is_floating_point<RealOrComplex>::value || std::numeric_limits<RealOrComplex>::max_exponent)
     {
+        if constexpr (detail::is_contiguous_real_iterator<ForwardIterator>::value)
+        {
+            if (first1 != last1)
+            {
+                return detail::lp_distance_contiguous(std::addressof(*first1), std::addressof(*first2), static_cast<std::size_t>(std::distance(first1, last1)), p);
+            }
+        }
         RealOrComplex dist = 0;
         while(it1 != last1)
         {
@@ -439,6 +845,13 @@ auto l1_distance(ForwardIterator first1, ForwardIterator last1, ForwardIterator
     }
     else if constexpr (is_floating_point<T>::value || std::numeric_limits<T>::max_exponent)
     {
+        if constexpr (detail::is_contiguous_real_iterator<ForwardIterator>::value)
+        {
+            if (first1 != last1)
+            {
+                return detail::l1_distance_contiguous(std::addressof(*first1), std::addressof(*first2), static_cast<std::size_t>(std::distance(first1, last1)));
+            }
+        }
         T sum = 0;
         while (it1 != last1)
         {
@@ -513,6 +926,13 @@ auto l2_distance(ForwardIterator first1, ForwardIterator last1, ForwardIterator
     }
     else if constexpr (is_floating_point<T>::value || std::numeric_limits<T>::max_exponent)
     {
+        if constexpr (detail::is_contiguous_real_iterator<ForwardIterator>::value)
+        {
+            if (first1 != last1)
+            {
+                return detail::l2_distance_contiguous(std::addressof(*first1), std::addressof(*first2), static_cast<std::size_t>(std::distance(first1, last1)));
+            }
+        }
         T sum = 0;
         while (it1 != last1)
         {
@@ -589,14 +1009,18 @@ auto sup_distance(ForwardIterator first1, ForwardIterator last1, ForwardIterator
     }
     else if constexpr (is_floating_point<T>::value || std::numeric_limits<T>::max_exponent)
     {
+        if constexpr (detail::is_contiguous_real_iterator<ForwardIterator>::value)
+        {
+            if (first1 != last1)
+            {
+                return detail::sup_distance_contiguous(std::addressof(*first1), std::addressof(*first2), static_cast<std::size_t>(std::distance(first1, last1)));
+            }
+        }
         T sup = 0;
         while (it1 != last1)
         {
             T tmp = *it1++ - *it2++;
-            if (sup < abs(tmp))
-            {
-                sup = abs(tmp);
-            }
+            sup = detail::nan_propagating_max(T(abs(tmp)), sup);
         }
         return sup;
     }
@@ -322,6 +322,94 @@ inline V evaluate_rational(const std::array<T,N>& a, const std::array<U,N>& b, c
    return detail::evaluate_rational_c_imp(a.data(), b.data(), z, static_cast<std::integral_constant<int, N>*>(nullptr));
 }
 
+//
+// Evaluation at M points at once.  These apply the same coefficients to every
+// element of an array of arguments, looping over the coefficients on the outside
+// so that each coefficient is loaded once per step and the inner loops over the
+// lanes are independent of each other and may be vectorised by the compiler.
+// Plain Horner's rule is used since the lanes already provide all the
+// instruction level parallelism we need, so results may differ from the
+// scalar versions above by rounding error:
+//
+template <class T, class V, std::size_t M>
+inline std::array<V, M> evaluate_polynomial(const T* poly, const std::array<V, M>& z, std::size_t count) BOOST_MATH_NOEXCEPT(V)
+{
+   BOOST_MATH_ASSERT(count > 0);
+   std::array<V, M> sum;
+   for(std::size_t j = 0; j < M; ++j)
+      sum[j] = static_cast<V>(poly[count - 1]);
+   for(int i = static_cast<int>(count) - 2; i >= 0; --i)
+   {
+      const V c = static_cast<V>(poly[i]);
+      for(std::size_t j = 0; j < M; ++j)
+      {
+         sum[j] *= z[j];
+         sum[j] += c;
+      }
+   }
+   return sum;
+}
+
+template <std::size_t N, class T, class V, std::size_t M>
+inline std::array<V, M> evaluate_polynomial(const T(&a)[N], const std::array<V, M>& z) BOOST_MATH_NOEXCEPT(V)
+{
+   return evaluate_polynomial(static_cast<const T*>(a), z, N);
+}
+
+template <std::size_t N, class T, class V, std::size_t M>
+inline std::array<V, M> evaluate_polynomial(const std::array<T,N>& a, const std::array<V, M>& z) BOOST_MATH_NOEXCEPT(V)
+{
+   return evaluate_polynomial(a.data(), z, N);
+}
+//
+// The rational versions use the same z <= 1 / z > 1 split as the scalar code,
+// but rather than branching, each lane selects which end of the coefficient
+// tables to start from:
+//
+template <class T, class U, class V, std::size_t M>
+std::array<V, M> evaluate_rational(const T* num, const U* denom, const std::array<V, M>& z_, std::size_t count) BOOST_MATH_NOEXCEPT(V)
+{
+   BOOST_MATH_ASSERT(count > 0);
+   std::array<V, M> z, s1, s2;
+   bool inverted[M];
+   for(std::size_t j = 0; j < M; ++j)
+   {
+      inverted[j] = !(z_[j] <= 1);
+      z[j] = inverted[j] ? V(1 / z_[j]) : z_[j];
+      s1[j] = static_cast<V>(inverted[j] ? num[0] : num[count - 1]);
+      s2[j] = static_cast<V>(inverted[j] ? denom[0] : denom[count - 1]);
+   }
+   for(std::size_t i = 1; i < count; ++i)
+   {
+      const V n_lo = static_cast<V>(num[count - 1 - i]);
+      const V n_hi = static_cast<V>(num[i]);
+      const V d_lo = static_cast<V>(denom[count - 1 - i]);
+      const V d_hi = static_cast<V>(denom[i]);
+      for(std::size_t j = 0; j < M; ++j)
+      {
+         s1[j] *= z[j];
+         s2[j] *= z[j];
+         s1[j] += inverted[j] ? n_hi : n_lo;
+         s2[j] += inverted[j] ? d_hi : d_lo;
+      }
+   }
+   for(std::size_t j = 0; j < M; ++j)
+      s1[j] /= s2[j];
+   return s1;
+}
+
+template <std::size_t N, class T, class U, class V, std::size_t M>
+inline std::array<V, M> evaluate_rational(const T(&a)[N], const U(&b)[N], const std::array<V, M>& z) BOOST_MATH_NOEXCEPT(V)
+{
+   return evaluate_rational(static_cast<const T*>(a), static_cast<const U*>(b), z, N);
+}
+
+template <std::size_t N, class T, class U, class V, std::size_t M>
+inline std::array<V, M> evaluate_rational(const std::array<T,N>& a, const std::array<U,N>& b, const std::array<V, M>& z) BOOST_MATH_NOEXCEPT(V)
+{
+   return evaluate_rational(a.data(), b.data(), z, N);
+}
+
 } // namespace tools
 } // namespace math
 } // namespace boost
@@ -0,0 +1,255 @@
+//  Copyright Boost.Math contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_TOOLS_THREAD_POOL_HPP
+#define BOOST_MATH_TOOLS_THREAD_POOL_HPP
+
+#include <boost/math/tools/config.hpp>
+
+#ifndef BOOST_HAS_THREADS
+#error "boost/math/tools/thread_pool.hpp requires thread support."
+#endif
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace boost { namespace math { namespace tools {
+
+// A fixed size pool of worker threads which may be shared between calls to
+// the parallel algorithms in the library, so that the cost of creating
+// threads is paid once rather than on every call.
+//
+// Each worker owns a queue: it takes work from the back of its own queue,
+// and when that is empty steals from the front of the others.  A thread
+// waiting in bulk_execute runs queued tasks itself until its own work is
+// complete, so bulk_execute may safely be called from inside a task.
+class thread_pool
+{
+public:
+    // A thread count of zero uses one thread per hardware thread:
+    explicit thread_pool(unsigned threads = 0)
+    {
+        if (threads == 0)
+        {
+            threads = std::thread::hardware_concurrency() == 0 ? 2u : std::thread::hardware_concurrency();
+        }
+        for (unsigned i = 0; i < threads; ++i)
+        {
+            queues_.emplace_back(new queue_type);
+        }
+        workers_.reserve(threads);
+        try
+        {
+            for (unsigned i = 0; i < threads; ++i)
+            {
+                workers_.emplace_back([this, i]() { worker_loop(i); });
+            }
+        }
+        catch (...)
+        {
+            // The destructor will not run, so the workers already started must be joined here:
+            stop_workers();
+            throw;
+        }
+    }
+
+    thread_pool(const thread_pool&) = delete;
+    thread_pool& operator=(const thread_pool&) = delete;
+
+    // Runs any tasks which are still queued, then joins the workers:
+    ~thread_pool()
+    {
+        stop_workers();
+    }
+
+    unsigned concurrency() const noexcept
+    {
+        return static_cast<unsigned>(workers_.size());
+    }
+
+    // Queues f() and returns a future for its result.  Waiting on that future
+    // from inside a task of the same pool may deadlock, use bulk_execute there.
+    template <typename F>
+    auto submit(F&& f) const -> std::future<decltype(std::declval<typename std::decay<F>::type&>()())>
+    {
+        using result_type = decltype(std::declval<typename std::decay<F>::type&>()());
+        auto task = std::make_shared<std::packaged_task<result_type()>>(std::forward<F>(f));
+        std::future<result_type> result = task->get_future();
+        push(next_queue_++ % queues_.size(), [task]() { (*task)(); });
+        return result;
+    }
+
+    // Calls f(i) for each i in [0, n) and returns once all the calls have
+    // completed.  The first exception thrown by any call is rethrown here.
+    // The queues are synchronised internally, so work may be submitted
+    // through a const reference to the pool.
+    template <typename F>
+    void bulk_execute(std::size_t n, F&& f) const
+    {
+        if (n == 0)
+        {
+            return;
+        }
+        bulk_state state;
+        state.remaining = n;
+        const std::size_t start = next_queue_.fetch_add(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            push((start + i) % queues_.size(), [&f, &state, i]()
+            {
+                try
+                {
+                    f(i);
+                }
+                catch (...)
+                {
+                    std::lock_guard<std::mutex> lock(state.mutex);
+                    if (!state.error)
+                    {
+                        state.error = std::current_exception();
+                    }
+                }
+                // Decrement under the lock: the waiting thread may destroy
+                // state as soon as it sees remaining == 0.
+                std::lock_guard<std::mutex> lock(state.mutex);
+                if (--state.remaining == 0)
+                {
+                    state.cv.notify_all();
+                }
+            });
+        }
+        // Help out until nothing is left to steal, then wait for the tasks
+        // which other threads are still running:
+        task_type task;
+        while (try_pop(start % queues_.size(), task))
+        {
+            task();
+            task = nullptr;
+        }
+        std::unique_lock<std::mutex> lock(state.mutex);
+        state.cv.wait(lock, [&state]() { return state.remaining == 0; });
+        if (state.error)
+        {
+            std::rethrow_exception(state.error);
+        }
+    }
+
+private:
+    using task_type = std::function<void()>;
+
+    struct queue_type
+    {
+        std::mutex mutex;
+        std::deque<task_type> tasks;
+    };
+
+    struct bulk_state
+    {
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::size_t remaining;
+        std::exception_ptr error;
+    };
+
+    void push(std::size_t index, task_type task) const
+    {
+        {
+            // Counted first, and under the pool lock, so that pending_ never
+            // underestimates the queued tasks and a worker about to sleep can
+            // not miss one:
+            std::lock_guard<std::mutex> lock(mutex_);
+            ++pending_;
+        }
+        {
+            std::lock_guard<std::mutex> lock(queues_[index]->mutex);
+            queues_[index]->tasks.push_back(std::move(task));
+        }
+        cv_.notify_one();
+    }
+
+    // Pops from the back of queue index, or steals from the front of another:
+    bool try_pop(std::size_t index, task_type& task) const
+    {
+        const std::size_t n = queues_.size();
+        for (std::size_t k = 0; k < n; ++k)
+        {
+            queue_type& q = *queues_[(index + k) % n];
+            std::lock_guard<std::mutex> lock(q.mutex);
+            if (!q.tasks.empty())
+            {
+                if (k == 0)
+                {
+                    task = std::move(q.tasks.back());
+                    q.tasks.pop_back();
+                }
+                else
+                {
+                    task = std::move(q.tasks.front());
+                    q.tasks.pop_front();
+                }
+                --pending_;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Runs any tasks which are still queued, then joins the workers:
+    void stop_workers()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        cv_.notify_all();
+        for (auto& t : workers_)
+        {
+            t.join();
+        }
+    }
+
+    void worker_loop(std::size_t index)
+    {
+        task_type task;
+        for (;;)
+        {
+            if (try_pop(index, task))
+            {
+                task();
+                task = nullptr;
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [this]() { return stop_ || pending_ > 0; });
+            if (stop_ && pending_ == 0)
+            {
+                return;
+            }
+        }
+    }
+
+    std::vector<std::unique_ptr<queue_type>> queues_;
+    std::vector<std::thread> workers_;
+    mutable std::mutex mutex_;
+    mutable std::condition_variable cv_;
+    mutable std::atomic<std::size_t> pending_ {0};
+    mutable std::atomic<std::size_t> next_queue_ {0};
+    bool stop_ = false;
+};
+
+}}} // namespace boost::math::tools
+
+#endif // BOOST_MATH_TOOLS_THREAD_POOL_HPP
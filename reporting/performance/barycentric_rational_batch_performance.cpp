@@ -0,0 +1,110 @@
+//  Copyright Boost.Math contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//
+// Compares evaluating barycentric_rational one abscissa at a time with evaluating it over a range
+// of abscissas, which reuses each node for a block of abscissas, and with splitting the range between
+// the threads of a thread_pool.  The argument is the number of nodes.
+//
+#include <cstddef>
+#include <random>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <boost/math/interpolators/barycentric_rational.hpp>
+#include <boost/math/tools/thread_pool.hpp>
+
+using boost::math::interpolators::barycentric_rational;
+
+constexpr std::size_t queries = 100000;
+
+template<class Real>
+barycentric_rational<Real> interpolant(std::size_t n)
+{
+    std::mt19937_64 gen(12345);
+    std::uniform_real_distribution<Real> dis(Real(0.1), Real(1));
+    std::vector<Real> x(n);
+    std::vector<Real> y(n);
+    x[0] = 0;
+    y[0] = dis(gen);
+    for (std::size_t i = 1; i < n; ++i)
+    {
+        x[i] = x[i-1] + dis(gen);
+        y[i] = dis(gen);
+    }
+    return barycentric_rational<Real>(std::move(x), std::move(y));
+}
+
+template<class Real>
+std::vector<Real> abscissas(Real b)
+{
+    std::mt19937_64 gen(54321);
+    std::uniform_real_distribution<Real> dis(0, b);
+    std::vector<Real> t(queries);
+    for (auto & ti : t)
+    {
+        ti = dis(gen);
+    }
+    return t;
+}
+
+template<class Real>
+void scalar_evaluation(benchmark::State& state)
+{
+    auto n = static_cast<std::size_t>(state.range(0));
+    auto f = interpolant<Real>(n);
+    std::vector<Real> t = abscissas(Real(n)/4);
+    std::vector<Real> v(t.size());
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < t.size(); ++i)
+        {
+            v[i] = f(t[i]);
+        }
+        benchmark::DoNotOptimize(v.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations()*t.size()*n);
+}
+
+template<class Real>
+void batch_evaluation(benchmark::State& state)
+{
+    auto n = static_cast<std::size_t>(state.range(0));
+    auto f = interpolant<Real>(n);
+    std::vector<Real> t = abscissas(Real(n)/4);
+    std::vector<Real> v(t.size());
+    for (auto _ : state)
+    {
+        f(t.begin(), t.end(), v.begin());
+        benchmark::DoNotOptimize(v.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations()*t.size()*n);
+}
+
+template<class Real>
+void thread_pool_evaluation(benchmark::State& state)
+{
+    auto n = static_cast<std::size_t>(state.range(0));
+    auto f = interpolant<Real>(n);
+    std::vector<Real> t = abscissas(Real(n)/4);
+    std::vector<Real> v(t.size());
+    boost::math::tools::thread_pool pool;
+    for (auto _ : state)
+    {
+        f(pool, t.begin(), t.end(), v.begin());
+        benchmark::DoNotOptimize(v.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations()*t.size()*n);
+}
+
+BENCHMARK_TEMPLATE(scalar_evaluation, double)->RangeMultiplier(10)->Range(100, 10000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(batch_evaluation, double)->RangeMultiplier(10)->Range(100, 10000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(thread_pool_evaluation, double)->RangeMultiplier(10)->Range(100, 10000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(scalar_evaluation, float)->Arg(10000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(batch_evaluation, float)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,86 @@
+//  Copyright Boost.Math contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//
+// Compares constructing a cardinal_cubic_b_spline from a pair of iterators, which copies the samples,
+// with constructing it from a vector of samples which it overwrites with the coefficients, and with
+// solving the linear system in blocks on a thread pool.  The argument is the number of samples.
+//
+#include <cmath>
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <boost/math/interpolators/cardinal_cubic_b_spline.hpp>
+#include <boost/math/tools/thread_pool.hpp>
+
+using boost::math::interpolators::cardinal_cubic_b_spline;
+
+template<class Real>
+std::vector<Real> samples(std::size_t n)
+{
+    using std::sin;
+    std::vector<Real> v;
+    // Room for the two extra coefficients, so that the in place constructors do not reallocate:
+    v.reserve(n + 2);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        v.push_back(sin(Real(i)/1000));
+    }
+    return v;
+}
+
+template<class Real>
+void iterator_construction(benchmark::State& state)
+{
+    std::vector<Real> v = samples<Real>(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        cardinal_cubic_b_spline<Real> s(v.begin(), v.end(), Real(0), Real(1)/1000);
+        benchmark::DoNotOptimize(s(Real(1)));
+    }
+    state.SetItemsProcessed(state.iterations()*v.size());
+}
+
+template<class Real>
+void in_place_construction(benchmark::State& state)
+{
+    std::vector<Real> v = samples<Real>(static_cast<std::size_t>(state.range(0)));
+    const std::size_t n = v.size();
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        std::vector<Real> w = samples<Real>(n);
+        state.ResumeTiming();
+        cardinal_cubic_b_spline<Real> s(std::move(w), Real(0), Real(1)/1000);
+        benchmark::DoNotOptimize(s(Real(1)));
+    }
+    state.SetItemsProcessed(state.iterations()*n);
+}
+
+template<class Real>
+void parallel_construction(benchmark::State& state)
+{
+    std::vector<Real> v = samples<Real>(static_cast<std::size_t>(state.range(0)));
+    const std::size_t n = v.size();
+    boost::math::tools::thread_pool pool;
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        std::vector<Real> w = samples<Real>(n);
+        state.ResumeTiming();
+        cardinal_cubic_b_spline<Real> s(pool, std::move(w), Real(0), Real(1)/1000);
+        benchmark::DoNotOptimize(s(Real(1)));
+    }
+    state.SetItemsProcessed(state.iterations()*n);
+}
+
+BENCHMARK_TEMPLATE(iterator_construction, double)->RangeMultiplier(16)->Range(1<<10, 1<<26)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(in_place_construction, double)->RangeMultiplier(16)->Range(1<<10, 1<<26)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(parallel_construction, double)->RangeMultiplier(16)->Range(1<<10, 1<<26)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(iterator_construction, float)->RangeMultiplier(16)->Range(1<<10, 1<<26)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(parallel_construction, float)->RangeMultiplier(16)->Range(1<<10, 1<<26)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,108 @@
+//  Copyright Boost.Math contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//
+// Compares evaluating pchip and makima one abscissa at a time, which locates each abscissa with a
+// binary search over all the knots, with evaluating them over a range of abscissas, which searches
+// outwards from the interval of the previous abscissa.  The first argument is the number of knots,
+// and the abscissas are either sorted or in random order.
+//
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <utility>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <boost/math/interpolators/pchip.hpp>
+#include <boost/math/interpolators/makima.hpp>
+
+using boost::math::interpolators::pchip;
+using boost::math::interpolators::makima;
+
+constexpr std::size_t queries = 1000000;
+
+template<class Real>
+std::pair<std::vector<Real>, std::vector<Real>> knots(std::size_t n)
+{
+    std::mt19937_64 gen(12345);
+    std::uniform_real_distribution<Real> dis(Real(0.1), Real(1));
+    std::vector<Real> x(n);
+    std::vector<Real> y(n);
+    x[0] = 0;
+    y[0] = dis(gen);
+    for (std::size_t i = 1; i < n; ++i)
+    {
+        x[i] = x[i-1] + dis(gen);
+        y[i] = y[i-1] + dis(gen) - Real(0.55);
+    }
+    return {std::move(x), std::move(y)};
+}
+
+template<class Real>
+std::vector<Real> abscissas(Real a, Real b, bool sorted)
+{
+    std::mt19937_64 gen(54321);
+    std::uniform_real_distribution<Real> dis(a, b);
+    std::vector<Real> t(queries);
+    for (auto & ti : t)
+    {
+        ti = dis(gen);
+    }
+    if (sorted)
+    {
+        std::sort(t.begin(), t.end());
+    }
+    return t;
+}
+
+template<template<class> class Interpolator, class Real, bool Sorted>
+void scalar_evaluation(benchmark::State& state)
+{
+    auto data = knots<Real>(static_cast<std::size_t>(state.range(0)));
+    Real a = data.first.front();
+    Real b = data.first.back();
+    Interpolator<std::vector<Real>> f(std::move(data.first), std::move(data.second));
+    std::vector<Real> t = abscissas(a, b, Sorted);
+    std::vector<Real> v(t.size());
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < t.size(); ++i)
+        {
+            v[i] = f(t[i]);
+        }
+        benchmark::DoNotOptimize(v.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations()*t.size());
+}
+
+template<template<class> class Interpolator, class Real, bool Sorted>
+void batch_evaluation(benchmark::State& state)
+{
+    auto data = knots<Real>(static_cast<std::size_t>(state.range(0)));
+    Real a = data.first.front();
+    Real b = data.first.back();
+    Interpolator<std::vector<Real>> f(std::move(data.first), std::move(data.second));
+    std::vector<Real> t = abscissas(a, b, Sorted);
+    std::vector<Real> v(t.size());
+    for (auto _ : state)
+    {
+        f(t.begin(), t.end(), v.begin());
+        benchmark::DoNotOptimize(v.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations()*t.size());
+}
+
+BENCHMARK_TEMPLATE(scalar_evaluation, pchip, double, true)->RangeMultiplier(16)->Range(64, 1<<20);
+BENCHMARK_TEMPLATE(batch_evaluation, pchip, double, true)->RangeMultiplier(16)->Range(64, 1<<20);
+BENCHMARK_TEMPLATE(scalar_evaluation, pchip, double, false)->RangeMultiplier(16)->Range(64, 1<<20);
+BENCHMARK_TEMPLATE(batch_evaluation, pchip, double, false)->RangeMultiplier(16)->Range(64, 1<<20);
+BENCHMARK_TEMPLATE(scalar_evaluation, makima, double, true)->RangeMultiplier(16)->Range(64, 1<<20);
+BENCHMARK_TEMPLATE(batch_evaluation, makima, double, true)->RangeMultiplier(16)->Range(64, 1<<20);
+BENCHMARK_TEMPLATE(scalar_evaluation, pchip, float, true)->RangeMultiplier(16)->Range(64, 1<<20);
+BENCHMARK_TEMPLATE(batch_evaluation, pchip, float, true)->RangeMultiplier(16)->Range(64, 1<<20);
+
+BENCHMARK_MAIN();
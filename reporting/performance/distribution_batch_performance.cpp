@@ -0,0 +1,83 @@
+//  Copyright Boost.Math contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//
+// Compares evaluating the pdf of a distribution at many points one at a
+// time, with the array-at-a-time overload which checks the parameters and
+// calculates the parameter-only terms once for the whole range.
+//
+#include <random>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <boost/math/distributions/normal.hpp>
+#include <boost/math/distributions/gamma.hpp>
+#include <boost/math/distributions/beta.hpp>
+#include <boost/math/distributions/students_t.hpp>
+
+template <class Real>
+std::vector<Real> arguments(double lower, double upper)
+{
+   std::mt19937_64 mt(12345);
+   std::uniform_real_distribution<Real> unif(static_cast<Real>(lower), static_cast<Real>(upper));
+   std::vector<Real> x(1024);
+   for (auto& v : x)
+   {
+      v = unif(mt);
+   }
+   return x;
+}
+
+template <class Dist>
+void scalar_pdf(benchmark::State& state, const Dist& dist, double lower, double upper)
+{
+   using Real = typename Dist::value_type;
+   std::vector<Real> x = arguments<Real>(lower, upper);
+   std::vector<Real> y(x.size());
+   for (auto _ : state)
+   {
+      for (std::size_t i = 0; i < x.size(); ++i)
+      {
+         y[i] = pdf(dist, x[i]);
+      }
+      benchmark::DoNotOptimize(y.data());
+   }
+   state.SetItemsProcessed(state.iterations() * x.size());
+}
+
+template <class Dist>
+void batch_pdf(benchmark::State& state, const Dist& dist, double lower, double upper)
+{
+   using Real = typename Dist::value_type;
+   std::vector<Real> x = arguments<Real>(lower, upper);
+   std::vector<Real> y(x.size());
+   for (auto _ : state)
+   {
+      pdf(dist, x.begin(), x.end(), y.begin());
+      benchmark::DoNotOptimize(y.data());
+   }
+   state.SetItemsProcessed(state.iterations() * x.size());
+}
+
+template <class Real> void Normal(benchmark::State& state) { scalar_pdf(state, boost::math::normal_distribution<Real>(Real(1), Real(3)), -10, 10); }
+template <class Real> void NormalBatch(benchmark::State& state) { batch_pdf(state, boost::math::normal_distribution<Real>(Real(1), Real(3)), -10, 10); }
+template <class Real> void Gamma(benchmark::State& state) { scalar_pdf(state, boost::math::gamma_distribution<Real>(Real(7.5), Real(2)), 0.5, 40); }
+template <class Real> void GammaBatch(benchmark::State& state) { batch_pdf(state, boost::math::gamma_distribution<Real>(Real(7.5), Real(2)), 0.5, 40); }
+template <class Real> void Beta(benchmark::State& state) { scalar_pdf(state, boost::math::beta_distribution<Real>(Real(3.5), Real(12)), 0.01, 0.99); }
+template <class Real> void BetaBatch(benchmark::State& state) { batch_pdf(state, boost::math::beta_distribution<Real>(Real(3.5), Real(12)), 0.01, 0.99); }
+template <class Real> void StudentsT(benchmark::State& state) { scalar_pdf(state, boost::math::students_t_distribution<Real>(Real(4.5)), -10, 10); }
+template <class Real> void StudentsTBatch(benchmark::State& state) { batch_pdf(state, boost::math::students_t_distribution<Real>(Real(4.5)), -10, 10); }
+
+BENCHMARK_TEMPLATE(Normal, double);
+BENCHMARK_TEMPLATE(NormalBatch, double);
+BENCHMARK_TEMPLATE(Gamma, double);
+BENCHMARK_TEMPLATE(GammaBatch, double);
+BENCHMARK_TEMPLATE(Beta, double);
+BENCHMARK_TEMPLATE(BetaBatch, double);
+BENCHMARK_TEMPLATE(StudentsT, double);
+BENCHMARK_TEMPLATE(StudentsTBatch, double);
+BENCHMARK_TEMPLATE(Gamma, float);
+BENCHMARK_TEMPLATE(GammaBatch, float);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,95 @@
+//  Copyright Boost.Math contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//
+// Compares evaluating the pdf of a distribution with fixed parameters at
+// many points, with and without first freezing the distribution.
+//
+#include <random>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <boost/math/distributions/frozen.hpp>
+
+using boost::math::freeze;
+
+template <class Dist>
+void pdf_performance(benchmark::State& state, const Dist& dist, double lower, double upper)
+{
+   using Real = typename Dist::value_type;
+   std::mt19937_64 mt(12345);
+   std::uniform_real_distribution<Real> unif(static_cast<Real>(lower), static_cast<Real>(upper));
+   std::vector<Real> x(1024);
+   for (auto& v : x)
+   {
+      v = unif(mt);
+   }
+   for (auto _ : state)
+   {
+      for (Real v : x)
+      {
+         benchmark::DoNotOptimize(pdf(dist, v));
+      }
+   }
+   state.SetItemsProcessed(state.iterations() * x.size());
+}
+
+template <class Real>
+void Gamma(benchmark::State& state)
+{
+   pdf_performance(state, boost::math::gamma_distribution<Real>(Real(7.5), Real(2)), 0.5, 40);
+}
+template <class Real>
+void GammaFrozen(benchmark::State& state)
+{
+   pdf_performance(state, freeze(boost::math::gamma_distribution<Real>(Real(7.5), Real(2))), 0.5, 40);
+}
+
+template <class Real>
+void Beta(benchmark::State& state)
+{
+   pdf_performance(state, boost::math::beta_distribution<Real>(Real(3.5), Real(12)), 0.01, 0.99);
+}
+template <class Real>
+void BetaFrozen(benchmark::State& state)
+{
+   pdf_performance(state, freeze(boost::math::beta_distribution<Real>(Real(3.5), Real(12))), 0.01, 0.99);
+}
+
+template <class Real>
+void StudentsT(benchmark::State& state)
+{
+   pdf_performance(state, boost::math::students_t_distribution<Real>(Real(5.5)), -10, 10);
+}
+template <class Real>
+void StudentsTFrozen(benchmark::State& state)
+{
+   pdf_performance(state, freeze(boost::math::students_t_distribution<Real>(Real(5.5))), -10, 10);
+}
+
+template <class Real>
+void NonCentralChiSquared(benchmark::State& state)
+{
+   pdf_performance(state, boost::math::non_central_chi_squared_distribution<Real>(Real(4), Real(120)), 60, 200);
+}
+template <class Real>
+void NonCentralChiSquaredFrozen(benchmark::State& state)
+{
+   pdf_performance(state, freeze(boost::math::non_central_chi_squared_distribution<Real>(Real(4), Real(120))), 60, 200);
+}
+
+BENCHMARK_TEMPLATE(Gamma, double);
+BENCHMARK_TEMPLATE(GammaFrozen, double);
+BENCHMARK_TEMPLATE(Beta, double);
+BENCHMARK_TEMPLATE(BetaFrozen, double);
+BENCHMARK_TEMPLATE(StudentsT, double);
+BENCHMARK_TEMPLATE(StudentsTFrozen, double);
+BENCHMARK_TEMPLATE(NonCentralChiSquared, double);
+BENCHMARK_TEMPLATE(NonCentralChiSquaredFrozen, double);
+BENCHMARK_TEMPLATE(Gamma, long double);
+BENCHMARK_TEMPLATE(GammaFrozen, long double);
+BENCHMARK_TEMPLATE(StudentsT, long double);
+BENCHMARK_TEMPLATE(StudentsTFrozen, long double);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,104 @@
+//  Copyright Boost.Math contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//
+// Compares Gauss and Gauss-Kronrod quadrature of a scalar integrand with the
+// same integrand in batch form, which is evaluated at all the nodes of a rule
+// in one call, in a loop the compiler can vectorize.  Build with e.g. -O3 -march=native.
+//
+#include <cstddef>
+#include <benchmark/benchmark.h>
+#include <boost/math/quadrature/gauss.hpp>
+#include <boost/math/quadrature/gauss_kronrod.hpp>
+
+using boost::math::quadrature::gauss;
+using boost::math::quadrature::gauss_kronrod;
+
+template<class Real>
+Real integrand(Real x)
+{
+    return (1 + x*(Real(0.5) + x*Real(0.25)))/(1 + x*x*(Real(3) + x*x));
+}
+
+template<class Real>
+struct scalar_integrand
+{
+    Real operator()(Real x) const
+    {
+        return integrand(x);
+    }
+};
+
+template<class Real>
+struct batch_integrand
+{
+    void operator()(const Real* x, Real* y, std::size_t n) const
+    {
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            y[i] = integrand(x[i]);
+        }
+    }
+};
+
+template<class Real, unsigned Points, class F>
+void gauss_rule(benchmark::State& state)
+{
+    Real a = 0;
+    Real b = 1;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(a);
+        benchmark::DoNotOptimize(b);
+        benchmark::DoNotOptimize(gauss<Real, Points>::integrate(F(), a, b));
+        benchmark::ClobberMemory();
+    }
+}
+
+template<class Real, unsigned Points, class F>
+void gauss_kronrod_rule(benchmark::State& state)
+{
+    Real a = 0;
+    Real b = 1;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(a);
+        benchmark::DoNotOptimize(b);
+        benchmark::DoNotOptimize(gauss_kronrod<Real, Points>::integrate(F(), a, b, 0));
+        benchmark::ClobberMemory();
+    }
+}
+
+// Adaptive integration, with subdivision down to intervals of width 2^-depth:
+template<class Real, unsigned Points, class F>
+void gauss_kronrod_adaptive(benchmark::State& state)
+{
+    Real a = 0;
+    Real b = 1;
+    const unsigned depth = static_cast<unsigned>(state.range(0));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(a);
+        benchmark::DoNotOptimize(b);
+        benchmark::DoNotOptimize(gauss_kronrod<Real, Points>::integrate(F(), a, b, depth, Real(0)));
+        benchmark::ClobberMemory();
+    }
+}
+
+#define BOOST_MATH_GAUSS_REGISTER(Real, Points)                                                                                          \
+BENCHMARK_TEMPLATE(gauss_rule, Real, (Points - 1)/2, scalar_integrand<Real>);                                                           \
+BENCHMARK_TEMPLATE(gauss_rule, Real, (Points - 1)/2, batch_integrand<Real>);                                                            \
+BENCHMARK_TEMPLATE(gauss_kronrod_rule, Real, Points, scalar_integrand<Real>);                                                           \
+BENCHMARK_TEMPLATE(gauss_kronrod_rule, Real, Points, batch_integrand<Real>);                                                            \
+BENCHMARK_TEMPLATE(gauss_kronrod_adaptive, Real, Points, scalar_integrand<Real>)->DenseRange(2, 8, 3);                                   \
+BENCHMARK_TEMPLATE(gauss_kronrod_adaptive, Real, Points, batch_integrand<Real>)->DenseRange(2, 8, 3);
+
+BOOST_MATH_GAUSS_REGISTER(float, 15)
+BOOST_MATH_GAUSS_REGISTER(double, 15)
+BOOST_MATH_GAUSS_REGISTER(double, 21)
+BOOST_MATH_GAUSS_REGISTER(double, 31)
+BOOST_MATH_GAUSS_REGISTER(double, 61)
+
+BENCHMARK_MAIN();
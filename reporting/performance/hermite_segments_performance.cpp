@@ -0,0 +1,113 @@
+//  Copyright Boost.Math contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//
+// Compares the Hermite interpolators, which keep the ordinates and each derivative in its own array,
+// with the same interpolants stored as the coefficients of a polynomial for each interval.
+// The first argument is the number of knots, and the abscissas are in random order.
+//
+#include <cstddef>
+#include <random>
+#include <utility>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <boost/math/interpolators/cubic_hermite.hpp>
+#include <boost/math/interpolators/quintic_hermite.hpp>
+#include <boost/math/interpolators/septic_hermite.hpp>
+
+using boost::math::interpolators::cubic_hermite;
+using boost::math::interpolators::cubic_hermite_segments;
+using boost::math::interpolators::quintic_hermite;
+using boost::math::interpolators::quintic_hermite_segments;
+using boost::math::interpolators::septic_hermite;
+using boost::math::interpolators::septic_hermite_segments;
+
+constexpr std::size_t queries = 1000000;
+
+template<class Real>
+std::vector<std::vector<Real>> knots(std::size_t n, std::size_t derivatives)
+{
+    std::mt19937_64 gen(12345);
+    std::uniform_real_distribution<Real> dis(Real(0.1), Real(1));
+    std::vector<std::vector<Real>> data(derivatives + 2, std::vector<Real>(n));
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        data[0][i] = i > 0 ? data[0][i-1] + dis(gen) : 0;
+        for (std::size_t k = 1; k < data.size(); ++k)
+        {
+            data[k][i] = dis(gen);
+        }
+    }
+    return data;
+}
+
+template<class Real>
+std::vector<Real> abscissas(Real a, Real b)
+{
+    std::mt19937_64 gen(54321);
+    std::uniform_real_distribution<Real> dis(a, b);
+    std::vector<Real> t(queries);
+    for (auto & ti : t)
+    {
+        ti = dis(gen);
+    }
+    return t;
+}
+
+template<class Interpolator, class Real>
+void evaluate(benchmark::State& state, const Interpolator& f, Real a, Real b)
+{
+    std::vector<Real> t = abscissas(a, b);
+    Real sum = 0;
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < t.size(); ++i)
+        {
+            sum += f(t[i]);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations()*t.size());
+    state.counters["bytes"] = static_cast<double>(f.bytes());
+}
+
+template<template<class> class Interpolator, class Real>
+void cubic(benchmark::State& state)
+{
+    auto d = knots<Real>(static_cast<std::size_t>(state.range(0)), 1);
+    Real a = d[0].front();
+    Real b = d[0].back();
+    Interpolator<std::vector<Real>> f(std::move(d[0]), std::move(d[1]), std::move(d[2]));
+    evaluate(state, f, a, b);
+}
+
+template<template<class> class Interpolator, class Real>
+void quintic(benchmark::State& state)
+{
+    auto d = knots<Real>(static_cast<std::size_t>(state.range(0)), 2);
+    Real a = d[0].front();
+    Real b = d[0].back();
+    Interpolator<std::vector<Real>> f(std::move(d[0]), std::move(d[1]), std::move(d[2]), std::move(d[3]));
+    evaluate(state, f, a, b);
+}
+
+template<template<class> class Interpolator, class Real>
+void septic(benchmark::State& state)
+{
+    auto d = knots<Real>(static_cast<std::size_t>(state.range(0)), 3);
+    Real a = d[0].front();
+    Real b = d[0].back();
+    Interpolator<std::vector<Real>> f(std::move(d[0]), std::move(d[1]), std::move(d[2]), std::move(d[3]), std::move(d[4]));
+    evaluate(state, f, a, b);
+}
+
+BENCHMARK_TEMPLATE(cubic, cubic_hermite, double)->RangeMultiplier(16)->Range(64, 1<<22);
+BENCHMARK_TEMPLATE(cubic, cubic_hermite_segments, double)->RangeMultiplier(16)->Range(64, 1<<22);
+BENCHMARK_TEMPLATE(quintic, quintic_hermite, double)->RangeMultiplier(16)->Range(64, 1<<22);
+BENCHMARK_TEMPLATE(quintic, quintic_hermite_segments, double)->RangeMultiplier(16)->Range(64, 1<<22);
+BENCHMARK_TEMPLATE(septic, septic_hermite, double)->RangeMultiplier(16)->Range(64, 1<<22);
+BENCHMARK_TEMPLATE(septic, septic_hermite_segments, double)->RangeMultiplier(16)->Range(64, 1<<22);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,141 @@
+//  Copyright Boost.Math contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//
+// Compares generating random variates by inversion using the quantile of
+// the distribution directly, and using an inverse_cdf_table.
+//
+#include <random>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <boost/math/distributions/inverse_cdf_table.hpp>
+#include <boost/math/distributions/students_t.hpp>
+#include <boost/math/distributions/non_central_t.hpp>
+#include <boost/math/distributions/beta.hpp>
+#include <boost/math/distributions/gamma.hpp>
+
+using boost::math::inverse_cdf_table;
+
+template <class Real>
+std::vector<Real> uniforms()
+{
+   std::mt19937_64 mt(12345);
+   std::uniform_real_distribution<Real> unif(0, 1);
+   std::vector<Real> u(1024);
+   for (auto& v : u)
+   {
+      v = unif(mt);
+   }
+   return u;
+}
+
+template <class Dist>
+void quantile_performance(benchmark::State& state, const Dist& dist)
+{
+   using Real = typename Dist::value_type;
+   std::vector<Real> u = uniforms<Real>();
+   for (auto _ : state)
+   {
+      for (Real v : u)
+      {
+         benchmark::DoNotOptimize(quantile(dist, v));
+      }
+   }
+   state.SetItemsProcessed(state.iterations() * u.size());
+}
+
+template <class Dist>
+void table_performance(benchmark::State& state, const Dist& dist)
+{
+   using Real = typename Dist::value_type;
+   std::vector<Real> u = uniforms<Real>();
+   inverse_cdf_table<Dist> table(dist);
+   for (auto _ : state)
+   {
+      for (Real v : u)
+      {
+         benchmark::DoNotOptimize(table(v));
+      }
+   }
+   state.SetItemsProcessed(state.iterations() * u.size());
+   state.counters["intervals"] = static_cast<double>(table.size());
+}
+
+template <class Dist>
+void table_construction(benchmark::State& state, const Dist& dist)
+{
+   for (auto _ : state)
+   {
+      inverse_cdf_table<Dist> table(dist);
+      benchmark::DoNotOptimize(table.size());
+   }
+}
+
+template <class Real>
+void StudentsT(benchmark::State& state)
+{
+   quantile_performance(state, boost::math::students_t_distribution<Real>(Real(5.5)));
+}
+template <class Real>
+void StudentsTTable(benchmark::State& state)
+{
+   table_performance(state, boost::math::students_t_distribution<Real>(Real(5.5)));
+}
+
+template <class Real>
+void NonCentralT(benchmark::State& state)
+{
+   quantile_performance(state, boost::math::non_central_t_distribution<Real>(Real(5), Real(2)));
+}
+template <class Real>
+void NonCentralTTable(benchmark::State& state)
+{
+   table_performance(state, boost::math::non_central_t_distribution<Real>(Real(5), Real(2)));
+}
+template <class Real>
+void NonCentralTConstruction(benchmark::State& state)
+{
+   table_construction(state, boost::math::non_central_t_distribution<Real>(Real(5), Real(2)));
+}
+
+template <class Real>
+void Beta(benchmark::State& state)
+{
+   quantile_performance(state, boost::math::beta_distribution<Real>(Real(2), Real(5)));
+}
+template <class Real>
+void BetaTable(benchmark::State& state)
+{
+   table_performance(state, boost::math::beta_distribution<Real>(Real(2), Real(5)));
+}
+
+template <class Real>
+void Gamma(benchmark::State& state)
+{
+   quantile_performance(state, boost::math::gamma_distribution<Real>(Real(7.5), Real(2)));
+}
+template <class Real>
+void GammaTable(benchmark::State& state)
+{
+   table_performance(state, boost::math::gamma_distribution<Real>(Real(7.5), Real(2)));
+}
+template <class Real>
+void GammaConstruction(benchmark::State& state)
+{
+   table_construction(state, boost::math::gamma_distribution<Real>(Real(7.5), Real(2)));
+}
+
+BENCHMARK_TEMPLATE(StudentsT, double);
+BENCHMARK_TEMPLATE(StudentsTTable, double);
+BENCHMARK_TEMPLATE(NonCentralT, double);
+BENCHMARK_TEMPLATE(NonCentralTTable, double);
+BENCHMARK_TEMPLATE(NonCentralTConstruction, double);
+BENCHMARK_TEMPLATE(Beta, double);
+BENCHMARK_TEMPLATE(BetaTable, double);
+BENCHMARK_TEMPLATE(Gamma, double);
+BENCHMARK_TEMPLATE(GammaTable, double);
+BENCHMARK_TEMPLATE(GammaConstruction, double);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,49 @@
+//  Copyright Boost.Math contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//
+// Measures the throughput of naive_monte_carlo, in integrand calls per second,
+// as the number of threads increases.  Each iteration integrates for a fixed
+// wall time and then cancels, so the rate reflects the sampling loop and the
+// publication of the per-thread statistics rather than convergence.
+// Build with e.g. -O3 -march=native -pthread.
+//
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <boost/math/quadrature/naive_monte_carlo.hpp>
+
+using boost::math::quadrature::naive_monte_carlo;
+
+template<class Real>
+void naive_monte_carlo_throughput(benchmark::State& state)
+{
+    // A cheap integrand, so that any contention between the threads is visible:
+    auto g = [](std::vector<Real> const & x)
+    {
+        Real r = x[0]*x[0] + x[1]*x[1];
+        return r <= 1 ? Real(4) : Real(0);
+    };
+    std::vector<std::pair<Real, Real>> bounds{{Real(0), Real(1)}, {Real(0), Real(1)}};
+    const std::uint64_t threads = static_cast<std::uint64_t>(state.range(0));
+    std::uint64_t calls = 0;
+    for (auto _ : state)
+    {
+        naive_monte_carlo<Real, decltype(g)> mc(g, bounds, Real(0), /*singular =*/ false, threads, /* seed = */ 1);
+        auto task = mc.integrate();
+        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        mc.cancel();
+        benchmark::DoNotOptimize(task.get());
+        calls += mc.calls();
+    }
+    state.counters["calls/s"] = benchmark::Counter(static_cast<double>(calls), benchmark::Counter::kIsRate);
+}
+
+BENCHMARK_TEMPLATE(naive_monte_carlo_throughput, double)->DenseRange(1, (std::max)(1u, std::thread::hardware_concurrency()))->Iterations(4)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,79 @@
+//  Copyright Boost.Math contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//
+// Compares the norms on contiguous memory, which use the blocked multiple
+// accumulator kernels, with the same data in a std::deque, which takes the
+// generic iterator loops.  Build with e.g. -O3 -march=native.
+//
+#include <deque>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <boost/math/tools/random_vector.hpp>
+#include <boost/math/tools/norms.hpp>
+
+using boost::math::generate_random_vector;
+
+#define BOOST_MATH_NORM_BENCHMARK(name, call)                                   \
+template<class Container>                                                       \
+void name(benchmark::State& state)                                              \
+{                                                                               \
+    using T = typename Container::value_type;                                   \
+    const std::size_t size = state.range(0);                                    \
+    std::vector<T> u = generate_random_vector<T>(size, 17);                     \
+    std::vector<T> w = generate_random_vector<T>(size, 23);                     \
+    Container v(u.begin(), u.end());                                            \
+    Container x(w.begin(), w.end());                                            \
+    for (auto _ : state)                                                        \
+    {                                                                           \
+        benchmark::DoNotOptimize(call);                                         \
+    }                                                                           \
+    state.SetBytesProcessed(state.iterations()*size*sizeof(T));                 \
+    state.SetComplexityN(state.range(0));                                       \
+}
+
+BOOST_MATH_NORM_BENCHMARK(l1_norm, boost::math::tools::l1_norm(v.cbegin(), v.cend()))
+BOOST_MATH_NORM_BENCHMARK(l2_norm, boost::math::tools::l2_norm(v.cbegin(), v.cend()))
+BOOST_MATH_NORM_BENCHMARK(sup_norm, boost::math::tools::sup_norm(v.cbegin(), v.cend()))
+BOOST_MATH_NORM_BENCHMARK(lp_norm, boost::math::tools::lp_norm(v.cbegin(), v.cend(), 3))
+BOOST_MATH_NORM_BENCHMARK(total_variation, boost::math::tools::total_variation(v.cbegin(), v.cend()))
+BOOST_MATH_NORM_BENCHMARK(l1_distance, boost::math::tools::l1_distance(v.cbegin(), v.cend(), x.cbegin()))
+BOOST_MATH_NORM_BENCHMARK(l2_distance, boost::math::tools::l2_distance(v.cbegin(), v.cend(), x.cbegin()))
+BOOST_MATH_NORM_BENCHMARK(sup_distance, boost::math::tools::sup_distance(v.cbegin(), v.cend(), x.cbegin()))
+
+// l2 norm of data which overflows the unscaled sum of squares:
+template<class Container>
+void l2_norm_scaled(benchmark::State& state)
+{
+    using T = typename Container::value_type;
+    const std::size_t size = state.range(0);
+    std::vector<T> u = generate_random_vector<T>(size, 17);
+    u[size/2] = (std::numeric_limits<T>::max)()/2;
+    Container v(u.begin(), u.end());
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(boost::math::tools::l2_norm(v.cbegin(), v.cend()));
+    }
+    state.SetBytesProcessed(state.iterations()*size*sizeof(T));
+    state.SetComplexityN(state.range(0));
+}
+
+#define BOOST_MATH_NORM_REGISTER(name)                                                                                        \
+BENCHMARK_TEMPLATE(name, std::vector<float>)->RangeMultiplier(8)->Range(1 << 6, 1 << 18)->Complexity(benchmark::oN);        \
+BENCHMARK_TEMPLATE(name, std::deque<float>)->RangeMultiplier(8)->Range(1 << 6, 1 << 18)->Complexity(benchmark::oN);         \
+BENCHMARK_TEMPLATE(name, std::vector<double>)->RangeMultiplier(8)->Range(1 << 6, 1 << 18)->Complexity(benchmark::oN);       \
+BENCHMARK_TEMPLATE(name, std::deque<double>)->RangeMultiplier(8)->Range(1 << 6, 1 << 18)->Complexity(benchmark::oN);
+
+BOOST_MATH_NORM_REGISTER(l1_norm)
+BOOST_MATH_NORM_REGISTER(l2_norm)
+BOOST_MATH_NORM_REGISTER(l2_norm_scaled)
+BOOST_MATH_NORM_REGISTER(sup_norm)
+BOOST_MATH_NORM_REGISTER(lp_norm)
+BOOST_MATH_NORM_REGISTER(total_variation)
+BOOST_MATH_NORM_REGISTER(l1_distance)
+BOOST_MATH_NORM_REGISTER(l2_distance)
+BOOST_MATH_NORM_REGISTER(sup_distance)
+
+BENCHMARK_MAIN();
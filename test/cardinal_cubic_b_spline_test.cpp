@@ -15,6 +15,7 @@
 #include <boost/math/interpolators/cardinal_cubic_b_spline.hpp>
 #include <boost/math/interpolators/detail/cardinal_cubic_b_spline_detail.hpp>
 #include <boost/multiprecision/cpp_bin_float.hpp>
+#include <boost/math/tools/thread_pool.hpp>
 
 using boost::multiprecision::cpp_bin_float_50;
 using boost::math::constants::third;
@@ -352,6 +353,89 @@ void test_outside_interval()
     cnull << spline(2000);
 }
 
+template<class Real>
+void test_in_place()
+{
+    std::cout << "Testing construction over the vector of samples on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    using std::sin;
+    std::vector<Real> v(300);
+    Real x0 = 1;
+    Real step = Real(1)/32;
+    for (size_t i = 0; i < v.size(); ++i)
+    {
+        v[i] = sin(x0 + step*i);
+    }
+    boost::math::interpolators::cardinal_cubic_b_spline<Real> spline(v.begin(), v.end(), x0, step);
+    std::vector<Real> w(v);
+    w.reserve(w.size() + 2);
+    boost::math::interpolators::cardinal_cubic_b_spline<Real> in_place(std::move(w), x0, step);
+    std::vector<Real> u(v);
+    boost::math::interpolators::cardinal_cubic_b_spline<Real> with_derivatives(std::move(u), x0, step, cos(x0), cos(x0 + step*(v.size() - 1)));
+    for (size_t i = 0; i <= 3*(v.size() - 1); ++i)
+    {
+        Real x = x0 + step*i/3;
+        BOOST_CHECK_EQUAL(spline(x), in_place(x));
+        BOOST_CHECK_EQUAL(spline.prime(x), in_place.prime(x));
+        BOOST_CHECK_SMALL(with_derivatives(x) - sin(x), Real(1e-5));
+    }
+
+    std::vector<Real> nan(v);
+    nan[17] = std::numeric_limits<Real>::quiet_NaN();
+    BOOST_CHECK_THROW(boost::math::interpolators::cardinal_cubic_b_spline<Real>(std::move(nan), x0, step), std::logic_error);
+}
+
+struct reversed_executor
+{
+    unsigned concurrency() const
+    {
+        return 3;
+    }
+
+    template<class F>
+    void bulk_execute(std::size_t n, F&& f) const
+    {
+        while (n)
+        {
+            f(--n);
+        }
+    }
+};
+
+template<class Real>
+void test_parallel_construction()
+{
+    std::cout << "Testing construction in blocks on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    using std::abs;
+    using std::sin;
+    // Enough samples for the system to be solved in three blocks:
+    std::vector<Real> v(100000);
+    Real x0 = -1;
+    Real step = Real(1)/1024;
+    for (size_t i = 0; i < v.size(); ++i)
+    {
+        v[i] = sin(x0 + step*i) + sin(3*step*i)/7;
+    }
+    boost::math::interpolators::cardinal_cubic_b_spline<Real> spline(v.begin(), v.end(), x0, step);
+    reversed_executor reversed;
+    boost::math::interpolators::cardinal_cubic_b_spline<Real> blocks(reversed, std::vector<Real>(v), x0, step);
+    boost::math::tools::thread_pool pool(3);
+    boost::math::interpolators::cardinal_cubic_b_spline<Real> threads(pool, std::vector<Real>(v), x0, step);
+    Real tol = 8*std::numeric_limits<Real>::epsilon();
+    for (size_t i = 0; i <= 2*(v.size() - 1); ++i)
+    {
+        Real x = x0 + step*i/2;
+        BOOST_CHECK_SMALL(blocks(x) - spline(x), tol);
+        BOOST_CHECK_SMALL(threads(x) - spline(x), tol);
+        BOOST_CHECK_SMALL((threads.prime(x) - spline.prime(x))*step, tol);
+    }
+    // The extrapolation depends on the average being the same:
+    BOOST_CHECK_SMALL(threads(x0 - 10*step) - spline(x0 - 10*step), tol);
+
+    std::vector<Real> nan(v);
+    nan[v.size() - 10] = std::numeric_limits<Real>::quiet_NaN();
+    BOOST_CHECK_THROW(boost::math::interpolators::cardinal_cubic_b_spline<Real>(pool, std::move(nan), x0, step), std::logic_error);
+}
+
 BOOST_AUTO_TEST_CASE(test_cubic_b_spline)
 {
     test_b3_spline<float>();
@@ -404,4 +488,14 @@ BOOST_AUTO_TEST_CASE(test_cubic_b_spline)
 
     test_copy_move<double>();
     test_outside_interval<double>();
+
+    test_in_place<float>();
+    test_in_place<double>();
+#ifndef BOOST_MATH_NO_LONG_DOUBLE_MATH_FUNCTIONS
+    test_in_place<long double>();
+#endif
+    test_in_place<cpp_bin_float_50>();
+
+    test_parallel_construction<float>();
+    test_parallel_construction<double>();
 }
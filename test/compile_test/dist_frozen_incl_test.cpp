@@ -0,0 +1,31 @@
+//  Copyright Boost.Math contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Basic sanity check that header <boost/math/distributions/frozen.hpp>
+// #includes all the files that it needs to.
+//
+#include <boost/math/distributions/frozen.hpp>
+//
+// Note this header includes no other headers, this is
+// important if this test is to be meaningful:
+//
+#include "test_compile_result.hpp"
+
+void compile_and_link_test()
+{
+   check_result<double>(boost::math::pdf(boost::math::freeze(boost::math::gamma_distribution<double>(2)), d));
+   check_result<double>(boost::math::pdf(boost::math::freeze(boost::math::beta_distribution<double>(2, 3)), d));
+   check_result<double>(boost::math::pdf(boost::math::freeze(boost::math::students_t_distribution<double>(2)), d));
+   check_result<double>(boost::math::pdf(boost::math::freeze(boost::math::non_central_chi_squared_distribution<double>(2, 60)), d));
+   check_result<float>(boost::math::cdf(boost::math::freeze(boost::math::normal_distribution<float>()), f));
+}
+
+template class boost::math::frozen_distribution<boost::math::gamma_distribution<float> >;
+template class boost::math::frozen_distribution<boost::math::beta_distribution<double> >;
+template class boost::math::frozen_distribution<boost::math::students_t_distribution<double> >;
+template class boost::math::frozen_distribution<boost::math::non_central_chi_squared_distribution<double> >;
+#ifndef BOOST_MATH_NO_LONG_DOUBLE_MATH_FUNCTIONS
+template class boost::math::frozen_distribution<boost::math::gamma_distribution<long double> >;
+#endif
@@ -0,0 +1,21 @@
+//  Copyright Boost.Math contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Basic sanity check that header
+// #includes all the files that it needs to.
+//
+#include <boost/math/quadrature/genz_malik.hpp>
+//
+// Note this header includes no other headers, this is
+// important if this test is to be meaningful:
+//
+#include "test_compile_result.hpp"
+
+void compile_and_link_test()
+{
+    auto f = [](const std::vector<double>& x) { return x[0] * x[1]; };
+    boost::math::quadrature::genz_malik<double> integrator;
+    check_result<double>(integrator.integrate(f, { {0.0, 1.0}, {0.0, 1.0} }));
+}
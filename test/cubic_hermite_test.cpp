@@ -9,7 +9,9 @@
 #include <numeric>
 #include <utility>
 #include <random>
+#include <algorithm>
 #include <array>
+#include <stdexcept>
 #include <vector>
 #include <boost/math/interpolators/cubic_hermite.hpp>
 #include <boost/math/special_functions/next.hpp>
@@ -21,6 +23,7 @@ using boost::multiprecision::float128;
 
 
 using boost::math::interpolators::cubic_hermite;
+using boost::math::interpolators::cubic_hermite_segments;
 using boost::math::interpolators::cardinal_cubic_hermite;
 using boost::math::interpolators::cardinal_cubic_hermite_aos;
 
@@ -419,6 +422,149 @@ void test_cardinal_interpolation_condition()
 }
 
 
+template<typename Real>
+void test_batch()
+{
+    std::mt19937 gen(8765);
+    std::uniform_real_distribution<Real> dis(0.1,1);
+    for (size_t n : {2, 3, 17, 500}) {
+        std::vector<Real> x(n);
+        std::vector<Real> y(n);
+        std::vector<Real> dydx(n);
+        x[0] = dis(gen);
+        y[0] = dis(gen);
+        dydx[0] = dis(gen);
+        for (size_t i = 1; i < n; ++i) {
+            x[i] = x[i-1] + dis(gen);
+            y[i] = dis(gen);
+            dydx[i] = dis(gen);
+        }
+        // Random abscissas, the knots themselves, and the endpoints:
+        std::uniform_real_distribution<Real> in_domain(x.front(), x.back());
+        std::vector<Real> t(4*n);
+        for (auto & ti : t) {
+            ti = in_domain(gen);
+        }
+        t.insert(t.end(), x.begin(), x.end());
+        t.push_back(x.front());
+        t.push_back(x.back());
+
+        auto x_copy = x;
+        auto y_copy = y;
+        auto dydx_copy = dydx;
+        auto s = cubic_hermite(std::move(x_copy), std::move(y_copy), std::move(dydx_copy));
+        std::vector<Real> v(t.size());
+        std::vector<Real> dv(t.size());
+        // The values are identical to the scalar ones whatever the order of the abscissas:
+        for (int order = 0; order < 3; ++order) {
+            if (order == 1) {
+                std::sort(t.begin(), t.end());
+            }
+            if (order == 2) {
+                std::reverse(t.begin(), t.end());
+            }
+            CHECK_EQUAL(s(t.begin(), t.end(), v.begin()) == v.end(), true);
+            CHECK_EQUAL(s.prime(t.begin(), t.end(), dv.begin()) == dv.end(), true);
+            for (size_t i = 0; i < t.size(); ++i) {
+                CHECK_EQUAL(s(t[i]), v[i]);
+                CHECK_EQUAL(s.prime(t[i]), dv[i]);
+            }
+        }
+    }
+
+    std::vector<Real> x{0, 1, 2};
+    std::vector<Real> y{0, 1, 4};
+    std::vector<Real> dydx{0, 2, 4};
+    auto s = cubic_hermite(std::move(x), std::move(y), std::move(dydx));
+    std::vector<Real> t{Real(0.5), Real(3)};
+    std::vector<Real> v(2);
+    bool thrown = false;
+    try {
+        s(t.begin(), t.end(), v.begin());
+    }
+    catch (const std::domain_error &) {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+}
+
+template<typename Real>
+void test_segments()
+{
+    // A cubic is reproduced up to rounding error:
+    auto p = [](Real t) { return 1 + t*(2 + t*(-3 + t)); };
+    auto dp = [](Real t) { return 2 + t*(-6 + 3*t); };
+    std::vector<Real> x{0, Real(0.5), Real(1.25), 2, Real(3.5), 4};
+    std::vector<Real> y(x.size());
+    std::vector<Real> dydx(x.size());
+    for (size_t i = 0; i < x.size(); ++i) {
+        y[i] = p(x[i]);
+        dydx[i] = dp(x[i]);
+    }
+    auto x_copy = x;
+    auto y_copy = y;
+    auto dydx_copy = dydx;
+    auto s = cubic_hermite_segments(std::move(x_copy), std::move(y_copy), std::move(dydx_copy));
+    Real tol = 16*std::numeric_limits<Real>::epsilon();
+    for (Real t = 0; t <= 4; t += Real(1)/64) {
+        CHECK_MOLLIFIED_CLOSE(p(t), s(t), tol);
+        CHECK_MOLLIFIED_CLOSE(dp(t), s.prime(t), tol);
+    }
+    for (size_t i = 0; i < x.size(); ++i) {
+        CHECK_EQUAL(y[i], s(x[i]));
+        CHECK_ULP_CLOSE(dydx[i], s.prime(x[i]), 2);
+    }
+
+    // Random data gives the same interpolant as cubic_hermite, and push_back the same as construction:
+    std::mt19937 gen(4321);
+    std::uniform_real_distribution<Real> dis(0.1,1);
+    size_t n = 300;
+    x.resize(n);
+    y.resize(n);
+    dydx.resize(n);
+    x[0] = dis(gen);
+    y[0] = dis(gen);
+    dydx[0] = dis(gen);
+    for (size_t i = 1; i < n; ++i) {
+        x[i] = x[i-1] + dis(gen);
+        y[i] = dis(gen);
+        dydx[i] = dis(gen);
+    }
+    x_copy.assign(x.begin(), x.end() - 2);
+    y_copy.assign(y.begin(), y.end() - 2);
+    dydx_copy.assign(dydx.begin(), dydx.end() - 2);
+    auto grown = cubic_hermite_segments(std::move(x_copy), std::move(y_copy), std::move(dydx_copy));
+    grown.push_back(x[n-2], y[n-2], dydx[n-2]);
+    grown.push_back(x[n-1], y[n-1], dydx[n-1]);
+    x_copy = x;
+    y_copy = y;
+    dydx_copy = dydx;
+    auto segments = cubic_hermite_segments(std::move(x_copy), std::move(y_copy), std::move(dydx_copy));
+    auto hermite = cubic_hermite(std::move(x), std::move(y), std::move(dydx));
+    CHECK_EQUAL(segments.domain().first, hermite.domain().first);
+    CHECK_EQUAL(segments.domain().second, hermite.domain().second);
+    std::uniform_real_distribution<Real> in_domain(hermite.domain().first, hermite.domain().second);
+    std::vector<Real> t(2*n);
+    for (auto & ti : t) {
+        ti = in_domain(gen);
+    }
+    t.push_back(hermite.domain().second);
+    std::sort(t.begin(), t.end());
+    std::vector<Real> v(t.size());
+    std::vector<Real> dv(t.size());
+    segments(t.begin(), t.end(), v.begin());
+    segments.prime(t.begin(), t.end(), dv.begin());
+    for (size_t i = 0; i < t.size(); ++i) {
+        CHECK_MOLLIFIED_CLOSE(hermite(t[i]), segments(t[i]), tol);
+        CHECK_MOLLIFIED_CLOSE(hermite.prime(t[i]), segments.prime(t[i]), 64*tol);
+        CHECK_EQUAL(segments(t[i]), v[i]);
+        CHECK_EQUAL(segments.prime(t[i]), dv[i]);
+        CHECK_EQUAL(segments(t[i]), grown(t[i]));
+        CHECK_EQUAL(segments.prime(t[i]), grown.prime(t[i]));
+    }
+    CHECK_EQUAL(hermite(t.back()), segments(t.back()));
+    CHECK_EQUAL(hermite.prime(t.back()), segments.prime(t.back()));
+}
 
 int main()
 {
@@ -430,6 +576,8 @@ int main()
     test_cardinal_linear<float>();
     test_cardinal_quadratic<float>();
     test_cardinal_interpolation_condition<float>();
+    test_batch<float>();
+    test_segments<float>();
 
     test_constant<double>();
     test_linear<double>();
@@ -439,6 +587,8 @@ int main()
     test_cardinal_linear<double>();
     test_cardinal_quadratic<double>();
     test_cardinal_interpolation_condition<double>();
+    test_batch<double>();
+    test_segments<double>();
 
     test_constant<long double>();
     test_linear<long double>();
@@ -448,6 +598,8 @@ int main()
     test_cardinal_linear<long double>();
     test_cardinal_quadratic<long double>();
     test_cardinal_interpolation_condition<long double>();
+    test_batch<long double>();
+    test_segments<long double>();
 
 
 #ifdef BOOST_HAS_FLOAT128
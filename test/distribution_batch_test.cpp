@@ -0,0 +1,178 @@
+//  Copyright Boost.Math contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "math_unit_test.hpp"
+#include <vector>
+#include <list>
+#include <random>
+#include <limits>
+#include <iterator>
+#include <stdexcept>
+#include <boost/math/distributions/normal.hpp>
+#include <boost/math/distributions/exponential.hpp>
+#include <boost/math/distributions/gamma.hpp>
+#include <boost/math/distributions/beta.hpp>
+#include <boost/math/distributions/students_t.hpp>
+
+using boost::math::policies::policy;
+using boost::math::policies::domain_error;
+using boost::math::policies::ignore_error;
+
+//
+// The array-at-a-time overloads must give exactly the same results as
+// calling the scalar functions for each element in turn, whether or not
+// the distribution provides a specialised implementation:
+//
+template <class Dist>
+void test_batch(const Dist& dist, const std::vector<typename Dist::value_type>& x, const std::vector<typename Dist::value_type>& p)
+{
+   typedef typename Dist::value_type Real;
+   std::vector<Real> y(x.size());
+
+   auto it = pdf(dist, x.begin(), x.end(), y.begin());
+   CHECK_EQUAL(it == y.end(), true);
+   for (std::size_t i = 0; i < x.size(); ++i)
+   {
+      CHECK_EQUAL(pdf(dist, x[i]), y[i]);
+   }
+   it = cdf(dist, x.begin(), x.end(), y.begin());
+   CHECK_EQUAL(it == y.end(), true);
+   for (std::size_t i = 0; i < x.size(); ++i)
+   {
+      CHECK_EQUAL(cdf(dist, x[i]), y[i]);
+   }
+   y.resize(p.size());
+   it = quantile(dist, p.begin(), p.end(), y.begin());
+   CHECK_EQUAL(it == y.end(), true);
+   for (std::size_t i = 0; i < p.size(); ++i)
+   {
+      CHECK_EQUAL(quantile(dist, p[i]), y[i]);
+   }
+}
+
+template <class Real>
+void test_distributions()
+{
+   std::mt19937_64 gen(2718);
+   std::uniform_real_distribution<Real> wide(-50, 50);
+   std::uniform_real_distribution<Real> positive(0, 20);
+   std::uniform_real_distribution<Real> unit(0, 1);
+
+   std::vector<Real> x { 0, Real(0.5), -Real(0.5), 1, 3, 40, -40, std::numeric_limits<Real>::infinity(), -std::numeric_limits<Real>::infinity() };
+   std::vector<Real> xp { 0, Real(0.5), 1, 3, 40, 1000, std::numeric_limits<Real>::infinity() };
+   std::vector<Real> p { Real(0.5), Real(1e-10), 1 - std::numeric_limits<Real>::epsilon(), Real(0.25) };
+   for (unsigned i = 0; i < 500; ++i)
+   {
+      x.push_back(wide(gen));
+      xp.push_back(positive(gen));
+      p.push_back(unit(gen));
+   }
+
+   test_batch(boost::math::normal_distribution<Real>(), x, p);
+   test_batch(boost::math::normal_distribution<Real>(Real(2.5), Real(0.25)), x, p);
+   test_batch(boost::math::exponential_distribution<Real>(Real(0.75)), xp, p);
+   // These have specialised pdfs only:
+   test_batch(boost::math::students_t_distribution<Real>(Real(3.5)), x, p);
+   test_batch(boost::math::students_t_distribution<Real>(1 / std::numeric_limits<Real>::epsilon() * 4), x, p);
+   xp.erase(xp.begin() + 6);  // gamma does not accept infinite arguments
+   // Arguments for which x / scale underflows to zero:
+   xp.push_back(std::numeric_limits<Real>::denorm_min());
+   xp.push_back(std::numeric_limits<Real>::min());
+   test_batch(boost::math::gamma_distribution<Real>(Real(2.5), Real(3)), xp, p);
+   test_batch(boost::math::gamma_distribution<Real>(1, Real(3)), xp, p);
+   test_batch(boost::math::gamma_distribution<Real>(Real(0.75), Real(1) / 8), std::vector<Real>(xp.begin(), xp.end() - 2), p);
+   std::vector<Real> u { 0, 1, Real(0.5), Real(1e-10), 1 - std::numeric_limits<Real>::epsilon() };
+   for (unsigned i = 0; i < 500; ++i)
+   {
+      u.push_back(unit(gen));
+   }
+   test_batch(boost::math::beta_distribution<Real>(Real(2.5), Real(7)), u, p);
+   test_batch(boost::math::beta_distribution<Real>(Real(40), Real(0.5)), u, p);
+}
+
+void test_iterators()
+{
+   // Non-contiguous input, inserting output, and integer arguments:
+   boost::math::normal_distribution<double> n(1, 2);
+   std::list<int> x { -3, -1, 0, 1, 2, 7 };
+   std::vector<double> y;
+   cdf(n, x.begin(), x.end(), std::back_inserter(y));
+   CHECK_EQUAL(y.size(), x.size());
+   std::size_t i = 0;
+   for (int v : x)
+   {
+      CHECK_EQUAL(cdf(n, v), y[i++]);
+   }
+   // Empty ranges are fine:
+   std::vector<double> empty;
+   CHECK_EQUAL(pdf(n, empty.begin(), empty.end(), y.begin()) == y.begin(), true);
+}
+
+void test_errors()
+{
+   // Invalid parameters with an ignoring error handler give NaN everywhere:
+   typedef policy<domain_error<ignore_error> > quiet_policy;
+   boost::math::normal_distribution<double, quiet_policy> bad(0, -1);
+   std::vector<double> x { 0.5, 1, 2 };
+   std::vector<double> y(x.size());
+   pdf(bad, x.begin(), x.end(), y.begin());
+   for (double v : y)
+   {
+      CHECK_NAN(v);
+   }
+   boost::math::exponential_distribution<double, quiet_policy> bad_exp(-2);
+   quantile(bad_exp, x.begin(), x.end(), y.begin());
+   for (double v : y)
+   {
+      CHECK_NAN(v);
+   }
+   boost::math::gamma_distribution<double, quiet_policy> bad_gamma(-2, 1);
+   pdf(bad_gamma, x.begin(), x.end(), y.begin());
+   for (double v : y)
+   {
+      CHECK_NAN(v);
+   }
+   boost::math::beta_distribution<double, quiet_policy> bad_beta(1, 0);
+   pdf(bad_beta, x.begin(), x.end(), y.begin());
+   for (double v : y)
+   {
+      CHECK_NAN(v);
+   }
+
+#ifndef BOOST_NO_EXCEPTIONS
+   // Invalid arguments still raise an error:
+   x[1] = std::numeric_limits<double>::quiet_NaN();
+   bool thrown = false;
+   try
+   {
+      cdf(boost::math::normal_distribution<double>(), x.begin(), x.end(), y.begin());
+   }
+   catch (const std::domain_error&)
+   {
+      thrown = true;
+   }
+   CHECK_EQUAL(thrown, true);
+   thrown = false;
+   try
+   {
+      quantile(boost::math::normal_distribution<double>(), x.begin(), x.end(), y.begin());
+   }
+   catch (const std::domain_error&)
+   {
+      thrown = true;
+   }
+   CHECK_EQUAL(thrown, true);
+#endif
+}
+
+int main()
+{
+   test_distributions<float>();
+   test_distributions<double>();
+   test_distributions<long double>();
+   test_iterators();
+   test_errors();
+   return boost::math::test::report_errors();
+}
@@ -0,0 +1,153 @@
+//  Copyright Boost.Math contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "math_unit_test.hpp"
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <boost/math/constants/constants.hpp>
+#include <boost/math/quadrature/tanh_sinh.hpp>
+#include <boost/math/quadrature/exp_sinh.hpp>
+#include <boost/math/quadrature/sinh_sinh.hpp>
+
+using boost::math::quadrature::tanh_sinh;
+using boost::math::quadrature::exp_sinh;
+using boost::math::quadrature::sinh_sinh;
+
+// Wraps a scalar function as a batch integrand, counting calls and points:
+template<class Real, class F>
+class batch
+{
+public:
+    batch(F f, std::size_t& calls, std::size_t& points) : f_(f), calls_(&calls), points_(&points) {}
+
+    void operator()(const Real* x, Real* y, std::size_t n) const
+    {
+        ++*calls_;
+        *points_ += n;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            y[i] = f_(x[i]);
+        }
+    }
+
+private:
+    F f_;
+    std::size_t* calls_;
+    std::size_t* points_;
+};
+
+// Integrates f both ways, and returns the batch result.  The two agree to a few
+// ulps, the differences coming only from the changes of variables, and the batch
+// integrand is called once per row, plus a few times at single points to locate
+// the endpoints:
+template<class Real, class Integrator, class F, class... Args>
+Real check_batch(const Integrator& integrator, F f, Real tolerance, Args... args)
+{
+    std::size_t scalar_points = 0;
+    auto g = [&](Real x) { ++scalar_points; return f(x); };
+    Real scalar_error, scalar_L1;
+    std::size_t scalar_levels;
+    Real Q = integrator.integrate(g, args..., tolerance, &scalar_error, &scalar_L1, &scalar_levels);
+
+    std::size_t calls = 0;
+    std::size_t points = 0;
+    Real error, L1;
+    std::size_t levels;
+    Real Qb = integrator.integrate(batch<Real, F>(f, calls, points), args..., tolerance, &error, &L1, &levels);
+    CHECK_ULP_CLOSE(Q, Qb, 4);
+    CHECK_ULP_CLOSE(scalar_L1, L1, 4);
+    CHECK_EQUAL(scalar_levels, levels);
+    CHECK_LE(scalar_points, points);
+    CHECK_LE(calls, 2*levels + 40);
+    return Qb;
+}
+
+template<class Real>
+void test_tanh_sinh()
+{
+    using std::exp;
+    using std::log;
+    using std::sqrt;
+    using boost::math::constants::pi;
+    tanh_sinh<Real> integrator;
+    const Real inf = std::numeric_limits<Real>::infinity();
+    const Real tol = boost::math::tools::root_epsilon<Real>();
+
+    auto f1 = [](Real x) { return log(x)*log1p(-x); };
+    CHECK_ABSOLUTE_ERROR(2 - pi<Real>()*pi<Real>()/6, check_batch(integrator, f1, tol, Real(0), Real(1)), 10*tol);
+    auto f2 = [](Real x) { return exp(x); };
+    CHECK_ABSOLUTE_ERROR(exp(Real(-1)) - exp(Real(2)), check_batch(integrator, f2, tol, Real(2), Real(-1)), 10*tol);
+    auto f3 = [](Real x) { return exp(-x*x); };
+    CHECK_ABSOLUTE_ERROR(sqrt(pi<Real>()), check_batch(integrator, f3, tol, -inf, inf), 10*tol);
+    auto f4 = [](Real x) { return 1/(1 + x*x); };
+    CHECK_ABSOLUTE_ERROR(pi<Real>()/2, check_batch(integrator, f4, tol, Real(0), inf), 10*tol);
+    CHECK_ABSOLUTE_ERROR(Real(1), check_batch(integrator, f2, tol, -inf, Real(0)), 10*tol);
+    auto f5 = [](Real x) { return 1/sqrt(1 - x*x); };
+    CHECK_ABSOLUTE_ERROR(pi<Real>(), check_batch(integrator, f5, tol), 10*tol);
+
+    // The changes of variables for infinite ranges are shared with ordinary integrands:
+    std::size_t calls = 0;
+    std::size_t points = 0;
+    CHECK_EQUAL(integrator.integrate(f3, -inf, inf), integrator.integrate(batch<Real, decltype(f3)>(f3, calls, points), -inf, inf));
+    CHECK_EQUAL(integrator.integrate(f4, Real(0), inf), integrator.integrate(batch<Real, decltype(f4)>(f4, calls, points), Real(0), inf));
+    CHECK_EQUAL(integrator.integrate(f2, -inf, Real(0)), integrator.integrate(batch<Real, decltype(f2)>(f2, calls, points), -inf, Real(0)));
+}
+
+template<class Real>
+void test_exp_sinh()
+{
+    using std::exp;
+    using std::sqrt;
+    using boost::math::constants::pi;
+    exp_sinh<Real> integrator;
+    const Real inf = std::numeric_limits<Real>::infinity();
+    const Real tol = boost::math::tools::root_epsilon<Real>();
+
+    auto f1 = [](Real x) { return exp(-x)/sqrt(x); };
+    CHECK_ABSOLUTE_ERROR(sqrt(pi<Real>()), check_batch(integrator, f1, tol), 10*tol);
+    CHECK_ABSOLUTE_ERROR(sqrt(pi<Real>()), check_batch(integrator, f1, tol, Real(0), inf), 10*tol);
+    auto f2 = [](Real x) { return exp(-x); };
+    CHECK_ABSOLUTE_ERROR(exp(Real(-1)), check_batch(integrator, f2, tol, Real(1), inf), 10*tol);
+    auto f3 = [](Real x) { return exp(x); };
+    CHECK_ABSOLUTE_ERROR(exp(Real(2)), check_batch(integrator, f3, tol, -inf, Real(2)), 10*tol);
+
+    std::size_t calls = 0;
+    std::size_t points = 0;
+    CHECK_EQUAL(integrator.integrate(f2, Real(1), inf), integrator.integrate(batch<Real, decltype(f2)>(f2, calls, points), Real(1), inf));
+    CHECK_EQUAL(integrator.integrate(f3, -inf, Real(2)), integrator.integrate(batch<Real, decltype(f3)>(f3, calls, points), -inf, Real(2)));
+}
+
+template<class Real>
+void test_sinh_sinh()
+{
+    using std::exp;
+    using std::sqrt;
+    using boost::math::constants::pi;
+    sinh_sinh<Real> integrator;
+    const Real tol = boost::math::tools::root_epsilon<Real>();
+
+    auto f1 = [](Real x) { return exp(-x*x); };
+    CHECK_ABSOLUTE_ERROR(sqrt(pi<Real>()), check_batch(integrator, f1, tol), 10*tol);
+    auto f2 = [](Real x) { return 1/(1 + x*x); };
+    CHECK_ABSOLUTE_ERROR(pi<Real>(), check_batch(integrator, f2, tol), 10*tol);
+}
+
+int main()
+{
+    test_tanh_sinh<float>();
+    test_tanh_sinh<double>();
+    test_tanh_sinh<long double>();
+
+    test_exp_sinh<float>();
+    test_exp_sinh<double>();
+    test_exp_sinh<long double>();
+
+    test_sinh_sinh<float>();
+    test_sinh_sinh<double>();
+    test_sinh_sinh<long double>();
+
+    return boost::math::test::report_errors();
+}
@@ -0,0 +1,121 @@
+//  Copyright Boost.Math contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "math_unit_test.hpp"
+#include <vector>
+#include <list>
+#include <random>
+#include <limits>
+#include <iterator>
+#include <utility>
+#include <boost/math/special_functions/erf.hpp>
+#include <boost/math/tools/is_detected.hpp>
+
+//
+// The batched versions of erf and erfc must give exactly the same
+// results as the scalar versions, whatever the mix of arguments:
+//
+template <class Real>
+std::vector<Real> test_arguments()
+{
+   std::vector<Real> x { 0, -Real(0), Real(0.5), -Real(0.5), Real(1e-12), -Real(1e-12), Real(1.5), Real(2.5), Real(4.5), Real(5.93f), Real(28), -Real(28), Real(100) };
+   if (std::numeric_limits<Real>::has_infinity)
+   {
+      x.push_back(std::numeric_limits<Real>::infinity());
+      x.push_back(-std::numeric_limits<Real>::infinity());
+   }
+   std::mt19937_64 gen(12345);
+   std::uniform_real_distribution<Real> narrow(-5, 5);
+   std::uniform_real_distribution<Real> wide(-40, 40);
+   for (unsigned i = 0; i < 2000; ++i)
+   {
+      x.push_back(i & 1 ? narrow(gen) : wide(gen));
+   }
+   return x;
+}
+
+template <class Real>
+void test_erf_batch()
+{
+   std::vector<Real> x = test_arguments<Real>();
+   std::vector<Real> y(x.size());
+
+   auto it = boost::math::erf(x.begin(), x.end(), y.begin());
+   CHECK_EQUAL(it == y.end(), true);
+   for (std::size_t i = 0; i < x.size(); ++i)
+   {
+      CHECK_EQUAL(boost::math::erf(x[i]), y[i]);
+   }
+
+   it = boost::math::erfc(x.begin(), x.end(), y.begin());
+   CHECK_EQUAL(it == y.end(), true);
+   for (std::size_t i = 0; i < x.size(); ++i)
+   {
+      CHECK_EQUAL(boost::math::erfc(x[i]), y[i]);
+   }
+}
+
+// The batched overloads only take part in overload resolution for iterator arguments:
+template <class T>
+using three_argument_erf_t = decltype(boost::math::erf(std::declval<T>(), std::declval<T>(), std::declval<T>()));
+template <class T>
+using three_argument_erfc_t = decltype(boost::math::erfc(std::declval<T>(), std::declval<T>(), std::declval<T>()));
+
+static_assert(boost::math::tools::is_detected<three_argument_erf_t, double*>::value, "erf over a range of pointers");
+static_assert(!boost::math::tools::is_detected<three_argument_erf_t, double>::value, "erf(double, double, double) is not a range");
+static_assert(boost::math::tools::is_detected<three_argument_erfc_t, double*>::value, "erfc over a range of pointers");
+static_assert(!boost::math::tools::is_detected<three_argument_erfc_t, double>::value, "erfc(double, double, double) is not a range");
+
+void test_iterators()
+{
+   // Non-contiguous input, inserting output, and integer arguments:
+   std::list<int> x { -3, -1, 0, 1, 2, 7 };
+   std::vector<double> y;
+   boost::math::erfc(x.begin(), x.end(), std::back_inserter(y));
+   CHECK_EQUAL(y.size(), x.size());
+   std::size_t i = 0;
+   for (int v : x)
+   {
+      CHECK_EQUAL(boost::math::erfc(v), y[i++]);
+   }
+}
+
+void test_nan()
+{
+   using boost::math::policies::policy;
+   using boost::math::policies::denorm_error;
+   using boost::math::policies::throw_on_error;
+
+   std::vector<double> x { 0.5, std::numeric_limits<double>::quiet_NaN(), 2.0, std::numeric_limits<double>::quiet_NaN() };
+   std::vector<double> y(x.size());
+   boost::math::erf(x.begin(), x.end(), y.begin());
+   CHECK_EQUAL(boost::math::erf(0.5), y[0]);
+   CHECK_NAN(y[1]);
+   CHECK_EQUAL(boost::math::erf(2.0), y[2]);
+   CHECK_NAN(y[3]);
+
+#ifndef BOOST_NO_EXCEPTIONS
+   bool thrown = false;
+   try
+   {
+      boost::math::erf(x.begin(), x.end(), y.begin(), policy<denorm_error<throw_on_error>>());
+   }
+   catch (const std::exception&)
+   {
+      thrown = true;
+   }
+   CHECK_EQUAL(thrown, true);
+#endif
+}
+
+int main()
+{
+   test_erf_batch<float>();
+   test_erf_batch<double>();
+   test_erf_batch<long double>();
+   test_iterators();
+   test_nan();
+   return boost::math::test::report_errors();
+}
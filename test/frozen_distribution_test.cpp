@@ -0,0 +1,175 @@
+//  Copyright Boost.Math contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "math_unit_test.hpp"
+#include <vector>
+#include <random>
+#include <limits>
+#include <stdexcept>
+#include <boost/math/distributions/frozen.hpp>
+
+using boost::math::freeze;
+using boost::math::complement;
+
+//
+// A frozen distribution caches the parameter-only parts of the calculation,
+// but must otherwise do exactly what the wrapped distribution does:
+//
+template <class Dist>
+void test_frozen(const Dist& dist, const std::vector<typename Dist::value_type>& x)
+{
+   typedef typename Dist::value_type Real;
+   auto f = freeze(dist);
+   for (Real v : x)
+   {
+      CHECK_EQUAL(pdf(dist, v), pdf(f, v));
+      CHECK_EQUAL(cdf(dist, v), cdf(f, v));
+      CHECK_EQUAL(cdf(complement(dist, v)), cdf(complement(f, v)));
+   }
+   for (Real p : { Real(0.001), Real(0.25), Real(0.5), Real(0.875) })
+   {
+      CHECK_EQUAL(quantile(dist, p), quantile(f, p));
+      CHECK_EQUAL(quantile(complement(dist, p)), quantile(complement(f, p)));
+   }
+   // The range overloads work with frozen distributions too:
+   std::vector<Real> y(x.size());
+   pdf(f, x.begin(), x.end(), y.begin());
+   for (std::size_t i = 0; i < x.size(); ++i)
+   {
+      CHECK_EQUAL(pdf(dist, x[i]), y[i]);
+   }
+}
+
+//
+// The gamma logpdf is a sum of terms which may be contracted differently
+// once some of them are cached, so the error is measured against the
+// size of those terms:
+//
+template <class Real>
+void test_gamma_logpdf(Real shape, Real scale, const std::vector<Real>& x)
+{
+   using std::abs;
+   using std::log;
+   boost::math::gamma_distribution<Real> dist(shape, scale);
+   auto f = freeze(dist);
+   for (Real v : x)
+   {
+      if (v == 0)
+      {
+         continue;
+      }
+      Real terms = abs(shape * log(scale)) + abs((shape - 1) * log(v)) + abs(boost::math::lgamma(shape)) + v / scale;
+      CHECK_ABSOLUTE_ERROR(logpdf(dist, v), logpdf(f, v), 4 * std::numeric_limits<Real>::epsilon() * terms);
+   }
+}
+
+//
+// Tiny arguments for which x / scale underflows to zero take the special
+// cases of gamma_p_derivative at zero, as they do for the scalar pdf:
+//
+template <class Real>
+void test_gamma_underflow()
+{
+   using namespace boost::math::policies;
+   std::vector<Real> tiny { std::numeric_limits<Real>::denorm_min(), 2 * std::numeric_limits<Real>::denorm_min(), std::numeric_limits<Real>::min() };
+   for (Real shape : { Real(2.5), Real(1) })
+   {
+      boost::math::gamma_distribution<Real> dist(shape, Real(3));
+      auto f = freeze(dist);
+      for (Real v : tiny)
+      {
+         CHECK_EQUAL(pdf(dist, v), pdf(f, v));
+      }
+   }
+   // Below 1 the density at zero is infinite:
+   typedef policy<overflow_error<ignore_error> > quiet_policy;
+   boost::math::gamma_distribution<Real, quiet_policy> dist(Real(0.25), Real(3));
+   auto f = freeze(dist);
+   for (Real v : tiny)
+   {
+      CHECK_EQUAL(pdf(dist, v), pdf(f, v));
+   }
+}
+
+template <class Real>
+void test_distributions()
+{
+   std::mt19937_64 gen(161803);
+   std::vector<Real> positive { 0, Real(1e-5), Real(0.5), 1, 2, 10, 50, 200, 400 };
+   std::vector<Real> unit { 0, Real(1e-5), Real(0.125), Real(0.5), Real(0.75), Real(0.99999), 1 };
+   std::vector<Real> real { -100, -3, Real(-0.25), 0, Real(0.25), 1, 4, 1000 };
+   std::exponential_distribution<Real> e(Real(0.05));
+   std::uniform_real_distribution<Real> u(0, 1);
+   std::uniform_real_distribution<Real> r(-10, 10);
+   for (unsigned i = 0; i < 100; ++i)
+   {
+      positive.push_back(e(gen));
+      unit.push_back(u(gen));
+      real.push_back(r(gen));
+   }
+
+   // Shapes below 1, near 1, and large enough to take the log1pmx path:
+   for (Real shape : { Real(0.25), Real(1), Real(2.5), Real(30), Real(200) })
+   {
+      test_frozen(boost::math::gamma_distribution<Real>(shape, Real(1.5)), positive);
+      test_gamma_logpdf(shape, Real(1.5), positive);
+   }
+   for (Real a : { Real(0.5), Real(2), Real(20) })
+   {
+      for (Real b : { Real(0.75), Real(3), Real(150) })
+      {
+         test_frozen(boost::math::beta_distribution<Real>(a, b), unit);
+      }
+   }
+   for (Real df : { Real(0.5), Real(3), Real(1000), Real(1e30) })
+   {
+      test_frozen(boost::math::students_t_distribution<Real>(df), real);
+   }
+   // Small non-centrality forwards, large uses the cached series weight:
+   for (Real l : { Real(0), Real(5), Real(60), Real(300) })
+   {
+      test_frozen(boost::math::non_central_chi_squared_distribution<Real>(Real(4), l), positive);
+   }
+   // The generic version just forwards:
+   test_frozen(boost::math::normal_distribution<Real>(1, 3), real);
+}
+
+void test_errors()
+{
+   // Errors in the argument are still raised:
+   auto f = freeze(boost::math::gamma_distribution<double>(2, 3));
+   CHECK_EQUAL(f.distribution().shape(), 2.0);
+#ifndef BOOST_NO_EXCEPTIONS
+   bool thrown = false;
+   try
+   {
+      pdf(f, -1.0);
+   }
+   catch (const std::domain_error&)
+   {
+      thrown = true;
+   }
+   CHECK_EQUAL(thrown, true);
+#endif
+   // Invalid parameters are left for the wrapped distribution to report:
+   using namespace boost::math::policies;
+   typedef policy<domain_error<ignore_error> > quiet_policy;
+   auto g = freeze(boost::math::students_t_distribution<double, quiet_policy>(-2));
+   CHECK_NAN(pdf(g, 1.0));
+   auto b = freeze(boost::math::beta_distribution<double, quiet_policy>(-1, 2));
+   CHECK_NAN(pdf(b, 0.5));
+}
+
+int main()
+{
+   test_distributions<float>();
+   test_distributions<double>();
+   test_distributions<long double>();
+   test_gamma_underflow<float>();
+   test_gamma_underflow<double>();
+   test_gamma_underflow<long double>();
+   test_errors();
+   return boost::math::test::report_errors();
+}
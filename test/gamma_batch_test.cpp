@@ -0,0 +1,118 @@
+//  Copyright Boost.Math contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "math_unit_test.hpp"
+#include <vector>
+#include <list>
+#include <random>
+#include <iterator>
+#include <stdexcept>
+#include <boost/math/special_functions/gamma.hpp>
+
+using boost::math::policies::policy;
+using boost::math::policies::pole_error;
+using boost::math::policies::overflow_error;
+using boost::math::policies::underflow_error;
+using boost::math::policies::ignore_error;
+
+typedef policy<pole_error<ignore_error>, overflow_error<ignore_error>, underflow_error<ignore_error> > quiet_policy;
+
+//
+// The batched versions of tgamma and lgamma must agree with the scalar
+// versions for every argument, including those which overflow, underflow
+// or sit on a pole.  The Lanczos sum may be evaluated with a different
+// Horner scheme in the batched code, hence the small tolerance:
+//
+template <class Real>
+void test_gamma_batch()
+{
+   std::vector<Real> x { 0, 1, 2, 5, Real(0.5), Real(1e-20), Real(15), Real(15.5), Real(99.5), Real(100), Real(171.5), Real(-20.5), Real(-15.5), Real(-100.5), Real(-0.5), Real(-200.25) };
+   std::mt19937_64 gen(31415);
+   std::uniform_real_distribution<Real> small(-25, 25);
+   std::uniform_real_distribution<Real> large(-200, 200);
+   for (unsigned i = 0; i < 2000; ++i)
+   {
+      x.push_back(i & 1 ? small(gen) : large(gen));
+   }
+   std::vector<Real> y(x.size());
+
+   auto it = boost::math::tgamma(x.begin(), x.end(), y.begin(), quiet_policy());
+   CHECK_EQUAL(it == y.end(), true);
+   for (std::size_t i = 0; i < x.size(); ++i)
+   {
+      Real expected = boost::math::tgamma(x[i], quiet_policy());
+      if ((boost::math::isnan)(expected))
+      {
+         CHECK_NAN(y[i]);
+         continue;
+      }
+      if (expected == y[i])
+      {
+         continue;
+      }
+      CHECK_ULP_CLOSE(expected, y[i], 2);
+   }
+
+   boost::math::lgamma(x.begin(), x.end(), y.begin(), quiet_policy());
+   for (std::size_t i = 0; i < x.size(); ++i)
+   {
+      Real expected = boost::math::lgamma(x[i], quiet_policy());
+      if ((boost::math::isnan)(expected))
+      {
+         CHECK_NAN(y[i]);
+         continue;
+      }
+      if (expected == y[i])
+      {
+         continue;
+      }
+      CHECK_ULP_CLOSE(expected, y[i], 2);
+   }
+}
+
+void test_iterators()
+{
+   // Non-contiguous input, inserting output, and integer arguments:
+   std::list<int> x { 1, 3, 7, 20, 30 };
+   std::vector<double> y;
+   boost::math::tgamma(x.begin(), x.end(), std::back_inserter(y));
+   CHECK_EQUAL(y.size(), x.size());
+   std::size_t i = 0;
+   for (int v : x)
+   {
+      CHECK_EQUAL(boost::math::tgamma(v), y[i++]);
+   }
+   // The incomplete gamma function must not be hijacked by the batched overloads:
+   CHECK_ULP_CLOSE(boost::math::tgamma(2.0, 3.0), 4 * std::exp(-3.0), 4);
+   CHECK_ULP_CLOSE(boost::math::tgamma(2.0, 3.0, policy<>()), 4 * std::exp(-3.0), 4);
+}
+
+void test_errors()
+{
+#ifndef BOOST_NO_EXCEPTIONS
+   std::vector<double> x { 2.5, -3, 4.5 };
+   std::vector<double> y(x.size());
+   bool thrown = false;
+   try
+   {
+      boost::math::tgamma(x.begin(), x.end(), y.begin());
+   }
+   catch (const std::domain_error&)
+   {
+      thrown = true;
+   }
+   CHECK_EQUAL(thrown, true);
+#endif
+}
+
+int main()
+{
+   test_gamma_batch<float>();
+   test_gamma_batch<double>();
+   test_gamma_batch<long double>();
+   test_iterators();
+   test_errors();
+   return boost::math::test::report_errors();
+}
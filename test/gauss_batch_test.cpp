@@ -0,0 +1,137 @@
+//  Copyright Boost.Math contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "math_unit_test.hpp"
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <boost/math/constants/constants.hpp>
+#include <boost/math/quadrature/gauss.hpp>
+#include <boost/math/quadrature/gauss_kronrod.hpp>
+
+using boost::math::quadrature::gauss;
+using boost::math::quadrature::gauss_kronrod;
+
+// Wraps a scalar function as a batch integrand, counting calls and points:
+template<class Real, class F>
+class batch
+{
+public:
+    batch(F f, std::size_t& calls, std::size_t& points) : f_(f), calls_(&calls), points_(&points) {}
+
+    void operator()(const Real* x, Real* y, std::size_t n) const
+    {
+        ++*calls_;
+        *points_ += n;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            y[i] = f_(x[i]);
+        }
+    }
+
+private:
+    F f_;
+    std::size_t* calls_;
+    std::size_t* points_;
+};
+
+template<class Real, class F>
+batch<Real, F> make_batch(F f, std::size_t& calls, std::size_t& points)
+{
+    return batch<Real, F>(f, calls, points);
+}
+
+template<class Real, unsigned Points>
+void test_gauss()
+{
+    using std::exp;
+    using std::cos;
+    using std::sqrt;
+    using boost::math::constants::pi;
+    typedef gauss<Real, Points> integrator;
+    const Real inf = std::numeric_limits<Real>::infinity();
+    auto f = [](Real x) { return exp(x)*cos(x); };
+    auto g = [](Real x) { return 1/(1 + x*x); };
+
+    // Over (-1, 1) and finite ranges, the nodes, values and sums are exactly those of the scalar rule:
+    std::size_t calls = 0;
+    std::size_t points = 0;
+    Real L1, scalar_L1;
+    Real Q = integrator::integrate(make_batch<Real>(f, calls, points), &L1);
+    CHECK_EQUAL(integrator::integrate(f, &scalar_L1), Q);
+    CHECK_EQUAL(scalar_L1, L1);
+    CHECK_EQUAL(calls, std::size_t(1));
+    CHECK_EQUAL(points, std::size_t(Points));
+    Q = integrator::integrate(make_batch<Real>(f, calls, points), Real(-2), Real(3), &L1);
+    CHECK_EQUAL(integrator::integrate(f, Real(-2), Real(3), &scalar_L1), Q);
+    CHECK_EQUAL(scalar_L1, L1);
+    CHECK_EQUAL(-Q, integrator::integrate(make_batch<Real>(f, calls, points), Real(3), Real(-2)));
+    CHECK_EQUAL(calls, std::size_t(3));
+
+    // Infinite ranges share their changes of variables with the scalar rule too:
+    CHECK_EQUAL(integrator::integrate(g, -inf, inf), integrator::integrate(make_batch<Real>(g, calls, points), -inf, inf));
+    CHECK_EQUAL(integrator::integrate(g, Real(1), inf), integrator::integrate(make_batch<Real>(g, calls, points), Real(1), inf));
+    CHECK_EQUAL(integrator::integrate(g, -inf, Real(1)), integrator::integrate(make_batch<Real>(g, calls, points), -inf, Real(1)));
+}
+
+template<class Real, unsigned Points>
+void test_gauss_kronrod()
+{
+    using std::exp;
+    using std::cos;
+    using std::sin;
+    using std::sqrt;
+    using boost::math::constants::pi;
+    typedef gauss_kronrod<Real, Points> integrator;
+    const Real inf = std::numeric_limits<Real>::infinity();
+    const Real tol = boost::math::tools::root_epsilon<Real>();
+    auto f = [](Real x) { return sin(30*x)*exp(x); };
+
+    // Each subinterval costs one call, and the result is exactly that of the scalar integrand:
+    std::size_t scalar_points = 0;
+    auto h = [&](Real x) { ++scalar_points; return f(x); };
+    Real scalar_error, scalar_L1;
+    Real Q = integrator::integrate(h, Real(0), Real(2), 15, tol, &scalar_error, &scalar_L1);
+    std::size_t calls = 0;
+    std::size_t points = 0;
+    Real error, L1;
+    CHECK_EQUAL(Q, integrator::integrate(make_batch<Real>(f, calls, points), Real(0), Real(2), 15, tol, &error, &L1));
+    CHECK_EQUAL(scalar_error, error);
+    CHECK_EQUAL(scalar_L1, L1);
+    CHECK_EQUAL(scalar_points, points);
+    CHECK_EQUAL(calls*Points, points);
+
+    scalar_points = 0;
+    points = 0;
+    Q = integrator::integrate_global(h, Real(2), Real(0), 100, tol, &scalar_error, &scalar_L1);
+    CHECK_EQUAL(Q, integrator::integrate_global(make_batch<Real>(f, calls, points), Real(2), Real(0), 100, tol, &error, &L1));
+    CHECK_EQUAL(scalar_error, error);
+    CHECK_EQUAL(scalar_points, points);
+
+    auto g = [](Real x) { return exp(-x*x); };
+    CHECK_EQUAL(integrator::integrate(g, Real(0), inf, 15, tol, &scalar_error), integrator::integrate(make_batch<Real>(g, calls, points), Real(0), inf, 15, tol, &error));
+    CHECK_EQUAL(scalar_error, error);
+    CHECK_EQUAL(integrator::integrate_global(g, -inf, inf), integrator::integrate_global(make_batch<Real>(g, calls, points), -inf, inf));
+    CHECK_ABSOLUTE_ERROR(sqrt(pi<Real>()), integrator::integrate(make_batch<Real>(g, calls, points), -inf, inf), 10*tol);
+    CHECK_ABSOLUTE_ERROR(sqrt(pi<Real>())/2, integrator::integrate(make_batch<Real>(g, calls, points), Real(0), inf), 10*tol);
+    CHECK_ABSOLUTE_ERROR(sqrt(pi<Real>())/2, integrator::integrate_global(make_batch<Real>(g, calls, points), -inf, Real(0)), 10*tol);
+}
+
+int main()
+{
+    test_gauss<float, 7>();
+    test_gauss<double, 10>();
+    test_gauss<double, 15>();
+    test_gauss<long double, 20>();
+
+    test_gauss_kronrod<float, 15>();
+    test_gauss_kronrod<double, 15>();
+    test_gauss_kronrod<double, 21>();
+    test_gauss_kronrod<double, 31>();
+    test_gauss_kronrod<double, 61>();
+    test_gauss_kronrod<long double, 41>();
+
+    return boost::math::test::report_errors();
+}
@@ -0,0 +1,105 @@
+//  Copyright Boost.Math contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "math_unit_test.hpp"
+#include <array>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <limits>
+#include <boost/math/constants/constants.hpp>
+#include <boost/math/quadrature/gauss_kronrod.hpp>
+
+using boost::math::quadrature::gauss_kronrod;
+
+template<class Real, unsigned Points>
+void test_global()
+{
+    using std::abs;
+    using std::atan;
+    using std::exp;
+    using std::sqrt;
+    using std::sin;
+    using std::cos;
+    using boost::math::constants::pi;
+    typedef gauss_kronrod<Real, Points> integrator;
+    const Real tol = boost::math::tools::root_epsilon<Real>();
+    const Real inf = std::numeric_limits<Real>::infinity();
+
+    // Smooth integrands need no subdivision:
+    std::size_t calls = 0;
+    auto f1 = [&](Real x) { ++calls; return exp(x); };
+    Real error, L1;
+    Real Q = integrator::integrate_global(f1, Real(0), Real(1), 1000, tol, &error, &L1);
+    CHECK_ULP_CLOSE(boost::math::constants::e<Real>() - 1, Q, 10);
+    CHECK_EQUAL(calls, std::size_t(Points));
+    CHECK_ULP_CLOSE(Q, L1, 10);
+    CHECK_LE(error, tol*Q);
+    CHECK_EQUAL(-Q, integrator::integrate_global(f1, Real(1), Real(0)));
+    CHECK_EQUAL(Real(0), integrator::integrate_global(f1, Real(1), Real(1)));
+
+    // A sharp peak: refinement concentrates on it, using fewer evaluations than the depth first scheme:
+    const Real c = Real(0.3);
+    const Real w = Real(1e-3);
+    std::size_t global_calls = 0;
+    auto f2 = [&](Real x) { ++global_calls; return w / ((x - c)*(x - c) + w*w); };
+    const Real exact = atan((1 - c)/w) + atan(c/w);
+    Q = integrator::integrate_global(f2, Real(0), Real(1), 1000, tol, &error, &L1);
+    CHECK_ABSOLUTE_ERROR(exact, Q, 10*tol*exact);
+    CHECK_LE(abs(exact - Q), 10*error);
+    std::size_t recursive_calls = 0;
+    auto g2 = [&](Real x) { ++recursive_calls; return w / ((x - c)*(x - c) + w*w); };
+    Real R = integrator::integrate(g2, Real(0), Real(1), 15, tol);
+    CHECK_ABSOLUTE_ERROR(exact, R, 10*tol*exact);
+    CHECK_LE(global_calls, recursive_calls);
+
+    // An integral which vanishes through cancellation: the tolerance is relative to the L1 norm, so this
+    // terminates no later than the depth first scheme does, rather than after max_intervals bisections:
+    global_calls = 0;
+    auto f6 = [&](Real x) { ++global_calls; return x*exp(x) - 1; };
+    Q = integrator::integrate_global(f6, Real(0), Real(1), 1000, tol, &error, &L1);
+    CHECK_ABSOLUTE_ERROR(Real(0), Q, 10*tol*L1);
+    CHECK_LE(error, tol*L1);
+    recursive_calls = 0;
+    auto g6 = [&](Real x) { ++recursive_calls; return x*exp(x) - 1; };
+    integrator::integrate(g6, Real(0), Real(1), 15, tol);
+    CHECK_LE(global_calls, recursive_calls);
+
+    // The number of subintervals is bounded:
+    global_calls = 0;
+    integrator::integrate_global(f2, Real(0), Real(1), 4, tol);
+    CHECK_EQUAL(global_calls, std::size_t(7*Points));
+    global_calls = 0;
+    integrator::integrate_global(f2, Real(0), Real(1), 0, tol);
+    CHECK_EQUAL(global_calls, std::size_t(Points));
+
+    // Infinite ranges:
+    auto f3 = [](Real x) { return exp(-x*x); };
+    CHECK_ABSOLUTE_ERROR(sqrt(pi<Real>()), integrator::integrate_global(f3, -inf, inf), 10*tol);
+    CHECK_ABSOLUTE_ERROR(sqrt(pi<Real>())/2, integrator::integrate_global(f3, Real(0), inf), 10*tol);
+    CHECK_ABSOLUTE_ERROR(sqrt(pi<Real>())/2, integrator::integrate_global(f3, -inf, Real(0)), 10*tol);
+
+    // Complex and vector valued integrands:
+    auto f4 = [](Real x) { return std::complex<Real>(cos(10*x), sin(10*x)); };
+    std::complex<Real> z = integrator::integrate_global(f4, Real(0), Real(1));
+    CHECK_ABSOLUTE_ERROR(sin(Real(10))/10, z.real(), 10*tol);
+    CHECK_ABSOLUTE_ERROR((1 - cos(Real(10)))/10, z.imag(), 10*tol);
+    auto f5 = [](Real x) { return std::array<Real, 2>{{cos(10*x), sin(10*x)}}; };
+    std::array<Real, 2> v = integrator::integrate_global(f5, Real(0), Real(1));
+    CHECK_ABSOLUTE_ERROR(sin(Real(10))/10, v[0], 10*tol);
+    CHECK_ABSOLUTE_ERROR((1 - cos(Real(10)))/10, v[1], 10*tol);
+}
+
+int main()
+{
+    test_global<float, 15>();
+    test_global<double, 15>();
+    test_global<double, 21>();
+    test_global<double, 31>();
+    test_global<long double, 15>();
+    test_global<long double, 61>();
+
+    return boost::math::test::report_errors();
+}
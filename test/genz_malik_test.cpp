@@ -0,0 +1,321 @@
+//  Copyright Boost.Math contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "math_unit_test.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <boost/math/constants/constants.hpp>
+#include <boost/math/quadrature/genz_malik.hpp>
+#include <boost/math/tools/thread_pool.hpp>
+
+using boost::math::quadrature::genz_malik;
+using boost::math::tools::thread_pool;
+
+// A minimal executor, running each task on the calling thread in reverse order:
+struct reversed_executor
+{
+    unsigned concurrency() const
+    {
+        return 3;
+    }
+
+    template<class F>
+    void bulk_execute(std::size_t n, F&& f) const
+    {
+        while (n)
+        {
+            f(--n);
+        }
+    }
+};
+
+// Runs the tasks in order on the calling thread, counting the bulk submissions:
+struct counting_executor
+{
+    unsigned concurrency() const
+    {
+        return 4;
+    }
+
+    template<class F>
+    void bulk_execute(std::size_t n, F&& f) const
+    {
+        ++submissions;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            f(i);
+        }
+    }
+
+    mutable std::size_t submissions = 0;
+};
+
+template<class Real>
+std::size_t rule_points(std::size_t d)
+{
+    return (std::size_t(1) << d) + 2*d*d + 2*d + 1;
+}
+
+// A single application of the rule integrates polynomials of degree 7 exactly:
+template<class Real>
+void test_degree()
+{
+    for (std::size_t d = 2; d <= 5; ++d)
+    {
+        std::vector<std::pair<Real, Real>> bounds(d, std::make_pair(Real(-1), Real(2)));
+        bounds[0] = std::make_pair(Real(0.5), Real(1.5));
+        genz_malik<Real> integrator(rule_points<Real>(d));
+        std::size_t evaluations;
+        // x0^7 + x0^3 x1^4 + x0 x1 ... x_{d-1} + 1:
+        auto f = [](const std::vector<Real>& x)
+        {
+            Real product = 1;
+            for (Real xi : x)
+            {
+                product *= xi;
+            }
+            Real x0 = x[0];
+            Real x1 = x[1];
+            return x0*x0*x0*x0*x0*x0*x0 + x0*x0*x0*x1*x1*x1*x1 + product + 1;
+        };
+        Real rest = 1;
+        Real mean = 1;
+        for (std::size_t i = 2; i < d; ++i)
+        {
+            rest *= 3;
+            mean *= Real(1.5);
+        }
+        // Integrals over [0.5, 1.5] of x^7, x^3, x and 1, and over [-1, 2] of x^4, x and 1:
+        Real i7 = (Real(6561)/256 - Real(1)/256)/8;
+        Real i3 = (Real(81)/16 - Real(1)/16)/4;
+        Real exact = 3*rest*i7 + i3*(Real(33)/5)*rest + 1*Real(1.5)*mean + 3*rest;
+        Real Q = integrator.integrate(f, bounds, boost::math::tools::root_epsilon<Real>(), nullptr, nullptr, &evaluations);
+        CHECK_EQUAL(evaluations, rule_points<Real>(d));
+        CHECK_ULP_CLOSE(exact, Q, 64);
+    }
+}
+
+template<class Real>
+void test_integrals()
+{
+    using std::exp;
+    using std::cos;
+    using std::sin;
+    using std::pow;
+    using boost::math::constants::pi;
+    // The degree 5 error estimate is pessimistic, so in six dimensions this is as far as a million evaluations go:
+    const Real tol = (std::max)(boost::math::tools::root_epsilon<Real>(), Real(1e-6));
+    genz_malik<Real> integrator;
+
+    // Separable integrands in 2 to 6 dimensions:
+    for (std::size_t d = 2; d <= 6; ++d)
+    {
+        std::vector<std::pair<Real, Real>> bounds(d, std::make_pair(Real(0), Real(1)));
+        auto f = [](const std::vector<Real>& x)
+        {
+            Real s = 0;
+            for (Real xi : x)
+            {
+                s += xi;
+            }
+            return exp(s);
+        };
+        Real error, L1;
+        std::size_t evaluations;
+        Real Q = integrator.integrate(f, bounds, tol, &error, &L1, &evaluations);
+        Real exact = pow(boost::math::constants::e<Real>() - 1, static_cast<Real>(d));
+        CHECK_ABSOLUTE_ERROR(exact, Q, 10*tol*exact);
+        CHECK_ULP_CLOSE(Q, L1, 10);
+        CHECK_LE(error, tol*Q);
+        CHECK_LE(evaluations, std::size_t(1000000));
+        CHECK_EQUAL(std::size_t(0), (evaluations - rule_points<Real>(d)) % (2*rule_points<Real>(d)));
+
+        auto g = [](const std::vector<Real>& x)
+        {
+            Real p = 1;
+            for (Real xi : x)
+            {
+                p *= cos(xi);
+            }
+            return p;
+        };
+        Q = integrator.integrate(g, bounds, tol);
+        exact = pow(sin(Real(1)), static_cast<Real>(d));
+        CHECK_ABSOLUTE_ERROR(exact, Q, 10*tol*exact);
+    }
+
+    // A sharp peak in three dimensions, where adaptivity matters:
+    std::vector<std::pair<Real, Real>> cube(3, std::make_pair(Real(-1), Real(1)));
+    auto peak = [](const std::vector<Real>& x)
+    {
+        Real r2 = (x[0] - Real(0.2))*(x[0] - Real(0.2)) + (x[1] + Real(0.1))*(x[1] + Real(0.1)) + x[2]*x[2];
+        return exp(-100*r2);
+    };
+    Real exact = pow(pi<Real>()/100, Real(1.5));
+    const Real peak_tol = (std::max)(boost::math::tools::root_epsilon<Real>(), Real(1e-5));
+    Real error;
+    Real Q = integrator.integrate(peak, cube, peak_tol, &error);
+    CHECK_ABSOLUTE_ERROR(exact, Q, peak_tol*exact);
+    CHECK_LE(error, peak_tol*Q);
+
+    // An integral which vanishes through cancellation: the tolerance is relative to the L1 norm,
+    // so this converges rather than using up all the evaluations:
+    std::vector<std::pair<Real, Real>> square(2, std::make_pair(Real(0), Real(1)));
+    auto zero = [](const std::vector<Real>& x) { return (x[0]*exp(x[0]) - 1)*(1 + x[1]); };
+    Real L1;
+    std::size_t evaluations;
+    Q = integrator.integrate(zero, square, tol, &error, &L1, &evaluations);
+    CHECK_ABSOLUTE_ERROR(Real(0), Q, 10*tol*L1);
+    CHECK_LE(error, tol*L1);
+    CHECK_LE(evaluations, std::size_t(1000));
+}
+
+template<class Real, class Executor>
+void test_executor(Executor& exec)
+{
+    using std::abs;
+    using std::exp;
+    genz_malik<Real> integrator;
+    const Real tol = boost::math::tools::root_epsilon<Real>();
+    const std::size_t points = rule_points<Real>(3);
+    std::vector<std::pair<Real, Real>> bounds = { {Real(0), Real(1)}, {Real(-1), Real(1)}, {Real(0), Real(2)} };
+    std::atomic<std::size_t> serial_calls {0};
+    std::atomic<std::size_t> parallel_calls {0};
+    auto make = [](std::atomic<std::size_t>& calls)
+    {
+        return [&calls](const std::vector<Real>& x)
+        {
+            ++calls;
+            return exp(-10*(x[0]*x[0] + x[1]*x[1])) * (1 + x[2]);
+        };
+    };
+    Real serial_error, serial_L1, parallel_error, parallel_L1;
+    std::size_t serial_evaluations, parallel_evaluations;
+    Real serial = integrator.integrate(make(serial_calls), bounds, tol, &serial_error, &serial_L1, &serial_evaluations);
+    Real parallel = integrator.integrate(exec, make(parallel_calls), bounds, tol, &parallel_error, &parallel_L1, &parallel_evaluations);
+    CHECK_EQUAL(serial_calls.load(), serial_evaluations);
+    CHECK_EQUAL(parallel_calls.load(), parallel_evaluations);
+    CHECK_EQUAL(std::size_t(0), (parallel_evaluations - points) % (2*points));
+    CHECK_LE(parallel_error, tol*parallel_L1);
+    if (exec.concurrency() == 1)
+    {
+        // One subregion is bisected per round, exactly as in the sequential version:
+        CHECK_EQUAL(serial, parallel);
+        CHECK_EQUAL(serial_error, parallel_error);
+        CHECK_EQUAL(serial_L1, parallel_L1);
+        CHECK_EQUAL(serial_evaluations, parallel_evaluations);
+    }
+    else
+    {
+        CHECK_LE(abs(serial - parallel), serial_error + parallel_error);
+    }
+
+#ifndef BOOST_NO_EXCEPTIONS
+    // Exceptions thrown by the integrand reach the caller:
+    int thrown = 0;
+    try
+    {
+        integrator.integrate(exec, [](const std::vector<Real>& x) -> Real { if (x[0] > Real(0.9)) throw std::runtime_error("Bad x"); return x[0]; }, bounds);
+    }
+    catch (const std::runtime_error&)
+    {
+        ++thrown;
+    }
+    CHECK_EQUAL(thrown, 1);
+#endif
+}
+
+// Each round bisects concurrency() subregions, with all their nodes in a single bulk submission:
+template<class Real>
+void test_batches()
+{
+    using std::exp;
+    genz_malik<Real> integrator;
+    const Real tol = Real(1e-6);
+    const std::size_t points = rule_points<Real>(3);
+    std::vector<std::pair<Real, Real>> cube(3, std::make_pair(Real(-1), Real(1)));
+    auto peak = [](const std::vector<Real>& x) { return exp(-20*(x[0]*x[0] + x[1]*x[1] + x[2]*x[2])); };
+    std::size_t serial_evaluations, parallel_evaluations;
+    integrator.integrate(peak, cube, tol, nullptr, nullptr, &serial_evaluations);
+    counting_executor exec;
+    integrator.integrate(exec, peak, cube, tol, nullptr, nullptr, &parallel_evaluations);
+    const std::size_t serial_rounds = 1 + (serial_evaluations - points) / (2*points);
+    const std::size_t parallel_halves = (parallel_evaluations - points) / points;
+    CHECK_LE(exec.submissions, 1 + parallel_halves / 2);
+    CHECK_LE(2*(exec.submissions - 1), parallel_halves);
+    CHECK_LE(2*exec.submissions, serial_rounds);
+    CHECK_LE(parallel_evaluations, std::size_t(1000000) - 2*points);
+}
+
+template<class Real>
+void test_domain_errors()
+{
+#ifndef BOOST_NO_EXCEPTIONS
+    genz_malik<Real> integrator;
+    auto f = [](const std::vector<Real>&) { return Real(1); };
+    const Real inf = std::numeric_limits<Real>::infinity();
+    std::vector<std::vector<std::pair<Real, Real>>> bad = {
+        { {Real(0), Real(1)} },
+        { {Real(0), Real(1)}, {Real(0), inf} },
+        { {Real(0), Real(1)}, {Real(1), Real(0)} },
+        { {Real(0), Real(1)}, {Real(1), Real(1)} } };
+    for (const auto& bounds : bad)
+    {
+        int thrown = 0;
+        try
+        {
+            integrator.integrate(f, bounds);
+        }
+        catch (const std::domain_error&)
+        {
+            ++thrown;
+        }
+        CHECK_EQUAL(thrown, 1);
+    }
+
+    // Too few evaluations for even a single application of the rule:
+    genz_malik<Real> tiny(rule_points<Real>(3) - 1);
+    int thrown = 0;
+    try
+    {
+        tiny.integrate(f, std::vector<std::pair<Real, Real>>(3, std::make_pair(Real(0), Real(1))));
+    }
+    catch (const std::domain_error&)
+    {
+        ++thrown;
+    }
+    CHECK_EQUAL(thrown, 1);
+#endif
+}
+
+int main()
+{
+    test_degree<float>();
+    test_degree<double>();
+    test_degree<long double>();
+
+    test_integrals<float>();
+    test_integrals<double>();
+    test_integrals<long double>();
+
+    thread_pool pool(4);
+    test_executor<double>(pool);
+    thread_pool single(1);
+    test_executor<double>(single);
+    reversed_executor reversed;
+    test_executor<double>(reversed);
+    test_batches<double>();
+
+    test_domain_errors<double>();
+
+    return boost::math::test::report_errors();
+}
@@ -0,0 +1,130 @@
+//  Copyright Boost.Math contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "math_unit_test.hpp"
+#include <vector>
+#include <random>
+#include <limits>
+#include <stdexcept>
+#include <boost/math/distributions/inverse_cdf_table.hpp>
+#include <boost/math/distributions/students_t.hpp>
+#include <boost/math/distributions/non_central_t.hpp>
+#include <boost/math/distributions/beta.hpp>
+#include <boost/math/distributions/gamma.hpp>
+#include <boost/math/distributions/normal.hpp>
+
+using boost::math::inverse_cdf_table;
+using boost::math::complement;
+
+//
+// The tolerance is only checked at the centre of each interval during
+// construction, so allow a little slack elsewhere, plus the change in
+// the cdf from rounding x, which dominates at float precision:
+//
+template <class Dist>
+void test_table(const Dist& dist)
+{
+   typedef typename Dist::value_type Real;
+   using std::abs;
+   inverse_cdf_table<Dist> table(dist);
+   Real tol = table.tolerance();
+   CHECK_LE(table.size(), std::size_t(100000));
+
+   std::mt19937_64 gen(314159);
+   std::uniform_real_distribution<Real> unif(0, 1);
+   std::vector<Real> u { table.table_range().first, table.table_range().second, Real(0.5), Real(1e-3), Real(0.999) };
+   for (unsigned i = 0; i < 2000; ++i)
+   {
+      u.push_back(unif(gen));
+   }
+   for (Real v : u)
+   {
+      Real x = table(v);
+      Real err = v < Real(0.5) ? Real(cdf(dist, x) - v) : Real((1 - v) - cdf(complement(dist, x)));
+      Real rounding = 4 * std::numeric_limits<Real>::epsilon() * abs(x) * pdf(dist, x);
+      CHECK_LE(abs(err), 4 * tol + rounding);
+      // Monotone with the interpolated result:
+      CHECK_LE(table(v * Real(0.9995)), x);
+      // A Newton step gets (much) closer to the true quantile:
+      Real q = quantile(dist, v);
+      Real p = table.polished(v);
+      CHECK_LE(abs(p - q), abs(x - q) + 16 * std::numeric_limits<Real>::epsilon() * abs(q));
+   }
+   // Outside the tabulated range the exact quantile is used:
+   for (Real v : { tol / 4, 1 - tol / 4 })
+   {
+      CHECK_EQUAL(table(v), quantile(dist, v));
+      CHECK_EQUAL(table.polished(v), quantile(dist, v));
+   }
+}
+
+template <class Real>
+void test_distributions()
+{
+   for (Real df : { Real(1), Real(5.5), Real(300) })
+   {
+      test_table(boost::math::students_t_distribution<Real>(df));
+   }
+   test_table(boost::math::non_central_t_distribution<Real>(Real(5), Real(2)));
+   test_table(boost::math::non_central_t_distribution<Real>(Real(12), Real(-1.5)));
+   test_table(boost::math::beta_distribution<Real>(Real(0.5), Real(5)));
+   test_table(boost::math::beta_distribution<Real>(Real(2), Real(5)));
+   if (std::numeric_limits<Real>::digits > 24)
+   {
+      // In float the upper quantiles round to 1, which is too far from u:
+      test_table(boost::math::beta_distribution<Real>(Real(0.5), Real(0.5)));
+   }
+   test_table(boost::math::gamma_distribution<Real>(Real(0.3)));
+   test_table(boost::math::gamma_distribution<Real>(Real(7.5), Real(2)));
+   test_table(boost::math::normal_distribution<Real>(Real(1), Real(3)));
+}
+
+void test_options()
+{
+   boost::math::gamma_distribution<double> g(3);
+   // Tighter tolerances need more intervals:
+   inverse_cdf_table<boost::math::gamma_distribution<double> > coarse(g, 1e-6), fine(g, 1e-12);
+   CHECK_EQUAL(coarse.tolerance(), 1e-6);
+   CHECK_LE(coarse.size(), fine.size());
+   CHECK_LE(std::abs(cdf(g, fine(0.3)) - 0.3), 4e-12);
+   // The tail left to quantile() may be set independently:
+   inverse_cdf_table<boost::math::gamma_distribution<double> > t(g, 1e-8, 0.01);
+   CHECK_EQUAL(t.table_range().first, 0.01);
+   CHECK_EQUAL(t.table_range().second, 0.99);
+   CHECK_EQUAL(t(0.005), quantile(g, 0.005));
+   CHECK_EQUAL(t.distribution().shape(), 3.0);
+
+#ifndef BOOST_NO_EXCEPTIONS
+   // Probabilities outside [0,1] are domain errors, as for quantile:
+   bool thrown = false;
+   try
+   {
+      t(1.5);
+   }
+   catch (const std::domain_error&)
+   {
+      thrown = true;
+   }
+   CHECK_EQUAL(thrown, true);
+   thrown = false;
+   try
+   {
+      t(std::numeric_limits<double>::quiet_NaN());
+   }
+   catch (const std::domain_error&)
+   {
+      thrown = true;
+   }
+   CHECK_EQUAL(thrown, true);
+#endif
+}
+
+int main()
+{
+   test_distributions<float>();
+   test_distributions<double>();
+   test_options();
+   return boost::math::test::report_errors();
+}
@@ -9,6 +9,8 @@
 #include <numeric>
 #include <utility>
 #include <random>
+#include <algorithm>
+#include <vector>
 #include <boost/math/interpolators/makima.hpp>
 #include <boost/circular_buffer.hpp>
 #ifdef BOOST_HAS_FLOAT128
@@ -163,20 +165,59 @@ void test_interpolation_condition()
     }
 }
 
+template<typename Real>
+void test_batch()
+{
+    std::mt19937 gen(1234);
+    std::uniform_real_distribution<Real> dis(0.1,1);
+    size_t n = 200;
+    std::vector<Real> x(n);
+    std::vector<Real> y(n);
+    x[0] = dis(gen);
+    y[0] = dis(gen);
+    for (size_t i = 1; i < n; ++i) {
+        x[i] = x[i-1] + dis(gen);
+        y[i] = dis(gen);
+    }
+    std::uniform_real_distribution<Real> in_domain(x.front(), x.back());
+    std::vector<Real> t(1000);
+    for (auto & ti : t) {
+        ti = in_domain(gen);
+    }
+    t.push_back(x.back());
+    auto s = makima(std::move(x), std::move(y));
+    std::vector<Real> v(t.size());
+    std::vector<Real> dv(t.size());
+    for (int sorted = 0; sorted < 2; ++sorted) {
+        if (sorted) {
+            std::sort(t.begin(), t.end());
+        }
+        s(t.begin(), t.end(), v.begin());
+        s.prime(t.begin(), t.end(), dv.begin());
+        for (size_t i = 0; i < t.size(); ++i) {
+            CHECK_EQUAL(s(t[i]), v[i]);
+            CHECK_EQUAL(s.prime(t[i]), dv[i]);
+        }
+    }
+}
+
 int main()
 {
 #if (__GNUC__ > 7) || defined(_MSC_VER) || defined(__clang__)
     test_constant<float>();
     test_linear<float>();
     test_interpolation_condition<float>();
+    test_batch<float>();
 
     test_constant<double>();
     test_linear<double>();
     test_interpolation_condition<double>();
+    test_batch<double>();
 
     test_constant<long double>();
     test_linear<long double>();
     test_interpolation_condition<long double>();
+    test_batch<long double>();
 
 #ifdef BOOST_HAS_FLOAT128
     test_constant<float128>();
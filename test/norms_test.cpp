@@ -795,6 +795,104 @@ void test_complex_sup_distance()
     BOOST_TEST(abs(dist1 - dist2) < tol*dist1);
 }
 
+// The contiguous memory fast paths must agree with the forward iterator versions:
+template<class Real>
+void test_contiguous()
+{
+    Real tol = 64*std::numeric_limits<Real>::epsilon();
+    for (size_t n : {1, 2, 7, 8, 9, 31, 64, 257, 1000, 5000})
+    {
+        std::vector<Real> v = generate_random_vector<Real>(n, global_seed + n);
+        std::vector<Real> w = generate_random_vector<Real>(n, global_seed + 2*n);
+        std::forward_list<Real> lv(v.begin(), v.end());
+        std::forward_list<Real> lw(w.begin(), w.end());
+
+        BOOST_TEST(abs(l1_norm(v) - l1_norm(lv.begin(), lv.end())) <= tol*l1_norm(v));
+        BOOST_TEST(abs(l2_norm(v) - l2_norm(lv.begin(), lv.end())) <= tol*l2_norm(v));
+        BOOST_TEST_EQ(sup_norm(v), sup_norm(lv.begin(), lv.end()));
+        BOOST_TEST(abs(lp_norm(v, 3) - lp_norm(lv.begin(), lv.end(), 3)) <= tol*lp_norm(v, 3));
+        BOOST_TEST(abs(lp_norm(v, 8) - lp_norm(lv.begin(), lv.end(), 8)) <= tol*lp_norm(v, 8));
+        BOOST_TEST(abs(l1_distance(v, w) - l1_distance(lv.begin(), lv.end(), lw.begin())) <= tol*l1_distance(v, w));
+        BOOST_TEST(abs(l2_distance(v, w) - l2_distance(lv.begin(), lv.end(), lw.begin())) <= tol*l2_distance(v, w));
+        BOOST_TEST_EQ(sup_distance(v, w), sup_distance(lv.begin(), lv.end(), lw.begin()));
+        BOOST_TEST(abs(lp_distance(v, w, 5) - lp_distance(lv.begin(), lv.end(), lw.begin(), 5)) <= tol*lp_distance(v, w, 5));
+        if (n > 1)
+        {
+            BOOST_TEST(abs(total_variation(v) - total_variation(lv.begin(), lv.end())) <= tol*total_variation(v));
+        }
+        // Raw pointers take the same path:
+        BOOST_TEST_EQ(l2_norm(v.data(), v.data() + n), l2_norm(v));
+    }
+
+    // The l2 norm neither overflows nor underflows, with the large or small
+    // values anywhere in the data:
+    std::vector<Real> v(1000, Real(1));
+    Real bignum = (std::numeric_limits<Real>::max)()/8;
+    Real expected = sqrt(Real(v.size() - 1));
+    for (size_t i : {size_t(0), size_t(300), size_t(999)})
+    {
+        v[i] = bignum;
+        BOOST_TEST(abs(l2_norm(v) - bignum) <= tol*bignum);
+        v[i] = 1;
+    }
+    Real tiny = 4*(std::numeric_limits<Real>::min)();
+    for (auto& x : v)
+    {
+        x = tiny;
+    }
+    expected = tiny*sqrt(Real(v.size()));
+    BOOST_TEST(abs(l2_norm(v) - expected) <= tol*expected);
+    v[500] = -3*tiny;
+    expected = tiny*sqrt(Real(v.size() + 8));
+    BOOST_TEST(abs(l2_norm(v) - expected) <= tol*expected);
+
+    std::fill(v.begin(), v.end(), Real(0));
+    BOOST_TEST_EQ(l2_norm(v), Real(0));
+    v[3] = std::numeric_limits<Real>::infinity();
+    BOOST_TEST_EQ(l2_norm(v), std::numeric_limits<Real>::infinity());
+    v[7] = std::numeric_limits<Real>::quiet_NaN();
+    BOOST_TEST(std::isnan(l2_norm(v)));
+
+    // The lp norm falls back to scaling on overflow:
+    std::fill(v.begin(), v.end(), sqrt((std::numeric_limits<Real>::max)())/256);
+    expected = v[0]*pow(Real(v.size()), Real(1)/Real(4));
+    BOOST_TEST(abs(lp_norm(v, 4) - expected) <= tol*expected);
+
+    // and on underflow, on both paths:
+    std::fill(v.begin(), v.end(), 64*(std::numeric_limits<Real>::min)());
+    v[10] = 0;
+    std::forward_list<Real> lv(v.begin(), v.end());
+    expected = v[0]*pow(Real(v.size() - 1), Real(1)/Real(3));
+    BOOST_TEST(abs(lp_norm(v, 3) - expected) <= tol*expected);
+    BOOST_TEST(abs(lp_norm(lv.begin(), lv.end(), 3) - expected) <= tol*expected);
+    std::fill(v.begin(), v.end(), Real(0));
+    BOOST_TEST_EQ(lp_norm(v, 3), Real(0));
+
+    // A NaN anywhere, in any lane, is propagated by the sup norm and distance, as by the other norms:
+    std::vector<Real> w(37);
+    for (size_t i = 0; i < w.size(); ++i)
+    {
+        w[i] = Real(i + 1);
+    }
+    std::vector<Real> zero(w.size(), Real(0));
+    for (size_t i : {size_t(0), size_t(1), size_t(17), size_t(35), size_t(36)})
+    {
+        std::vector<Real> u = w;
+        u[i] = std::numeric_limits<Real>::quiet_NaN();
+        std::forward_list<Real> lu(u.begin(), u.end());
+        std::forward_list<Real> lz(zero.begin(), zero.end());
+        BOOST_TEST(std::isnan(sup_norm(u)));
+        BOOST_TEST(std::isnan(sup_norm(lu.begin(), lu.end())));
+        BOOST_TEST(std::isnan(sup_distance(u, zero)));
+        BOOST_TEST(std::isnan(sup_distance(zero, u)));
+        BOOST_TEST(std::isnan(sup_distance(lu.begin(), lu.end(), lz.begin())));
+        BOOST_TEST(std::isnan(lp_norm(u, 3)));
+        BOOST_TEST(std::isnan(lp_norm(lu.begin(), lu.end(), 3)));
+    }
+    std::vector<Real> u {1, std::numeric_limits<Real>::quiet_NaN(), 2};
+    BOOST_TEST(std::isnan(sup_norm(u)));
+}
+
 int main()
 {
     test_l0_pseudo_norm<unsigned>();
@@ -908,5 +1006,9 @@ int main()
     test_integer_total_variation<uint32_t>();
     test_integer_total_variation<int>();
 
+    test_contiguous<float>();
+    test_contiguous<double>();
+    test_contiguous<long double>();
+
     return boost::report_errors();
 }
@@ -0,0 +1,107 @@
+//  Copyright Boost.Math contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "math_unit_test.hpp"
+#include <cmath>
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <boost/math/quadrature/tanh_sinh.hpp>
+#include <boost/math/quadrature/exp_sinh.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+
+using boost::math::quadrature::tanh_sinh;
+using boost::math::quadrature::exp_sinh;
+using boost::multiprecision::cpp_bin_float_50;
+
+template<class Real>
+void test_tanh_sinh_round_trip()
+{
+    using std::log;
+    using std::sqrt;
+    auto f = [](Real x) { return log(x)*sqrt(1 - x*x); };
+    Real tol = boost::math::tools::epsilon<Real>();
+    tanh_sinh<Real> integrator;
+    std::size_t levels;
+    Real Q = integrator.integrate(f, Real(0), Real(1), tol, nullptr, nullptr, &levels);
+    std::stringstream ss;
+    integrator.save_nodes(ss);
+
+    // A new integrator takes the rows computed by the first, and gives the same results:
+    tanh_sinh<Real> loaded;
+    CHECK_EQUAL(loaded.load_nodes(ss), true);
+    std::stringstream ss2;
+    loaded.save_nodes(ss2);
+    CHECK_EQUAL(ss.str() == ss2.str(), true);
+    std::size_t loaded_levels;
+    Real Q2 = loaded.integrate(f, Real(0), Real(1), tol, nullptr, nullptr, &loaded_levels);
+    CHECK_EQUAL(Q, Q2);
+    CHECK_EQUAL(levels, loaded_levels);
+
+    // Loading rows which are already present changes nothing:
+    ss2.seekg(0);
+    CHECK_EQUAL(integrator.load_nodes(ss2), true);
+    CHECK_EQUAL(Q, integrator.integrate(f, Real(0), Real(1), tol));
+}
+
+template<class Real>
+void test_exp_sinh_round_trip()
+{
+    using std::exp;
+    auto f = [](Real x) { return exp(-x)/(1 + x*x); };
+    Real tol = boost::math::tools::epsilon<Real>();
+    exp_sinh<Real> integrator;
+    Real Q = integrator.integrate(f, tol);
+    std::stringstream ss;
+    integrator.save_nodes(ss);
+
+    exp_sinh<Real> loaded;
+    CHECK_EQUAL(loaded.load_nodes(ss), true);
+    std::stringstream ss2;
+    loaded.save_nodes(ss2);
+    CHECK_EQUAL(ss.str() == ss2.str(), true);
+    CHECK_EQUAL(Q, loaded.integrate(f, tol));
+}
+
+void test_mismatch()
+{
+    auto f = [](double x) { return 1/(1 + x*x); };
+    tanh_sinh<double> integrator;
+    double Q = integrator.integrate(f, 0.0, 1.0);
+    std::stringstream ss;
+    integrator.save_nodes(ss);
+    const std::string table = ss.str();
+
+    // Another type:
+    std::stringstream in(table);
+    tanh_sinh<float> float_integrator;
+    CHECK_EQUAL(float_integrator.load_nodes(in), false);
+    // Another min_complement:
+    in.str(table);
+    tanh_sinh<double> pruned(15, 1e-10);
+    CHECK_EQUAL(pruned.load_nodes(in), false);
+    // Another quadrature:
+    in.str(table);
+    exp_sinh<double> half_infinite;
+    CHECK_EQUAL(half_infinite.load_nodes(in), false);
+    // A truncated table is rejected, and the integrator is unaffected:
+    in.str(table.substr(0, table.size() - 10));
+    tanh_sinh<double> truncated;
+    CHECK_EQUAL(truncated.load_nodes(in), false);
+    CHECK_EQUAL(Q, truncated.integrate(f, 0.0, 1.0));
+    in.str("Not a table of nodes");
+    CHECK_EQUAL(truncated.load_nodes(in), false);
+}
+
+int main()
+{
+    test_tanh_sinh_round_trip<double>();
+    test_tanh_sinh_round_trip<cpp_bin_float_50>();
+    test_exp_sinh_round_trip<double>();
+    test_exp_sinh_round_trip<cpp_bin_float_50>();
+    test_mismatch();
+
+    return boost::math::test::report_errors();
+}
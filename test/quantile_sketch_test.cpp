@@ -0,0 +1,173 @@
+//  Copyright Boost.Math contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "math_unit_test.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include <boost/math/statistics/quantile_sketch.hpp>
+#include <boost/math/statistics/univariate_statistics.hpp>
+
+using boost::math::statistics::quantile_sketch;
+
+// Until the first compaction the results are those of the exact functions:
+template<class Real>
+void test_exact()
+{
+    std::mt19937_64 gen(314159);
+    std::normal_distribution<Real> dis(0, 1);
+    std::vector<Real> v(150);
+    for (auto& x : v)
+    {
+        x = dis(gen);
+    }
+    quantile_sketch<Real> sketch;
+    sketch.push(v.begin(), v.end());
+    CHECK_EQUAL(sketch.is_exact(), true);
+    CHECK_EQUAL(sketch.count(), std::uintmax_t(v.size()));
+    CHECK_EQUAL(sketch.normalized_rank_error(), 0.0);
+
+    std::vector<Real> w = v;
+    CHECK_ULP_CLOSE(boost::math::statistics::median(w), sketch.median(), 0);
+    w = v;
+    CHECK_ULP_CLOSE(boost::math::statistics::interquartile_range(w), sketch.interquartile_range(), 0);
+    w = v;
+    CHECK_ULP_CLOSE(boost::math::statistics::median_absolute_deviation(w), sketch.median_absolute_deviation(), 0);
+    CHECK_ULP_CLOSE(*std::min_element(v.begin(), v.end()), (sketch.min)(), 0);
+    CHECK_ULP_CLOSE(*std::max_element(v.begin(), v.end()), (sketch.max)(), 0);
+    CHECK_ULP_CLOSE(*std::min_element(v.begin(), v.end()), sketch.quantile(0), 0);
+    CHECK_ULP_CLOSE(*std::max_element(v.begin(), v.end()), sketch.quantile(1), 0);
+
+#ifndef BOOST_NO_EXCEPTIONS
+    int thrown = 0;
+    try
+    {
+        sketch.push(std::numeric_limits<Real>::quiet_NaN());
+    }
+    catch (const std::domain_error&)
+    {
+        ++thrown;
+    }
+    try
+    {
+        sketch.quantile(1.5);
+    }
+    catch (const std::domain_error&)
+    {
+        ++thrown;
+    }
+    try
+    {
+        quantile_sketch<Real> too_small(4);
+    }
+    catch (const std::domain_error&)
+    {
+        ++thrown;
+    }
+    CHECK_EQUAL(thrown, 3);
+    CHECK_EQUAL(sketch.count(), std::uintmax_t(v.size()));
+#endif
+}
+
+// The exact rank of x in sorted data, as a fraction:
+template<class Real>
+double exact_rank(const std::vector<Real>& sorted, Real x)
+{
+    return static_cast<double>(std::upper_bound(sorted.begin(), sorted.end(), x) - sorted.begin()) / sorted.size();
+}
+
+template<class Real>
+void check_quantiles(const quantile_sketch<Real>& sketch, const std::vector<Real>& sorted)
+{
+    const double eps = sketch.normalized_rank_error();
+    CHECK_EQUAL(sketch.is_exact(), false);
+    CHECK_LE(eps, 0.015);
+    for (double q : { 0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99 })
+    {
+        const double r = exact_rank(sorted, sketch.quantile(q));
+        CHECK_LE(std::abs(r - q), eps);
+        CHECK_LE(std::abs(sketch.rank(sorted[static_cast<std::size_t>(q * sorted.size())]) - q), eps);
+    }
+    CHECK_ULP_CLOSE(sorted.front(), (sketch.min)(), 0);
+    CHECK_ULP_CLOSE(sorted.back(), (sketch.max)(), 0);
+}
+
+template<class Real>
+void test_stream()
+{
+    std::mt19937_64 gen(271828);
+    std::lognormal_distribution<Real> dis(0, 1);
+    const std::size_t n = 200000;
+    std::vector<Real> v(n);
+    for (auto& x : v)
+    {
+        x = dis(gen);
+    }
+
+    quantile_sketch<Real> sketch;
+    for (auto x : v)
+    {
+        sketch(x);
+    }
+    CHECK_EQUAL(sketch.count(), std::uintmax_t(n));
+    // Bounded memory:
+    CHECK_LE(sketch.retained(), std::size_t(3*200 + 8*20));
+
+    // Sketches of separate pieces merge to one with the same bound:
+    std::vector<quantile_sketch<Real>> pieces;
+    for (std::size_t i = 0; i < 8; ++i)
+    {
+        pieces.emplace_back(200, static_cast<std::uint_fast32_t>(i + 7));
+        pieces.back().push(v.begin() + i*n/8, v.begin() + (i + 1)*n/8);
+    }
+    quantile_sketch<Real> merged;
+    for (const auto& p : pieces)
+    {
+        merged += p;
+    }
+    CHECK_EQUAL(merged.count(), std::uintmax_t(n));
+    CHECK_LE(merged.retained(), std::size_t(3*200 + 8*20));
+
+    std::vector<Real> sorted = v;
+    std::sort(sorted.begin(), sorted.end());
+    check_quantiles(sketch, sorted);
+    check_quantiles(merged, sorted);
+
+    std::vector<Real> w = v;
+    const Real median = boost::math::statistics::median(w);
+    for (const auto* s : { &sketch, &merged })
+    {
+        const double eps = s->normalized_rank_error();
+        CHECK_LE(std::abs(exact_rank(sorted, s->median()) - 0.5), eps);
+
+        const Real iqr = s->interquartile_range();
+        CHECK_LE(iqr, sorted[static_cast<std::size_t>((0.75 + eps) * n)] - sorted[static_cast<std::size_t>((0.25 - eps) * n)]);
+        CHECK_LE(sorted[static_cast<std::size_t>((0.75 - eps) * n)] - sorted[static_cast<std::size_t>((0.25 + eps) * n)], iqr);
+
+        std::vector<Real> deviations(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            deviations[i] = std::abs(v[i] - median);
+        }
+        std::sort(deviations.begin(), deviations.end());
+        CHECK_LE(std::abs(exact_rank(deviations, s->median_absolute_deviation()) - 0.5), 2*eps);
+    }
+}
+
+int main()
+{
+    test_exact<float>();
+    test_exact<double>();
+    test_exact<long double>();
+
+    test_stream<float>();
+    test_stream<double>();
+    test_stream<long double>();
+
+    return boost::math::test::report_errors();
+}
@@ -0,0 +1,174 @@
+//  Copyright Boost.Math contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "math_unit_test.hpp"
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <boost/math/constants/constants.hpp>
+#include <boost/math/quadrature/quasi_monte_carlo.hpp>
+
+using boost::math::constants::pi;
+using boost::math::quadrature::quasi_monte_carlo;
+
+template<class Real>
+void test_smooth()
+{
+    using std::exp;
+    using std::abs;
+    // A smooth integrand, for which plain Monte-Carlo would need ~10^12 calls to reach the error goal:
+    auto f = [](std::vector<Real> const & x)
+    {
+        return exp(x[0] + x[1] + x[2]);
+    };
+    std::vector<std::pair<Real, Real>> bounds{{Real(0), Real(1)}, {Real(0), Real(1)}, {Real(0), Real(1)}};
+    Real exact = (exp(Real(1)) - 1)*(exp(Real(1)) - 1)*(exp(Real(1)) - 1);
+    Real error_goal = 1e-4;
+    quasi_monte_carlo<Real, decltype(f)> qmc(f, bounds, error_goal, /*singular =*/ false, /* threads = */ 2, /* seed = */ 1234);
+    Real Q = qmc.integrate().get();
+    CHECK_LE(qmc.current_error_estimate(), error_goal);
+    CHECK_ABSOLUTE_ERROR(exact, Q, 10*error_goal);
+    CHECK_LE(qmc.calls(), static_cast<std::uint64_t>(4*1024*1024));
+    CHECK_EQUAL(qmc.current_estimate(), Q);
+    CHECK_EQUAL(qmc.progress(), Real(1));
+
+    // Tightening the goal continues from the work already done:
+    std::uint64_t calls = qmc.calls();
+    qmc.update_target_error(error_goal/10);
+    Q = qmc.integrate().get();
+    CHECK_LE(qmc.current_error_estimate(), error_goal/10);
+    CHECK_ABSOLUTE_ERROR(exact, Q, error_goal);
+    CHECK_LE(2*calls, qmc.calls());
+}
+
+template<class Real>
+void test_reproducible()
+{
+    using std::cos;
+    auto f = [](std::vector<Real> const & x)
+    {
+        return 1/(1 + x[0]*x[0] + cos(x[1])*x[2]*x[3]);
+    };
+    std::vector<std::pair<Real, Real>> bounds{{Real(-1), Real(2)}, {Real(0), Real(3)}, {Real(0), Real(1)}, {Real(0), Real(1)}};
+    Real error_goal = 1e-4;
+    quasi_monte_carlo<Real, decltype(f)> qmc1(f, bounds, error_goal, true, 1, 8765);
+    Real Q1 = qmc1.integrate().get();
+    for (std::uint64_t threads = 2; threads <= 5; ++threads)
+    {
+        quasi_monte_carlo<Real, decltype(f)> qmc(f, bounds, error_goal, true, threads, 8765);
+        Real Q = qmc.integrate().get();
+        CHECK_EQUAL(Q1, Q);
+        CHECK_EQUAL(qmc1.current_error_estimate(), qmc.current_error_estimate());
+        CHECK_EQUAL(qmc1.calls(), qmc.calls());
+    }
+    // A different seed gives a different randomization:
+    quasi_monte_carlo<Real, decltype(f)> qmc2(f, bounds, error_goal, true, 1, 8766);
+    Real Q2 = qmc2.integrate().get();
+    CHECK_ABSOLUTE_ERROR(Q1, Q2, 10*error_goal);
+    CHECK_EQUAL(Q1 == Q2, false);
+}
+
+template<class Real>
+void test_infinite_bounds()
+{
+    using std::exp;
+    using std::sqrt;
+    // The changes of variables are those of naive_monte_carlo:
+    auto f = [](std::vector<Real> const & x)
+    {
+        return exp(-x[0] - x[1]*x[1] + x[2]);
+    };
+    const Real inf = std::numeric_limits<Real>::infinity();
+    std::vector<std::pair<Real, Real>> bounds{{Real(0), inf}, {-inf, inf}, {-inf, Real(0)}};
+    Real error_goal = 1e-3;
+    quasi_monte_carlo<Real, decltype(f)> qmc(f, bounds, error_goal, true, 2, 42);
+    Real Q = qmc.integrate().get();
+    CHECK_ABSOLUTE_ERROR(sqrt(pi<Real>()), Q, 10*error_goal);
+}
+
+template<class Real>
+void test_cancel()
+{
+    auto f = [](std::vector<Real> const & x)
+    {
+        return x[0]*x[1];
+    };
+    std::vector<std::pair<Real, Real>> bounds{{Real(0), Real(1)}, {Real(0), Real(1)}};
+    quasi_monte_carlo<Real, decltype(f)> qmc(f, bounds, Real(0), false, 2, 7);
+    auto task = qmc.integrate();
+    qmc.cancel();
+    // The first round always completes, so that there's an estimate to return:
+    Real Q = task.get();
+    CHECK_ABSOLUTE_ERROR(Real(1)/4, Q, Real(1e-2));
+    CHECK_LE(static_cast<std::uint64_t>(256*16), qmc.calls());
+}
+
+// Returns the number of times calling f threw E:
+template<class E, class F>
+int count_throws(F f)
+{
+    int thrown = 0;
+    try
+    {
+        f();
+    }
+    catch (const E&)
+    {
+        ++thrown;
+    }
+    return thrown;
+}
+
+template<class Real>
+void test_exceptions()
+{
+#ifndef BOOST_NO_EXCEPTIONS
+    std::vector<std::pair<Real, Real>> bounds{{Real(0), Real(1)}, {Real(0), Real(1)}};
+    // Non-finite values are domain errors, reported with the offending point:
+    auto f = [](std::vector<Real> const & x)
+    {
+        if (x[0] > Real(0.5))
+        {
+            return std::numeric_limits<Real>::quiet_NaN();
+        }
+        return x[1];
+    };
+    quasi_monte_carlo<Real, decltype(f)> qmc(f, bounds, Real(1e-3), false, 3, 7);
+    CHECK_EQUAL(count_throws<std::domain_error>([&]() { qmc.integrate().get(); }), 1);
+
+    // Exceptions thrown by the integrand reach the caller:
+    auto g = [](std::vector<Real> const & x) -> Real
+    {
+        if (x[0] > Real(0.9))
+        {
+            throw std::runtime_error("Bad x");
+        }
+        return x[0];
+    };
+    quasi_monte_carlo<Real, decltype(g)> qmc2(g, bounds, Real(1e-3), false, 3, 7);
+    CHECK_EQUAL(count_throws<std::runtime_error>([&]() { qmc2.integrate().get(); }), 1);
+
+    // At least two randomizations are needed for an error estimate:
+    CHECK_EQUAL(count_throws<std::domain_error>([&]() { quasi_monte_carlo<Real, decltype(g)>(g, bounds, Real(1e-3), false, 1, 7, 1); }), 1);
+    std::vector<std::pair<Real, Real>> bad_bounds{{Real(0), Real(1)}, {Real(1), Real(0)}};
+    CHECK_EQUAL(count_throws<std::domain_error>([&]() { quasi_monte_carlo<Real, decltype(g)>(g, bad_bounds, Real(1e-3)); }), 1);
+#endif
+}
+
+int main()
+{
+    test_smooth<float>();
+    test_smooth<double>();
+    test_reproducible<float>();
+    test_reproducible<double>();
+    test_infinite_bounds<double>();
+    test_cancel<double>();
+    test_exceptions<double>();
+
+    return boost::math::test::report_errors();
+}
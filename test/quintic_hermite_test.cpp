@@ -9,6 +9,7 @@
 #include <numeric>
 #include <utility>
 #include <vector>
+#include <algorithm>
 #include <array>
 #include <boost/random/uniform_real.hpp>
 #include <boost/random/mersenne_twister.hpp>
@@ -22,6 +23,7 @@ using boost::multiprecision::float128;
 
 
 using boost::math::interpolators::quintic_hermite;
+using boost::math::interpolators::quintic_hermite_segments;
 using boost::math::interpolators::cardinal_quintic_hermite;
 using boost::math::interpolators::cardinal_quintic_hermite_aos;
 
@@ -520,6 +522,96 @@ void test_cardinal_quartic()
     }
 }
 
+template<typename Real>
+void test_segments()
+{
+    // A polynomial of degree 5 is reproduced up to rounding error:
+    auto p = [](Real t) { return 1 + t*(2 + t*(-3 + t*(1 + t*(Real(-1)/4 + t/32)))); };
+    auto dp = [](Real t) { return 2 + t*(-6 + t*(3 + t*(-1 + 5*t/32))); };
+    auto d2p = [](Real t) { return -6 + t*(6 + t*(-3 + 5*t/8)); };
+    std::vector<Real> x{0, Real(0.5), Real(1.25), 2, Real(3.5), 4};
+    std::vector<Real> y(x.size());
+    std::vector<Real> dydx(x.size());
+    std::vector<Real> d2ydx2(x.size());
+    for (size_t i = 0; i < x.size(); ++i) {
+        y[i] = p(x[i]);
+        dydx[i] = dp(x[i]);
+        d2ydx2[i] = d2p(x[i]);
+    }
+    auto x_copy = x;
+    auto y_copy = y;
+    auto dydx_copy = dydx;
+    auto d2ydx2_copy = d2ydx2;
+    auto s = quintic_hermite_segments(std::move(x_copy), std::move(y_copy), std::move(dydx_copy), std::move(d2ydx2_copy));
+    Real tol = 16*std::numeric_limits<Real>::epsilon();
+    for (Real t = 0; t <= 4; t += Real(1)/64) {
+        CHECK_MOLLIFIED_CLOSE(p(t), s(t), tol);
+        CHECK_MOLLIFIED_CLOSE(dp(t), s.prime(t), 4*tol);
+        CHECK_MOLLIFIED_CLOSE(d2p(t), s.double_prime(t), 16*tol);
+    }
+    for (size_t i = 0; i < x.size(); ++i) {
+        CHECK_EQUAL(y[i], s(x[i]));
+        CHECK_ULP_CLOSE(dydx[i], s.prime(x[i]), 2);
+        CHECK_ULP_CLOSE(d2ydx2[i], s.double_prime(x[i]), 2);
+    }
+
+    // Random data gives the same interpolant as quintic_hermite, and push_back the same as construction:
+    boost::random::mt19937 gen(4321);
+    boost::random::uniform_real_distribution<Real> dis(0.1,1);
+    size_t n = 300;
+    x.resize(n);
+    y.resize(n);
+    dydx.resize(n);
+    d2ydx2.resize(n);
+    x[0] = dis(gen);
+    y[0] = dis(gen);
+    dydx[0] = dis(gen);
+    d2ydx2[0] = dis(gen);
+    for (size_t i = 1; i < n; ++i) {
+        x[i] = x[i-1] + dis(gen);
+        y[i] = dis(gen);
+        dydx[i] = dis(gen);
+        d2ydx2[i] = dis(gen);
+    }
+    x_copy.assign(x.begin(), x.end() - 2);
+    y_copy.assign(y.begin(), y.end() - 2);
+    dydx_copy.assign(dydx.begin(), dydx.end() - 2);
+    d2ydx2_copy.assign(d2ydx2.begin(), d2ydx2.end() - 2);
+    auto grown = quintic_hermite_segments(std::move(x_copy), std::move(y_copy), std::move(dydx_copy), std::move(d2ydx2_copy));
+    grown.push_back(x[n-2], y[n-2], dydx[n-2], d2ydx2[n-2]);
+    grown.push_back(x[n-1], y[n-1], dydx[n-1], d2ydx2[n-1]);
+    x_copy = x;
+    y_copy = y;
+    dydx_copy = dydx;
+    d2ydx2_copy = d2ydx2;
+    auto segments = quintic_hermite_segments(std::move(x_copy), std::move(y_copy), std::move(dydx_copy), std::move(d2ydx2_copy));
+    auto hermite = quintic_hermite(std::move(x), std::move(y), std::move(dydx), std::move(d2ydx2));
+    CHECK_EQUAL(segments.domain().first, hermite.domain().first);
+    CHECK_EQUAL(segments.domain().second, hermite.domain().second);
+    boost::random::uniform_real_distribution<Real> in_domain(hermite.domain().first, hermite.domain().second);
+    std::vector<Real> t(2*n);
+    for (auto & ti : t) {
+        ti = in_domain(gen);
+    }
+    t.push_back(hermite.domain().second);
+    std::sort(t.begin(), t.end());
+    std::vector<Real> v(t.size());
+    std::vector<Real> dv(t.size());
+    segments(t.begin(), t.end(), v.begin());
+    segments.prime(t.begin(), t.end(), dv.begin());
+    for (size_t i = 0; i < t.size(); ++i) {
+        CHECK_MOLLIFIED_CLOSE(hermite(t[i]), segments(t[i]), 4*tol);
+        CHECK_MOLLIFIED_CLOSE(hermite.prime(t[i]), segments.prime(t[i]), 64*tol);
+        CHECK_MOLLIFIED_CLOSE(hermite.double_prime(t[i]), segments.double_prime(t[i]), 1024*tol);
+        CHECK_EQUAL(segments(t[i]), v[i]);
+        CHECK_EQUAL(segments.prime(t[i]), dv[i]);
+        CHECK_EQUAL(segments(t[i]), grown(t[i]));
+        CHECK_EQUAL(segments.prime(t[i]), grown.prime(t[i]));
+        CHECK_EQUAL(segments.double_prime(t[i]), grown.double_prime(t[i]));
+    }
+    CHECK_EQUAL(hermite(t.back()), segments(t.back()));
+    CHECK_EQUAL(hermite.prime(t.back()), segments.prime(t.back()));
+}
 
 int main()
 {
@@ -529,6 +621,7 @@ int main()
     test_cubic<float>();
     test_quartic<float>();
     test_interpolation_condition<float>();
+    test_segments<float>();
 
     test_cardinal_constant<float>();
     test_cardinal_linear<float>();
@@ -542,6 +635,7 @@ int main()
     test_cubic<double>();
     test_quartic<double>();
     test_interpolation_condition<double>();
+    test_segments<double>();
 
     test_cardinal_constant<double>();
     test_cardinal_linear<double>();
@@ -555,6 +649,7 @@ int main()
     test_cubic<long double>();
     test_quartic<long double>();
     test_interpolation_condition<long double>();
+    test_segments<long double>();
 
     test_cardinal_constant<long double>();
     test_cardinal_linear<long double>();
@@ -0,0 +1,93 @@
+//  Copyright Boost.Math contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "math_unit_test.hpp"
+#include <array>
+#include <random>
+#include <limits>
+#include <cmath>
+#include <boost/math/tools/rational.hpp>
+
+using boost::math::tools::evaluate_polynomial;
+using boost::math::tools::evaluate_rational;
+using std::abs;
+
+//
+// Evaluating at several points at once uses the same recurrences as the
+// runtime sized scalar versions, but the compiler is free to contract the
+// vectorised loops differently, so the error is measured against the
+// condition number of the sum rather than checked for equality:
+//
+template <class Real, std::size_t M>
+void test_polynomial_lanes()
+{
+   static const Real P[] = { Real(0.25), Real(-1.5), Real(3), Real(0.125), Real(-2), Real(7) };
+   static const Real P_abs[] = { Real(0.25), Real(1.5), Real(3), Real(0.125), Real(2), Real(7) };
+   static const std::array<int, 4> I = { 1, 2, -3, 4 };
+   static const std::array<int, 4> I_abs = { 1, 2, 3, 4 };
+   std::mt19937 gen(12);
+   std::uniform_real_distribution<Real> dis(-4, 4);
+   for (unsigned trial = 0; trial < 100; ++trial)
+   {
+      std::array<Real, M> z;
+      for (auto& v : z)
+      {
+         v = dis(gen);
+      }
+      std::array<Real, M> r1 = evaluate_polynomial(P, z);
+      std::array<Real, M> r2 = evaluate_polynomial(I, z);
+      std::array<Real, M> r3 = evaluate_polynomial(P + 1, z, 3);
+      for (std::size_t j = 0; j < M; ++j)
+      {
+         Real x = abs(z[j]);
+         Real tol = 16 * std::numeric_limits<Real>::epsilon();
+         CHECK_ABSOLUTE_ERROR(evaluate_polynomial(P, z[j]), r1[j], tol * evaluate_polynomial(P_abs, x));
+         CHECK_ABSOLUTE_ERROR(Real(evaluate_polynomial(I.data(), z[j], 4)), r2[j], tol * evaluate_polynomial(I_abs, x));
+         CHECK_ABSOLUTE_ERROR(evaluate_polynomial(P + 1, z[j], 3), r3[j], tol * evaluate_polynomial(P_abs + 1, x, 3));
+      }
+   }
+}
+
+template <class Real, std::size_t M>
+void test_rational_lanes()
+{
+   // Positive coefficients and arguments, so there is no cancellation:
+   static const Real P[] = { Real(0.25), Real(1.5), Real(3), Real(0.125), Real(2) };
+   static const Real Q[] = { Real(1), Real(0.5), Real(0.75), Real(0.25), Real(1.5) };
+   std::mt19937 gen(12);
+   std::uniform_real_distribution<Real> dis(0, 10);
+   for (unsigned trial = 0; trial < 100; ++trial)
+   {
+      std::array<Real, M> z;
+      for (auto& v : z)
+      {
+         v = dis(gen);
+      }
+      // Make sure both branches of the scalar code are exercised:
+      z[0] = Real(0.5);
+      z[M - 1] = 1;
+      std::array<Real, M> r = evaluate_rational(P, Q, z);
+      for (std::size_t j = 0; j < M; ++j)
+      {
+         CHECK_ULP_CLOSE(evaluate_rational(static_cast<const Real*>(P), static_cast<const Real*>(Q), z[j], 5), r[j], 4);
+         CHECK_ULP_CLOSE(evaluate_rational(P, Q, z[j]), r[j], 8);
+      }
+   }
+}
+
+int main()
+{
+   test_polynomial_lanes<float, 8>();
+   test_polynomial_lanes<double, 4>();
+   test_polynomial_lanes<double, 7>();
+   test_polynomial_lanes<long double, 2>();
+
+   test_rational_lanes<float, 8>();
+   test_rational_lanes<double, 4>();
+   test_rational_lanes<double, 3>();
+   test_rational_lanes<long double, 2>();
+
+   return boost::math::test::report_errors();
+}
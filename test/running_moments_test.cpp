@@ -0,0 +1,155 @@
+//  Copyright Boost.Math contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "math_unit_test.hpp"
+#include <cmath>
+#include <forward_list>
+#include <random>
+#include <tuple>
+#include <vector>
+#include <boost/math/statistics/running_moments.hpp>
+#include <boost/math/statistics/univariate_statistics.hpp>
+
+using boost::math::statistics::running_moments;
+
+template<class Real>
+void test_small()
+{
+    running_moments<Real> acc;
+    CHECK_EQUAL(acc.count(), std::uintmax_t(0));
+
+    acc.push(Real(1));
+    CHECK_EQUAL(acc.count(), std::uintmax_t(1));
+    CHECK_ULP_CLOSE(Real(1), acc.mean(), 0);
+    CHECK_ULP_CLOSE(Real(0), acc.variance(), 0);
+    CHECK_ULP_CLOSE(Real(0), acc.skewness(), 0);
+
+    // Pushing one at a time, and as a block, must agree:
+    std::vector<Real> v {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    running_moments<Real> a;
+    for (auto x : v)
+    {
+        a(x);
+    }
+    running_moments<Real> b(v.begin(), v.end());
+    CHECK_EQUAL(a.count(), std::uintmax_t(10));
+    CHECK_EQUAL(b.count(), std::uintmax_t(10));
+    CHECK_ULP_CLOSE(Real(11)/2, a.mean(), 0);
+    CHECK_ULP_CLOSE(Real(11)/2, b.mean(), 0);
+    CHECK_ULP_CLOSE(Real(33)/4, a.variance(), 2);
+    CHECK_ULP_CLOSE(Real(33)/4, b.variance(), 2);
+    CHECK_ULP_CLOSE(Real(55)/6, a.sample_variance(), 2);
+    CHECK_ABSOLUTE_ERROR(Real(0), a.skewness(), 10*std::numeric_limits<Real>::epsilon());
+    CHECK_ULP_CLOSE(Real(293)/Real(165), a.kurtosis(), 10);
+    CHECK_ULP_CLOSE(Real(293)/Real(165), b.kurtosis(), 10);
+    CHECK_ULP_CLOSE(Real(293)/Real(165) - 3, b.excess_kurtosis(), 10);
+
+    // A constant stream:
+    running_moments<Real> c;
+    for (int i = 0; i < 5; ++i)
+    {
+        c.push(Real(2));
+    }
+    CHECK_ULP_CLOSE(Real(2), c.mean(), 0);
+    CHECK_ULP_CLOSE(Real(0), c.variance(), 0);
+    CHECK_ULP_CLOSE(Real(0), c.skewness(), 0);
+    CHECK_ULP_CLOSE(Real(0), c.kurtosis(), 0);
+
+    // Empty blocks and empty accumulators change nothing:
+    running_moments<Real> empty;
+    c.push(v.end(), v.end());
+    c += empty;
+    empty += c;
+    CHECK_EQUAL(c.count(), std::uintmax_t(5));
+    CHECK_EQUAL(empty.count(), std::uintmax_t(5));
+    CHECK_ULP_CLOSE(Real(2), empty.mean(), 0);
+
+    // Merging sets with very different means:
+    std::vector<Real> w {1, 2, 4, 8, 50, 60, 75};
+    running_moments<Real> lo(w.begin(), w.begin() + 4);
+    running_moments<Real> hi(w.begin() + 4, w.end());
+    running_moments<Real> all(w.begin(), w.end());
+    lo += hi;
+    CHECK_ULP_CLOSE(all.mean(), lo.mean(), 10);
+    CHECK_ULP_CLOSE(all.variance(), lo.variance(), 10);
+    CHECK_ULP_CLOSE(all.skewness(), lo.skewness(), 20);
+    CHECK_ULP_CLOSE(all.kurtosis(), lo.kurtosis(), 20);
+
+    c.clear();
+    CHECK_EQUAL(c.count(), std::uintmax_t(0));
+
+    // Only forward iterators are required:
+    std::forward_list<Real> l {1, 2, 3, 4};
+    running_moments<Real> d(l.begin(), l.end());
+    CHECK_ULP_CLOSE(Real(5)/2, d.mean(), 0);
+    CHECK_ULP_CLOSE(Real(5)/4, d.variance(), 2);
+}
+
+//
+// Streaming, in blocks of varying size, and merging separate pieces must all
+// agree with first_four_moments over the whole data:
+//
+template<class Real>
+void test_random()
+{
+    std::mt19937_64 gen(12345);
+    std::gamma_distribution<Real> dis(2, 3);
+    std::vector<Real> v(10000);
+    for (auto& x : v)
+    {
+        x = dis(gen);
+    }
+    const auto [M1, M2, M3, M4] = boost::math::statistics::first_four_moments(v);
+
+    running_moments<Real> one_at_a_time;
+    for (auto x : v)
+    {
+        one_at_a_time.push(x);
+    }
+
+    running_moments<Real> blocks;
+    std::vector<running_moments<Real>> pieces;
+    std::size_t start = 0;
+    std::size_t length = 1;
+    while (start < v.size())
+    {
+        const std::size_t end = (std::min)(v.size(), start + length);
+        blocks.push(v.begin() + start, v.begin() + end);
+        pieces.emplace_back(v.begin() + start, v.begin() + end);
+        start = end;
+        length = 3*length + 1;
+    }
+    running_moments<Real> merged;
+    for (const auto& p : pieces)
+    {
+        merged = merged + p;
+    }
+
+    for (const auto& acc : { one_at_a_time, blocks, merged })
+    {
+        CHECK_EQUAL(acc.count(), std::uintmax_t(v.size()));
+        const auto [m1, m2, m3, m4] = acc.first_four_moments();
+        CHECK_ULP_CLOSE(M1, m1, 300);
+        CHECK_ULP_CLOSE(M2, m2, 300);
+        CHECK_ULP_CLOSE(M3, m3, 3000);
+        CHECK_ULP_CLOSE(M4, m4, 3000);
+        CHECK_ULP_CLOSE(boost::math::statistics::variance(v), acc.variance(), 300);
+        CHECK_ULP_CLOSE(boost::math::statistics::skewness(v), acc.skewness(), 3000);
+        CHECK_ULP_CLOSE(boost::math::statistics::kurtosis(v), acc.kurtosis(), 3000);
+    }
+}
+
+int main()
+{
+    test_small<float>();
+    test_small<double>();
+    test_small<long double>();
+
+    test_random<float>();
+    test_random<double>();
+    test_random<long double>();
+
+    return boost::math::test::report_errors();
+}
@@ -0,0 +1,130 @@
+//  Copyright Boost.Math contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "math_unit_test.hpp"
+#include <atomic>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <boost/math/quadrature/tanh_sinh.hpp>
+#include <boost/math/tools/thread_pool.hpp>
+
+using boost::math::quadrature::tanh_sinh;
+using boost::math::tools::thread_pool;
+
+// A minimal executor, running each task on the calling thread in reverse order:
+struct reversed_executor
+{
+    unsigned concurrency() const
+    {
+        return 3;
+    }
+
+    template<class F>
+    void bulk_execute(std::size_t n, F&& f) const
+    {
+        while (n)
+        {
+            f(--n);
+        }
+    }
+};
+
+// The concurrent evaluation must give exactly the sequential result, error
+// estimate, L1 norm and number of levels, from exactly the same points:
+template<class Real, class Executor, class Integrate>
+void check_same(Executor& exec, Integrate integrate)
+{
+    std::atomic<std::size_t> serial_calls {0};
+    std::atomic<std::size_t> parallel_calls {0};
+    Real serial_error, serial_L1, parallel_error, parallel_L1;
+    std::size_t serial_levels, parallel_levels;
+    auto serial = integrate(nullptr, serial_calls, &serial_error, &serial_L1, &serial_levels);
+    auto parallel = integrate(&exec, parallel_calls, &parallel_error, &parallel_L1, &parallel_levels);
+    CHECK_EQUAL(serial, parallel);
+    CHECK_EQUAL(serial_error, parallel_error);
+    CHECK_EQUAL(serial_L1, parallel_L1);
+    CHECK_EQUAL(serial_levels, parallel_levels);
+    CHECK_EQUAL(serial_calls.load(), parallel_calls.load());
+}
+
+template<class Real, class Executor>
+void test_executor(Executor& exec)
+{
+    using std::exp;
+    using std::log;
+    using std::sqrt;
+    tanh_sinh<Real> integrator;
+    const Real inf = std::numeric_limits<Real>::infinity();
+
+    // Each case integrates with the sequential overload when given a null executor:
+    auto make = [&](auto f, Real a, Real b)
+    {
+        return [&integrator, f, a, b](Executor* e, std::atomic<std::size_t>& calls, Real* error, Real* L1, std::size_t* levels)
+        {
+            auto g = [&](auto... x) -> decltype(f(x...)) { ++calls; return f(x...); };
+            const Real tol = boost::math::tools::root_epsilon<Real>();
+            return e ? integrator.integrate(*e, g, a, b, tol, error, L1, levels) : integrator.integrate(g, a, b, tol, error, L1, levels);
+        };
+    };
+
+    // Finite interval, with an endpoint singularity:
+    check_same<Real>(exec, make([](Real x) { return log(x)*log1p(-x); }, Real(0), Real(1)));
+    // Reversed bounds:
+    check_same<Real>(exec, make([](Real x) { return exp(x); }, Real(2), Real(-1)));
+    // Infinite and half infinite ranges:
+    check_same<Real>(exec, make([](Real x) { return exp(-x*x); }, -inf, inf));
+    check_same<Real>(exec, make([](Real x) { return 1/(1 + x*x); }, Real(0), inf));
+    check_same<Real>(exec, make([](Real x) { return exp(x); }, -inf, Real(0)));
+    // The two argument form, with the distance to the nearest endpoint:
+    check_same<Real>(exec, make([](Real x, Real xc) { return x <= Real(0.5) ? 1/sqrt(x) : 1/sqrt(1 + xc); }, Real(0), Real(1)));
+    // Complex valued:
+    check_same<Real>(exec, [&](Executor* e, std::atomic<std::size_t>& calls, Real* error, Real* L1, std::size_t* levels)
+    {
+        auto g = [&](Real x) { ++calls; return std::complex<Real>(x*x, exp(x)); };
+        const Real tol = boost::math::tools::root_epsilon<Real>();
+        auto z = e ? integrator.integrate(*e, g, Real(0), Real(1), tol, error, L1, levels) : integrator.integrate(g, Real(0), Real(1), tol, error, L1, levels);
+        return z.real() + z.imag();
+    });
+    // Over (-1, 1) without bounds:
+    check_same<Real>(exec, [&](Executor* e, std::atomic<std::size_t>& calls, Real* error, Real* L1, std::size_t* levels)
+    {
+        auto g = [&](Real x) { ++calls; return 1/sqrt(1 - x*x); };
+        const Real tol = boost::math::tools::root_epsilon<Real>();
+        return e ? integrator.integrate(*e, g, tol, error, L1, levels) : integrator.integrate(g, tol, error, L1, levels);
+    });
+
+    Real Q = integrator.integrate(exec, [](Real x) { return exp(x); }, Real(0), Real(1));
+    CHECK_ULP_CLOSE(boost::math::constants::e<Real>() - 1, Q, 10);
+
+#ifndef BOOST_NO_EXCEPTIONS
+    // Exceptions thrown by the integrand reach the caller:
+    int thrown = 0;
+    try
+    {
+        integrator.integrate(exec, [](Real x) -> Real { if (x > Real(0.9)) throw std::runtime_error("Bad x"); return x; }, Real(0), Real(1));
+    }
+    catch (const std::runtime_error&)
+    {
+        ++thrown;
+    }
+    CHECK_EQUAL(thrown, 1);
+#endif
+}
+
+int main()
+{
+    thread_pool pool(4);
+    test_executor<float>(pool);
+    test_executor<double>(pool);
+    test_executor<long double>(pool);
+
+    reversed_executor reversed;
+    test_executor<double>(reversed);
+
+    return boost::math::test::report_errors();
+}
@@ -14,6 +14,7 @@
 #include <boost/test/tools/floating_point_comparison.hpp>
 #include <boost/math/interpolators/barycentric_rational.hpp>
 #include <boost/multiprecision/cpp_bin_float.hpp>
+#include <boost/math/tools/thread_pool.hpp>
 
 #ifdef BOOST_HAS_FLOAT128
 #include <boost/multiprecision/float128.hpp>
@@ -252,6 +253,124 @@ void test_weights()
 
 }
 
+// A minimal executor, running each task on the calling thread in reverse order:
+struct reversed_executor
+{
+    unsigned concurrency() const
+    {
+        return 3;
+    }
+
+    template<class F>
+    void bulk_execute(std::size_t n, F&& f) const
+    {
+        while (n)
+        {
+            f(--n);
+        }
+    }
+};
+
+template<class Real>
+void test_batch(size_t n, size_t queries)
+{
+    std::cout << "Testing evaluation at many points using barycentric interpolation on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+
+    std::mt19937 gen(10);
+    boost::random::uniform_real_distribution<Real> dis(0.1f, 1);
+    std::vector<Real> x(n);
+    std::vector<Real> y(n);
+    x[0] = dis(gen);
+    y[0] = dis(gen);
+    for (size_t i = 1; i < x.size(); ++i)
+    {
+        x[i] = x[i-1] + dis(gen);
+        y[i] = dis(gen);
+    }
+    boost::math::interpolators::barycentric_rational<Real> interpolator(x.data(), y.data(), y.size());
+
+    // Random abscissas, some of the nodes themselves, and the endpoints:
+    boost::random::uniform_real_distribution<Real> in_domain(x.front(), x.back());
+    std::vector<Real> t(queries);
+    for (auto & ti : t)
+    {
+        ti = in_domain(gen);
+    }
+    for (size_t i = 0; i < x.size(); i += 7)
+    {
+        t.push_back(x[i]);
+    }
+    t.push_back(x.back());
+
+    std::vector<Real> z(t.size());
+    BOOST_CHECK(interpolator(t.begin(), t.end(), z.begin()) == z.end());
+    for (size_t i = 0; i < t.size(); ++i)
+    {
+        BOOST_CHECK_CLOSE_FRACTION(z[i], interpolator(t[i]), 4*numeric_limits<Real>::epsilon());
+    }
+    for (size_t i = 0; i < x.size(); i += 7)
+    {
+        BOOST_CHECK_EQUAL(z[queries + i/7], y[i]);
+    }
+
+    // The executors give exactly the same values:
+    std::vector<Real> w(t.size());
+    reversed_executor reversed;
+    BOOST_CHECK(interpolator(reversed, t.begin(), t.end(), w.begin()) == w.end());
+    BOOST_CHECK(w == z);
+    std::fill(w.begin(), w.end(), Real(0));
+    boost::math::tools::thread_pool pool(3);
+    interpolator(pool, t.data(), t.data() + t.size(), w.data());
+    BOOST_CHECK(w == z);
+}
+
+template<class Real>
+void test_incremental_weights()
+{
+    std::cout << "Testing weights computed in chunks and by push_back using barycentric interpolation on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+
+    std::mt19937 gen(11);
+    boost::random::uniform_real_distribution<Real> dis(0.1f, 1);
+    std::vector<Real> x(3000);
+    std::vector<Real> y(3000);
+    x[0] = dis(gen);
+    y[0] = dis(gen);
+    for (size_t i = 1; i < x.size(); ++i)
+    {
+        x[i] = x[i-1] + dis(gen);
+        y[i] = dis(gen);
+    }
+
+    for (size_t d : {0, 1, 3, 6})
+    {
+        using boost::math::interpolators::detail::barycentric_rational_imp;
+        barycentric_rational_imp<Real> full(x.data(), x.data() + x.size(), y.data(), d);
+
+        // Appending the points one at a time gives the same weights as constructing with all of them:
+        barycentric_rational_imp<Real> grown(x.data(), x.data() + d + 1, y.data(), d);
+        for (size_t i = d + 1; i < x.size(); ++i)
+        {
+            grown.push_back(x[i], y[i]);
+        }
+        // And so do the executors:
+        reversed_executor reversed;
+        barycentric_rational_imp<Real> chunked(reversed, std::vector<Real>(x), std::vector<Real>(y), d);
+        boost::math::tools::thread_pool pool(3);
+        barycentric_rational_imp<Real> pooled(pool, std::vector<Real>(x), std::vector<Real>(y), d);
+        for (size_t i = 0; i < x.size(); ++i)
+        {
+            BOOST_CHECK_EQUAL(grown.weight(i), full.weight(i));
+            BOOST_CHECK_EQUAL(chunked.weight(i), full.weight(i));
+            BOOST_CHECK_EQUAL(pooled.weight(i), full.weight(i));
+        }
+    }
+
+    boost::math::interpolators::barycentric_rational<Real> interpolator(std::vector<Real>(x.begin(), x.begin() + 10), std::vector<Real>(y.begin(), y.begin() + 10));
+    interpolator.push_back(x[10], y[10]);
+    BOOST_CHECK_EQUAL(interpolator(x[10]), y[10]);
+    BOOST_CHECK_THROW(interpolator.push_back(x[9], y[9]), std::domain_error);
+    BOOST_CHECK_THROW(interpolator.push_back(std::numeric_limits<Real>::quiet_NaN(), y[9]), std::domain_error);
+}
 
 BOOST_AUTO_TEST_CASE(barycentric_rational)
 {
@@ -259,6 +378,8 @@ BOOST_AUTO_TEST_CASE(barycentric_rational)
     // They still pass, but the CI system is starting to time out,
     // so I figured it'd be polite to comment out the most expensive tests.
     test_weights<double>();
+    test_incremental_weights<float>();
+    test_incremental_weights<double>();
 
     test_constant<float>();
     //test_constant<double>();
@@ -284,6 +405,10 @@ BOOST_AUTO_TEST_CASE(barycentric_rational)
     //test_runge<long double>();
     //test_runge<cpp_bin_float_50>();
 
+    test_batch<float>(1100, 600);
+    test_batch<double>(1100, 600);
+    test_batch<cpp_bin_float_50>(100, 50);
+
 #ifdef BOOST_HAS_FLOAT128
     //test_interpolation_condition<boost::multiprecision::float128>();
     //test_constant<boost::multiprecision::float128>();
@@ -0,0 +1,283 @@
+//  Copyright Boost.Math contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "math_unit_test.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include <boost/math/tools/thread_pool.hpp>
+#include <boost/math/statistics/univariate_statistics.hpp>
+#include <boost/math/statistics/bivariate_statistics.hpp>
+#include <boost/math/statistics/chatterjee_correlation.hpp>
+#include <boost/math/statistics/detail/executor.hpp>
+
+using boost::math::tools::thread_pool;
+
+void test_pool()
+{
+    thread_pool pool(4);
+    CHECK_EQUAL(pool.concurrency(), 4u);
+
+    auto f = pool.submit([]() { return 42; });
+    CHECK_EQUAL(f.get(), 42);
+
+    std::vector<int> v(1000);
+    pool.bulk_execute(v.size(), [&v](std::size_t i) { v[i] = static_cast<int>(i); });
+    for (std::size_t i = 0; i < v.size(); ++i)
+    {
+        CHECK_EQUAL(v[i], static_cast<int>(i));
+    }
+    pool.bulk_execute(0, [](std::size_t) { throw std::runtime_error("Never called"); });
+
+    // Nested calls do not deadlock, even with a single worker:
+    thread_pool single(1);
+    std::atomic<int> count {0};
+    single.bulk_execute(3, [&](std::size_t)
+    {
+        single.bulk_execute(5, [&](std::size_t) { ++count; });
+    });
+    CHECK_EQUAL(count.load(), 15);
+
+#ifndef BOOST_NO_EXCEPTIONS
+    bool thrown = false;
+    try
+    {
+        pool.bulk_execute(10, [](std::size_t i)
+        {
+            if (i == 7)
+            {
+                throw std::domain_error("Seven");
+            }
+        });
+    }
+    catch (const std::domain_error&)
+    {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+    // The pool is still usable afterwards:
+    CHECK_EQUAL(pool.submit([]() { return 3; }).get(), 3);
+#endif
+}
+
+#ifdef BOOST_MATH_EXEC_COMPATIBLE
+
+//
+// The statistics must be the same whichever executor runs them, and one pool
+// may be shared between many calls:
+//
+template <class Real>
+void test_statistics(thread_pool& pool)
+{
+    using namespace boost::math::statistics;
+    std::mt19937_64 gen(87654);
+    std::normal_distribution<Real> dis(1, 3);
+    for (std::size_t n : { std::size_t(10), std::size_t(5000), std::size_t(200000) })
+    {
+        std::vector<Real> u(n), w(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            u[i] = dis(gen);
+            w[i] = u[i] / 2 + dis(gen);
+        }
+
+        auto m = first_four_moments(std::execution::par, u);
+        auto p = first_four_moments(pool, u);
+        CHECK_ULP_CLOSE(std::get<0>(m), std::get<0>(p), 100);
+        CHECK_ULP_CLOSE(std::get<1>(m), std::get<1>(p), 100);
+        CHECK_ULP_CLOSE(std::get<2>(m), std::get<2>(p), 10000);
+        CHECK_ULP_CLOSE(std::get<3>(m), std::get<3>(p), 100);
+        CHECK_ULP_CLOSE(variance(u), variance(pool, u), 100);
+        CHECK_ULP_CLOSE(kurtosis(u), kurtosis(pool, u), 100);
+        CHECK_ULP_CLOSE(mean(u), mean(pool, u), 100);
+
+        CHECK_ULP_CLOSE(covariance(u, w), covariance(pool, u, w), 100);
+        CHECK_ULP_CLOSE(correlation_coefficient(std::execution::par, u, w), correlation_coefficient(pool, u, w), 100);
+
+        std::vector<Real> s = u;
+        CHECK_ULP_CLOSE(median(s), median(pool, u), 0);
+
+        for (auto& x : s)
+        {
+            x = std::abs(x);
+        }
+        std::vector<Real> t = s;
+        CHECK_ULP_CLOSE(gini_coefficient(s), gini_coefficient(pool, t), 100);
+
+        // Distinct values, as the parallel rank does not handle ties:
+        std::sort(s.begin(), s.end());
+        std::vector<Real> y(n);
+        std::iota(y.begin(), y.end(), Real(0));
+        std::shuffle(y.begin(), y.end(), gen);
+        CHECK_ULP_CLOSE(chatterjee_correlation(s, y), chatterjee_correlation(pool, s, y), 0);
+    }
+}
+
+//
+// A large pool splits inputs only a little above the parallel threshold into many small
+// chunks, which must neither overrun the input nor be misnumbered:
+//
+template <class Real>
+void test_large_pool(const thread_pool& pool)
+{
+    using namespace boost::math::statistics;
+    std::mt19937_64 gen(13579);
+    std::uniform_real_distribution<Real> dis(1, 2);
+    for (std::size_t n = 1000; n <= 6000; n += 83)
+    {
+        std::vector<Real> u(n), w(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            u[i] = dis(gen);
+            w[i] = u[i] / 2 + dis(gen);
+        }
+        CHECK_ULP_CLOSE(variance(u), variance(pool, u), 100);
+        CHECK_ULP_CLOSE(covariance(u, w), covariance(pool, u, w), 100);
+        CHECK_ULP_CLOSE(correlation_coefficient(u, w), correlation_coefficient(pool, u, w), 100);
+
+        // The parallel gini coefficient divides by n - 1 where the sequential one divides by n:
+        std::vector<Real> s = u;
+        std::vector<Real> t = u;
+        const Real g = gini_coefficient(s);
+        CHECK_ULP_CLOSE((n*g + 1)/(n - 1), gini_coefficient(pool, t), 1000);
+
+        std::sort(s.begin(), s.end());
+        std::vector<Real> y(n);
+        std::iota(y.begin(), y.end(), Real(0));
+        std::shuffle(y.begin(), y.end(), gen);
+        CHECK_ULP_CLOSE(chatterjee_correlation(s, y), chatterjee_correlation(pool, s, y), 0);
+    }
+}
+
+//
+// Counts the calls to bulk_execute, to check that the reductions, sorts and selections run
+// on the executor they are given, and claims enough concurrency that large inputs are split
+// even on a machine with a single hardware thread:
+//
+struct counting_executor
+{
+    const thread_pool& pool;
+    mutable std::atomic<std::size_t> calls {0};
+
+    explicit counting_executor(const thread_pool& p) : pool(p) {}
+
+    unsigned concurrency() const
+    {
+        return 4;
+    }
+
+    template <class F>
+    void bulk_execute(std::size_t n, F&& f) const
+    {
+        ++calls;
+        pool.bulk_execute(n, std::forward<F>(f));
+    }
+};
+
+template <class Real>
+void test_executor_algorithms(const thread_pool& pool)
+{
+    using namespace boost::math::statistics;
+    static_assert(detail::is_executor<const thread_pool>::value, "A const pool is an executor.");
+    std::mt19937_64 gen(13579);
+    std::normal_distribution<Real> dis(1, 3);
+    std::uniform_int_distribution<int> few(0, 50);
+    const std::size_t n = 200001;
+    std::vector<Real> distinct(n), ties(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        distinct[i] = dis(gen);
+        ties[i] = static_cast<Real>(few(gen));
+    }
+
+    for (const auto& u : { distinct, ties })
+    {
+        counting_executor ex(pool);
+        std::vector<Real> s = u;
+        std::vector<Real> t = u;
+        CHECK_ULP_CLOSE(mean(u), mean(ex, u), 100);
+        CHECK_EQUAL(median(s), median(ex, t));
+        s = u;
+        t = u;
+        CHECK_EQUAL(median(s.begin(), s.end() - 1), median(ex, t.begin(), t.end() - 1));
+        s = u;
+        t = u;
+        CHECK_EQUAL(median_absolute_deviation(s, Real(0)), median_absolute_deviation(ex, t, Real(0)));
+        s = u;
+        t = u;
+        CHECK_EQUAL(interquartile_range(s), interquartile_range(ex, t));
+        s = u;
+        t = u;
+        CHECK_EQUAL(interquartile_range(s.begin(), s.end() - 2), interquartile_range(ex, t.begin(), t.end() - 2));
+        for (auto& x : s)
+        {
+            x = std::abs(x);
+        }
+        t = s;
+        std::sort(s.begin(), s.end());
+        // Sorting first, the executor overload then runs the same parallel sums as with a sorted input:
+        const Real g = gini_coefficient(ex, t);
+        CHECK_EQUAL(s == t, true);
+        CHECK_EQUAL(g, gini_coefficient(ex, s));
+        CHECK_EQUAL(ex.calls.load() > 0, true);
+
+        // The selection leaves the range partitioned about nth, as std::nth_element does:
+        for (std::size_t k : { std::size_t(0), std::size_t(17), n / 3, n / 2, n - 1 })
+        {
+            s = u;
+            t = u;
+            std::nth_element(s.begin(), s.begin() + k, s.end());
+            detail::parallel_nth_element(ex, t.begin(), t.begin() + k, t.end());
+            CHECK_EQUAL(s[k], t[k]);
+            CHECK_EQUAL(*std::max_element(t.begin(), t.begin() + k + 1), t[k]);
+            CHECK_EQUAL(*std::min_element(t.begin() + k, t.end()), t[k]);
+        }
+        s = u;
+        t = u;
+        std::sort(s.begin(), s.end());
+        detail::parallel_sort(ex, t.begin(), t.end());
+        CHECK_EQUAL(s == t, true);
+        CHECK_EQUAL(detail::parallel_is_sorted(ex, t.begin(), t.end()), true);
+        // Out of order across the boundary of two chunks:
+        std::swap(t[n / 4 - 1], t[n / 4]);
+        CHECK_EQUAL(detail::parallel_is_sorted(ex, t.begin(), t.end()), std::is_sorted(t.begin(), t.end()));
+    }
+
+    // Chatterjee's correlation ranks on the executor:
+    counting_executor ex(pool);
+    std::vector<Real> x = distinct;
+    std::sort(x.begin(), x.end());
+    std::vector<Real> y(n);
+    std::iota(y.begin(), y.end(), Real(0));
+    std::shuffle(y.begin(), y.end(), gen);
+    CHECK_ULP_CLOSE(chatterjee_correlation(x, y), chatterjee_correlation(ex, x, y), 0);
+    CHECK_EQUAL(ex.calls.load() > 0, true);
+}
+
+#endif
+
+int main()
+{
+    test_pool();
+#ifdef BOOST_MATH_EXEC_COMPATIBLE
+    thread_pool pool;
+    test_statistics<float>(pool);
+    test_statistics<double>(pool);
+    test_statistics<long double>(pool);
+    const thread_pool& shared = pool;
+    test_executor_algorithms<float>(shared);
+    test_executor_algorithms<double>(shared);
+    for (unsigned threads : { 100u, 128u })
+    {
+        const thread_pool large(threads);
+        test_large_pool<double>(large);
+    }
+#endif
+    return boost::math::test::report_errors();
+}
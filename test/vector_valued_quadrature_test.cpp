@@ -0,0 +1,123 @@
+//  Copyright Boost.Math contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "math_unit_test.hpp"
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <boost/math/constants/constants.hpp>
+#include <boost/math/quadrature/tanh_sinh.hpp>
+#include <boost/math/quadrature/gauss_kronrod.hpp>
+
+using boost::math::quadrature::tanh_sinh;
+using boost::math::quadrature::gauss_kronrod;
+
+template<class Real>
+void test_tanh_sinh()
+{
+    using std::exp;
+    using std::log;
+    using std::log1p;
+    using std::sqrt;
+    using std::cos;
+    using std::sin;
+    using boost::math::constants::pi;
+    tanh_sinh<Real> integrator;
+    const Real tol = boost::math::tools::root_epsilon<Real>();
+
+    std::size_t calls = 0;
+    auto f = [&](Real x) { ++calls; return std::array<Real, 3>{{exp(x), x*x, cos(x)}}; };
+    Real error, L1;
+    std::size_t levels;
+    std::array<Real, 3> Q = integrator.integrate(f, Real(0), Real(1), tol, &error, &L1, &levels);
+    CHECK_ULP_CLOSE(boost::math::constants::e<Real>() - 1, Q[0], 10);
+    CHECK_ULP_CLOSE(Real(1)/3, Q[1], 10);
+    CHECK_ULP_CLOSE(sin(Real(1)), Q[2], 10);
+    CHECK_LE(error, tol*L1);
+
+    // Each component is integrated at the same points as the hardest of them on its own:
+    std::size_t scalar_calls = 0;
+    auto g = [&](Real x) { ++scalar_calls; return exp(x); };
+    Real Q0 = integrator.integrate(g, Real(0), Real(1), tol);
+    CHECK_EQUAL(calls, scalar_calls);
+    CHECK_ULP_CLOSE(Q0, Q[0], 2);
+
+    // Reversed bounds:
+    std::array<Real, 3> R = integrator.integrate(f, Real(1), Real(0), tol);
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        CHECK_EQUAL(-Q[i], R[i]);
+    }
+
+    // Endpoint singularities and infinite ranges:
+    const Real inf = std::numeric_limits<Real>::infinity();
+    auto h = [](Real x) { return std::array<Real, 2>{{log(x)*log1p(-x), 1/sqrt(x)}}; };
+    std::array<Real, 2> S = integrator.integrate(h, Real(0), Real(1), tol);
+    CHECK_ABSOLUTE_ERROR(2 - pi<Real>()*pi<Real>()/6, S[0], 10*tol);
+    CHECK_ABSOLUTE_ERROR(Real(2), S[1], 10*tol);
+    auto k = [](Real x) { return std::array<Real, 2>{{exp(-x*x), 1/(1 + x*x)}}; };
+    std::array<Real, 2> T = integrator.integrate(k, -inf, inf, tol);
+    CHECK_ABSOLUTE_ERROR(sqrt(pi<Real>()), T[0], 10*tol);
+    CHECK_ABSOLUTE_ERROR(pi<Real>(), T[1], 10*tol);
+    T = integrator.integrate(k, Real(0), inf, tol);
+    CHECK_ABSOLUTE_ERROR(sqrt(pi<Real>())/2, T[0], 10*tol);
+    CHECK_ABSOLUTE_ERROR(pi<Real>()/2, T[1], 10*tol);
+
+    // The two argument form, and over (-1, 1) without bounds:
+    auto m = [](Real x, Real) { return std::array<Real, 2>{{x*x, cos(x)}}; };
+    std::array<Real, 2> U = integrator.integrate(m, tol);
+    CHECK_ABSOLUTE_ERROR(Real(2)/3, U[0], 10*tol);
+    CHECK_ABSOLUTE_ERROR(2*sin(Real(1)), U[1], 10*tol);
+}
+
+template<class Real, unsigned Points>
+void test_gauss_kronrod()
+{
+    using std::exp;
+    using std::cos;
+    using std::sin;
+    const Real tol = boost::math::tools::root_epsilon<Real>();
+
+    std::size_t calls = 0;
+    auto f = [&](Real x) { ++calls; return std::array<Real, 3>{{exp(x), x*x, cos(x)}}; };
+    Real error, L1;
+    std::array<Real, 3> Q = gauss_kronrod<Real, Points>::integrate(f, Real(0), Real(1), 15, tol, &error, &L1);
+    CHECK_ULP_CLOSE(boost::math::constants::e<Real>() - 1, Q[0], 10);
+    CHECK_ULP_CLOSE(Real(1)/3, Q[1], 10);
+    CHECK_ULP_CLOSE(sin(Real(1)), Q[2], 10);
+
+    std::size_t scalar_calls = 0;
+    auto g = [&](Real x) { ++scalar_calls; return exp(x); };
+    Real Q0 = gauss_kronrod<Real, Points>::integrate(g, Real(0), Real(1), 15, tol);
+    CHECK_EQUAL(calls, scalar_calls);
+    CHECK_EQUAL(Q0, Q[0]);
+
+    // Adaptive subdivision is driven by the worst component:
+    auto h = [](Real x) { return std::array<Real, 2>{{x, sin(40*x)}}; };
+    std::array<Real, 2> S = gauss_kronrod<Real, Points>::integrate(h, Real(0), Real(1), 15, tol);
+    CHECK_ABSOLUTE_ERROR(Real(0.5), S[0], 10*tol);
+    CHECK_ABSOLUTE_ERROR((1 - cos(Real(40)))/40, S[1], 10*tol);
+
+    const Real inf = std::numeric_limits<Real>::infinity();
+    auto k = [](Real x) { return std::array<Real, 2>{{exp(-x), 1/(1 + x*x)}}; };
+    std::array<Real, 2> T = gauss_kronrod<Real, Points>::integrate(k, Real(0), inf, 15, tol);
+    CHECK_ABSOLUTE_ERROR(Real(1), T[0], 10*tol);
+    CHECK_ABSOLUTE_ERROR(boost::math::constants::half_pi<Real>(), T[1], 10*tol);
+}
+
+int main()
+{
+    test_tanh_sinh<float>();
+    test_tanh_sinh<double>();
+    test_tanh_sinh<long double>();
+
+    test_gauss_kronrod<float, 15>();
+    test_gauss_kronrod<double, 15>();
+    test_gauss_kronrod<double, 31>();
+    test_gauss_kronrod<long double, 21>();
+
+    return boost::math::test::report_errors();
+}
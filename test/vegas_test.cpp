@@ -0,0 +1,200 @@
+//  Copyright Boost.Math contributors 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "math_unit_test.hpp"
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <boost/math/constants/constants.hpp>
+#include <boost/math/quadrature/vegas.hpp>
+
+using boost::math::constants::pi;
+using boost::math::quadrature::vegas;
+
+template<class Real>
+void test_peak()
+{
+    using std::exp;
+    using std::sqrt;
+    // A narrow Gaussian in 5 dimensions, normalized to integrate to 1.  Naive Monte-Carlo
+    // would need ~10^10 calls to reach the error goal, as the variance of the integrand is ~5000:
+    const Real sigma = Real(0.05);
+    const Real scale = 1/(sigma*sqrt(2*pi<Real>()));
+    auto f = [=](std::vector<Real> const & x)
+    {
+        Real r = 0;
+        Real y = 1;
+        for (Real xi : x)
+        {
+            r += (xi - Real(0.5))*(xi - Real(0.5));
+            y *= scale;
+        }
+        return y*exp(-r/(2*sigma*sigma));
+    };
+    std::vector<std::pair<Real, Real>> bounds(5, std::pair<Real, Real>(Real(0), Real(1)));
+    Real error_goal = 1e-3;
+    vegas<Real, decltype(f)> integrator(f, bounds, error_goal, /*singular =*/ false, /* threads = */ 2, /* seed = */ 1234);
+    Real Q = integrator.integrate().get();
+    CHECK_LE(integrator.current_error_estimate(), error_goal);
+    CHECK_ABSOLUTE_ERROR(Real(1), Q, 5*error_goal);
+    CHECK_LE(integrator.calls(), static_cast<std::uint64_t>(2000000));
+    CHECK_LE(integrator.chi_squared(), Real(3));
+    CHECK_EQUAL(integrator.current_estimate(), Q);
+    CHECK_EQUAL(integrator.progress(), Real(1));
+
+    // Tightening the goal continues with the trained grid and the estimates so far:
+    std::uint64_t calls = integrator.calls();
+    std::uint64_t iterations = integrator.iterations();
+    integrator.update_target_error(error_goal/4);
+    Q = integrator.integrate().get();
+    CHECK_LE(integrator.current_error_estimate(), error_goal/4);
+    CHECK_ABSOLUTE_ERROR(Real(1), Q, 5*error_goal/4);
+    CHECK_LE(calls, integrator.calls());
+    CHECK_LE(iterations + 1, integrator.iterations());
+}
+
+template<class Real>
+void test_infinite_bounds()
+{
+    using std::exp;
+    using std::sqrt;
+    // The changes of variables are those of naive_monte_carlo:
+    auto f = [](std::vector<Real> const & x)
+    {
+        return exp(-x[0] - x[1]*x[1] + x[2]);
+    };
+    const Real inf = std::numeric_limits<Real>::infinity();
+    std::vector<std::pair<Real, Real>> bounds{{Real(0), inf}, {-inf, inf}, {-inf, Real(0)}};
+    Real error_goal = 1e-3;
+    vegas<Real, decltype(f)> integrator(f, bounds, error_goal, true, 2, 42);
+    Real Q = integrator.integrate().get();
+    CHECK_ABSOLUTE_ERROR(sqrt(pi<Real>()), Q, 5*error_goal);
+}
+
+template<class Real>
+void test_reproducible()
+{
+    using std::cos;
+    auto f = [](std::vector<Real> const & x)
+    {
+        return 1/(Real(0.01) + x[0]*x[0] + cos(x[1])*x[2]*x[2]);
+    };
+    std::vector<std::pair<Real, Real>> bounds{{Real(-1), Real(2)}, {Real(0), Real(1)}, {Real(0), Real(1)}};
+    Real error_goal = 1e-2;
+    vegas<Real, decltype(f)> integrator1(f, bounds, error_goal, true, 1, 8765, 5000);
+    Real Q1 = integrator1.integrate().get();
+    for (std::uint64_t threads = 2; threads <= 5; ++threads)
+    {
+        vegas<Real, decltype(f)> integrator(f, bounds, error_goal, true, threads, 8765, 5000);
+        Real Q = integrator.integrate().get();
+        CHECK_EQUAL(Q1, Q);
+        CHECK_EQUAL(integrator1.current_error_estimate(), integrator.current_error_estimate());
+        CHECK_EQUAL(integrator1.chi_squared(), integrator.chi_squared());
+        CHECK_EQUAL(integrator1.calls(), integrator.calls());
+    }
+}
+
+template<class Real>
+void test_constant()
+{
+    auto f = [](std::vector<Real> const &)
+    {
+        return Real(3);
+    };
+    std::vector<std::pair<Real, Real>> bounds{{Real(0), Real(2)}, {Real(-1), Real(1)}};
+    // Only rounding errors in the Jacobian of the grid make the variance nonzero:
+    vegas<Real, decltype(f)> integrator(f, bounds, Real(1e-10), false, 1, 7);
+    Real Q = integrator.integrate().get();
+    CHECK_ULP_CLOSE(Real(12), Q, 64);
+    CHECK_LE(integrator.current_error_estimate(), Real(1e-10));
+    CHECK_EQUAL(integrator.iterations(), static_cast<std::uint64_t>(7));
+}
+
+template<class Real>
+void test_cancel()
+{
+    auto f = [](std::vector<Real> const & x)
+    {
+        return x[0]*x[1];
+    };
+    std::vector<std::pair<Real, Real>> bounds{{Real(0), Real(1)}, {Real(0), Real(1)}};
+    vegas<Real, decltype(f)> integrator(f, bounds, Real(0), false, 2, 7);
+    auto task = integrator.integrate();
+    integrator.cancel();
+    // The first iteration always completes, so that there's an estimate to return:
+    Real Q = task.get();
+    CHECK_ABSOLUTE_ERROR(Real(1)/4, Q, Real(1e-2));
+    CHECK_LE(static_cast<std::uint64_t>(16384), integrator.calls());
+    CHECK_LE(static_cast<std::uint64_t>(1), integrator.iterations());
+}
+
+// Returns the number of times calling f threw E:
+template<class E, class F>
+int count_throws(F f)
+{
+    int thrown = 0;
+    try
+    {
+        f();
+    }
+    catch (const E&)
+    {
+        ++thrown;
+    }
+    return thrown;
+}
+
+template<class Real>
+void test_exceptions()
+{
+#ifndef BOOST_NO_EXCEPTIONS
+    std::vector<std::pair<Real, Real>> bounds{{Real(0), Real(1)}, {Real(0), Real(1)}};
+    // Non-finite values are domain errors, reported with the offending point:
+    auto f = [](std::vector<Real> const & x)
+    {
+        if (x[0] > Real(0.5))
+        {
+            return std::numeric_limits<Real>::quiet_NaN();
+        }
+        return x[1];
+    };
+    vegas<Real, decltype(f)> integrator(f, bounds, Real(1e-3), false, 3, 7);
+    CHECK_EQUAL(count_throws<std::domain_error>([&]() { integrator.integrate().get(); }), 1);
+
+    // Exceptions thrown by the integrand reach the caller:
+    auto g = [](std::vector<Real> const & x) -> Real
+    {
+        if (x[0] > Real(0.9))
+        {
+            throw std::runtime_error("Bad x");
+        }
+        return x[0];
+    };
+    vegas<Real, decltype(g)> integrator2(g, bounds, Real(1e-3), false, 3, 7);
+    CHECK_EQUAL(count_throws<std::runtime_error>([&]() { integrator2.integrate().get(); }), 1);
+
+    CHECK_EQUAL(count_throws<std::domain_error>([&]() { vegas<Real, decltype(g)>(g, bounds, Real(1e-3), false, 1, 7, 1); }), 1);
+    CHECK_EQUAL(count_throws<std::domain_error>([&]() { vegas<Real, decltype(g)>(g, bounds, Real(1e-3), false, 1, 7, 1000, 1); }), 1);
+    std::vector<std::pair<Real, Real>> bad_bounds{{Real(0), Real(1)}, {Real(1), Real(0)}};
+    CHECK_EQUAL(count_throws<std::domain_error>([&]() { vegas<Real, decltype(g)>(g, bad_bounds, Real(1e-3)); }), 1);
+#endif
+}
+
+int main()
+{
+    test_peak<double>();
+    test_infinite_bounds<float>();
+    test_infinite_bounds<double>();
+    test_reproducible<float>();
+    test_reproducible<double>();
+    test_constant<double>();
+    test_cancel<double>();
+    test_exceptions<double>();
+
+    return boost::math::test::report_errors();
+}